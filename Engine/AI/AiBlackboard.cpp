@@ -0,0 +1,141 @@
+/*********************************************************************************************
+ \file      AiBlackboard.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements AiBlackboard: the single per-frame object pass and the player/wall
+            queries used by the enemy decision trees.
+ \details   Classification matches what the trees used to do inline: the player is the first
+            object with a PlayerComponent and a transform, walls are objects named "rect"
+            (case-insensitive) with a transform and rigid body.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "AI/AiBlackboard.h"
+#include "Composition/Composition.h"
+#include "Factory/Factory.h"
+#include "Component/EnemyDecisionTreeComponent.h"
+#include "Component/EnemyHealthComponent.h"
+#include "Component/EnemyAttackComponent.h"
+#include "Component/EnemyTypeComponent.h"
+#include "Component/SpriteAnimationComponent.h"
+#include "Component/TransformComponent.h"
+#include "Physics/Dynamics/RigidBodyComponent.h"
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    using namespace Framework::literals;
+
+    AiBlackboard::AiBlackboard()
+        : wallGrid(kWallCellSize)
+    {
+    }
+
+    void AiBlackboard::Clear()
+    {
+        player = nullptr;
+        playerX = playerY = 0.0f;
+        walls.clear();
+        wallGrid.Clear();
+        enemies.clear();
+        deadEnemies.clear();
+    }
+
+    void AiBlackboard::Build()
+    {
+        Clear();
+        for (auto& [id, gocPtr] : FACTORY->Objects())
+        {
+            (void)id;
+            if (gocPtr)
+                Consider(gocPtr.get());
+        }
+    }
+
+    void AiBlackboard::Build(std::span<GameObjectComposition* const> objects)
+    {
+        Clear();
+        for (GameObjectComposition* object : objects)
+        {
+            if (object)
+                Consider(object);
+        }
+    }
+
+    /*****************************************************************************************
+      \brief Classify one object. An object may be both a wall and an enemy, so every test
+             runs; only the first player found is kept.
+    *****************************************************************************************/
+    void AiBlackboard::Consider(GameObjectComposition* object)
+    {
+        auto* tr = object->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
+
+        if (!player && tr && object->GetComponent(ComponentTypeId::CT_PlayerComponent))
+        {
+            player = object;
+            playerX = tr->x;
+            playerY = tr->y;
+        }
+
+        if (tr && object->GetObjectNameId() == "rect"_sid)
+        {
+            if (auto* rb = object->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent))
+            {
+                const AABB box(tr->x, tr->y, rb->width, rb->height);
+                wallGrid.Insert(static_cast<GOCId>(walls.size()), box);
+                walls.push_back(box);
+            }
+        }
+
+        if (auto* ai = object->GetComponentType<EnemyDecisionTreeComponent>(ComponentTypeId::CT_EnemyDecisionTreeComponent))
+        {
+            AiAgent agent;
+            agent.object = object;
+            agent.ai = ai;
+            agent.transform = tr;
+            agent.body = object->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
+
+            auto* health = object->GetComponentType<EnemyHealthComponent>(ComponentTypeId::CT_EnemyHealthComponent);
+            if (health && health->enemyHealth <= 0)
+            {
+                deadEnemies.push_back(agent);
+                return;
+            }
+
+            agent.attack = object->GetComponentType<EnemyAttackComponent>(ComponentTypeId::CT_EnemyAttackComponent);
+            agent.type = object->GetComponentType<EnemyTypeComponent>(ComponentTypeId::CT_EnemyTypeComponent);
+            agent.animation = object->GetComponentType<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent);
+            enemies.push_back(agent);
+        }
+    }
+
+    bool AiBlackboard::PlayerWithin(float x, float y, float radius) const
+    {
+        if (!player)
+            return false;
+        const float dx = x - playerX;
+        const float dy = y - playerY;
+        return (dx * dx + dy * dy) <= radius * radius;
+    }
+
+    bool AiBlackboard::OverlapsWall(const AABB& box) const
+    {
+        if (walls.empty())
+            return false;
+
+        thread_local std::vector<GOCId> candidates;
+        wallGrid.Query(box, candidates);
+        for (GOCId id : candidates)
+        {
+            if (Collision::CheckCollisionRectToRect(box, walls[id]))
+                return true;
+        }
+        return false;
+    }
+}
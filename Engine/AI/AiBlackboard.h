@@ -0,0 +1,106 @@
+/*********************************************************************************************
+ \file      AiBlackboard.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Per-frame snapshot of the world state that enemy decision trees read from.
+ \details   AiSystem rebuilds the blackboard once per update in a single pass over the
+            objects. It records:
+            - The player object and its position.
+            - Wall AABBs ("rect" objects), in a UniformGrid for patrol look-ahead tests.
+            - The enemies to evaluate this frame, split into alive and dead.
+            Trees then query the blackboard instead of scanning FACTORY->Objects() on every
+            condition or action.
+
+            The blackboard is read-only while trees run, so enemies can be evaluated on
+            worker threads. OverlapsWall() uses a thread-local query buffer for that reason.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "Systems/UniformGrid.h"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Framework
+{
+    class GameObjectComposition;
+    class EnemyDecisionTreeComponent;
+    class TransformComponent;
+    class RigidBodyComponent;
+    class EnemyAttackComponent;
+    class EnemyTypeComponent;
+    class SpriteAnimationComponent;
+    class NavGrid;
+
+    /// One enemy with a decision tree and the components its tree uses, resolved once per frame.
+    struct AiAgent
+    {
+        GameObjectComposition*      object = nullptr;
+        EnemyDecisionTreeComponent* ai = nullptr;
+        TransformComponent*         transform = nullptr;
+        RigidBodyComponent*         body = nullptr;
+        EnemyAttackComponent*       attack = nullptr;     ///< May be null
+        EnemyTypeComponent*         type = nullptr;       ///< May be null (treated as melee)
+        SpriteAnimationComponent*   animation = nullptr;  ///< May be null
+    };
+
+    /*****************************************************************************************
+      \class AiBlackboard
+      \brief Shared, read-only (during evaluation) AI view of the current frame.
+    *****************************************************************************************/
+    class AiBlackboard
+    {
+    public:
+        /// Cell size in world units for the wall grid. Level tiles are roughly 0.1 - 0.5 wide.
+        static constexpr float kWallCellSize = 0.5f;
+
+        AiBlackboard();
+
+        /// Rebuild from every object owned by the factory.
+        void Build();
+
+        /// Rebuild from an explicit object list (used by the stress benchmark).
+        void Build(std::span<GameObjectComposition* const> objects);
+
+        bool HasPlayer() const { return player != nullptr; }
+        GameObjectComposition* Player() const { return player; }
+        float PlayerX() const { return playerX; }
+        float PlayerY() const { return playerY; }
+
+        /// True if the player is within \a radius of (x, y).
+        bool PlayerWithin(float x, float y, float radius) const;
+
+        /// True if \a box overlaps any wall. Safe to call from several threads at once.
+        bool OverlapsWall(const AABB& box) const;
+
+        /// Enemies whose tree should run this frame.
+        const std::vector<AiAgent>& Enemies() const { return enemies; }
+
+        /// Enemies with an EnemyHealthComponent at zero health; their trees are skipped.
+        const std::vector<AiAgent>& DeadEnemies() const { return deadEnemies; }
+
+        std::size_t WallCount() const { return walls.size(); }
+        const std::vector<AABB>& Walls() const { return walls; }
+
+        /// Flow field toward the player, or null when there is none. Not reset by Build().
+        const NavGrid* Navigation() const { return navigation; }
+        void SetNavigation(const NavGrid* grid) { navigation = grid; }
+
+    private:
+        void Clear();
+        void Consider(GameObjectComposition* object);
+
+        GameObjectComposition* player = nullptr;
+        float                  playerX = 0.0f;
+        float                  playerY = 0.0f;
+
+        std::vector<AABB>    walls;
+        UniformGrid          wallGrid;
+        std::vector<AiAgent> enemies;
+        std::vector<AiAgent> deadEnemies;
+        const NavGrid*       navigation = nullptr;
+    };
+}
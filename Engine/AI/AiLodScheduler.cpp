@@ -0,0 +1,104 @@
+/*********************************************************************************************
+ \file      AiLodScheduler.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements AiLodScheduler: tier classification, the budgeted round-robin far
+            slice and the per-tree cost estimate.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "AI/AiLodScheduler.h"
+#include "Component/EnemyDecisionTreeComponent.h"
+#include "Component/TransformComponent.h"
+#include <algorithm>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        /// Weight of the newest sample in the cost moving average.
+        constexpr double kCostSmoothing = 0.1;
+
+        bool InsideView(const AiLodScheduler::ViewRect& view, float margin, float x, float y)
+        {
+            return x >= view.minX - margin && x <= view.maxX + margin &&
+                y >= view.minY - margin && y <= view.maxY + margin;
+        }
+    }
+
+    /*****************************************************************************************
+      \brief Near enemies first, then the far slice starting at the round-robin cursor.
+    *****************************************************************************************/
+    void AiLodScheduler::Schedule(const AiBlackboard& board, float dt, const Settings& settings,
+        const ViewRect* view, std::vector<AiAgent>& due)
+    {
+        due.clear();
+        farAgents.clear();
+        stats = {};
+        stats.usPerTree = usPerTree;
+
+        for (const AiAgent& agent : board.Enemies())
+        {
+            agent.ai->state.accumulatedDt += dt;
+
+            if (!settings.enabled || !agent.transform)
+            {
+                due.push_back(agent);
+                continue;
+            }
+
+            const float x = agent.transform->x;
+            const float y = agent.transform->y;
+            const bool isNear = board.PlayerWithin(x, y, settings.nearRadius) ||
+                (view && InsideView(*view, settings.viewMargin, x, y));
+            if (isNear)
+                due.push_back(agent);
+            else
+                farAgents.push_back(agent);
+        }
+
+        stats.nearCount = due.size();
+        stats.farCount = farAgents.size();
+        if (farAgents.empty())
+            return;
+
+        // Minimum slice keeps every far enemy on a farInterval-tick cycle; the budget may add more.
+        const std::size_t interval = static_cast<std::size_t>(std::max(1, settings.farInterval));
+        const std::size_t minSlice = (farAgents.size() + interval - 1) / interval;
+        const double spareUs = settings.budgetUs - usPerTree * static_cast<double>(due.size());
+        const std::size_t affordable = (spareUs > 0.0 && usPerTree > 0.0)
+            ? static_cast<std::size_t>(spareUs / usPerTree) : 0;
+        const std::size_t slice = std::min(farAgents.size(), std::max(minSlice, affordable));
+
+        if (farCursor >= farAgents.size())
+            farCursor = 0;
+        for (std::size_t i = 0; i < slice; ++i)
+            due.push_back(farAgents[(farCursor + i) % farAgents.size()]);
+        farCursor = (farCursor + slice) % farAgents.size();
+
+        stats.farEvaluated = slice;
+    }
+
+    void AiLodScheduler::ReportCost(double microseconds, std::size_t evaluated)
+    {
+        if (evaluated == 0)
+            return;
+        const double sample = microseconds / static_cast<double>(evaluated);
+        usPerTree += (sample - usPerTree) * kCostSmoothing;
+    }
+
+    float AiLodScheduler::ConsumeStep(const AiAgent& agent, float maxStep)
+    {
+        EnemyAiState& state = agent.ai->state;
+        const float step = std::min(state.accumulatedDt, maxStep);
+        state.accumulatedDt = 0.0f;
+        return step;
+    }
+}
@@ -0,0 +1,87 @@
+/*********************************************************************************************
+ \file      AiLodScheduler.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Chooses which enemies run their decision tree this tick (AI level of detail).
+ \details   Enemies are split into two tiers every tick:
+            - Near: within Settings::nearRadius of the player or inside the camera view.
+              These run every tick.
+            - Far: everyone else. These run in round-robin slices. Each tick takes at least
+              1/farInterval of them, so every far enemy runs at least once per
+              farInterval ticks. More are added while the estimated cost stays inside
+              Settings::budgetUs.
+
+            The cost estimate is a moving average of the measured microseconds per tree,
+            fed back with ReportCost(). Near enemies and the minimum far slice are never
+            dropped, so the budget is a target rather than a hard cap. Because the estimate
+            is wall-clock time, AiSystem sets the budget to 0 during a lockstep replay, so
+            the slice sizes do not depend on how fast the build runs.
+
+            Skipped enemies keep their velocity, so physics keeps moving them. Their
+            skipped time builds up in EnemyAiState::accumulatedDt, and the next run
+            receives all of it, so pause timers and patrol look-ahead stay correct.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "AI/AiBlackboard.h"
+#include <cstddef>
+#include <vector>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class AiLodScheduler
+      \brief Near/far tiering with budgeted round-robin slices for far enemies.
+    *****************************************************************************************/
+    class AiLodScheduler
+    {
+    public:
+        struct Settings
+        {
+            bool   enabled = true;        ///< Off: every enemy runs every tick
+            float  nearRadius = 2.0f;     ///< World units around the player
+            float  viewMargin = 0.5f;     ///< Added around the camera view
+            int    farInterval = 4;       ///< Far enemies run at least once per this many ticks
+            double budgetUs = 1000.0;     ///< Per-tick target for tree evaluation; <= 0 keeps the minimum slice
+            float  maxStep = 0.25f;       ///< Cap on the accumulated dt handed to one run
+        };
+
+        /// World-space rectangle treated as visible (the game camera view).
+        struct ViewRect
+        {
+            float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+        };
+
+        struct Stats
+        {
+            std::size_t nearCount = 0;
+            std::size_t farCount = 0;
+            std::size_t farEvaluated = 0;
+            double      usPerTree = 0.0;  ///< Current cost estimate
+        };
+
+        /*************************************************************************************
+          \brief Add \a dt to every living enemy and fill \a due with the enemies to run.
+          \param view Visible area, or null when there is no game camera.
+        *************************************************************************************/
+        void Schedule(const AiBlackboard& board, float dt, const Settings& settings,
+            const ViewRect* view, std::vector<AiAgent>& due);
+
+        /// Feed back the measured evaluation time of the last Schedule()d set.
+        void ReportCost(double microseconds, std::size_t evaluated);
+
+        /// Take and reset an enemy's accumulated time, capped at \a maxStep.
+        static float ConsumeStep(const AiAgent& agent, float maxStep);
+
+        const Stats& LastStats() const { return stats; }
+
+    private:
+        std::vector<AiAgent> farAgents;   ///< Scratch; "near"/"far" are macros under <Windows.h>
+        std::size_t          farCursor = 0;
+        double               usPerTree = 0.5;
+        Stats                stats;
+    };
+}
@@ -1,9 +1,24 @@
+/*********************************************************************************************
+ \file      DecisionTreeAsset.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Flat, data-driven description of an enemy decision tree.
+ \details   A tree is an array of nodes. Condition nodes branch to trueChild/falseChild and
+            action nodes end the walk. DecisionTreeLibrary loads assets from JSON and
+            rewrites node ids into array indices, so the interpreter (RunDecisionTree) never
+            searches for a node. One asset is shared by every enemy that uses it; per-enemy
+            data lives in EnemyAiState.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
 #pragma once
 #include <string>
 #include <vector>
 enum class DTNodeType
 { Condition,Action};
 
+/// PlayerNear: player within ConditionValue, or still remembered from an earlier sighting.
 enum class DTConditionType
 {None, PlayerNear,AlwaysTrue};
 
@@ -13,9 +28,10 @@ enum class DTActionType
 struct DecisionTreeNodeData
 {
     int NodeId = -1;
+    DTNodeType type = DTNodeType::Action;
     DTConditionType conditiontype = DTConditionType::None;
     float ConditionValue = 0.0f;
-    DTActionType action = DTActionType::None;
+    DTActionType action = DTActionType::None;   ///< Action nodes; also the fallback of a condition with a missing child
     int trueChild = -1;
     int falseChild = -1;
 };
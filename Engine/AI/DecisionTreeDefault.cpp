@@ -4,19 +4,19 @@
  \author    jianwei.c (jianwei.c@digipen.edu) - Primary Author, 80%
             yimo kong (yimo.kong@digipen.edu)      - Author, 20%
 
- \brief     Implementation of default decision tree behavior for enemy AI. Defines helper
-            functions that manage proximity checks, tree creation, and periodic updates
-            for simple patrol and attack behaviors.
+ \brief     Implementation of default decision tree behavior for enemy AI. Defines the
+            conditions and actions the decision tree interpreter dispatches to: proximity
+            checks, patrol, melee and ranged attacks, and idling.
 
  \details
-            This module provides a reusable default decision tree structure used by
-            enemy entities. The decision tree includes:
+            The default enemy trees ("enemy_melee" / "enemy_ranged") are:
             - A proximity check to detect the player.
             - An attack branch triggered upon player detection.
             - A patrol branch used when the player is not nearby.
 
-            The functions in this file handle tree construction, condition evaluation,
-            and execution of context-specific actions such as movement or attack logic.
+            Each behavior reads the shared AiBlackboard and writes only the enemy's own
+            components and EnemyAiState. Attacks are recorded as an EnemyAttackRequest and
+            spawned by ApplyEnemyAttackRequest() once the batch is done.
 
  \copyright
             All content © 2025 DigiPen Institute of Technology Singapore.
@@ -24,12 +24,13 @@
 *********************************************************************************************/
 
 #include "DecisionTreeDefault.h"
+#include "AI/AiBlackboard.h"
+#include "AI/NavGrid.h"
 #include "Component/SpriteAnimationComponent.h"
 #include "Component/EnemyTypeComponent.h"
 
 #include <algorithm>
-#include <cctype>
-#include <string_view>
+#include <cstdint>
 #include <cmath>
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
@@ -38,586 +39,419 @@
 #endif
 namespace Framework
 {
+    using namespace Framework::literals;
+
     namespace
     {
-        /*****************************************************************************************
-         \brief  Find the index of a named animation on a SpriteAnimationComponent (case-insensitive).
-
-         \param anim
-                Pointer to the SpriteAnimationComponent.
-         \param desired
-                Name of the animation we want to find.
-
-         \return
-                Index of the animation if found, otherwise -1.
-        *****************************************************************************************/
-        int FindAnimationIndex(SpriteAnimationComponent* anim, std::string_view desired)
-        {
-            if (!anim)
-                return -1;
-
-            auto equalsIgnoreCase = [](std::string_view a, std::string_view b)
-                {
-                    if (a.size() != b.size())
-                        return false;
-
-                    for (std::size_t i = 0; i < a.size(); ++i)
-                    {
-                        if (std::tolower(static_cast<unsigned char>(a[i])) !=
-                            std::tolower(static_cast<unsigned char>(b[i])))
-                            return false;
-                    }
-                    return true;
-                };
-
-            for (std::size_t i = 0; i < anim->animations.size(); ++i)
-            {
-                if (equalsIgnoreCase(anim->animations[i].name, desired))
-                    return static_cast<int>(i);
-            }
-
-            return -1;
-        }
-
         /*****************************************************************************************
          \brief  Helper to safely switch an animation by name if it exists on the given object.
                  Does nothing if the component or animation is missing.
          *****************************************************************************************/
-        void PlayAnimationIfAvailable(GOC* goc, std::string_view name, bool forceRestart = false)
+        void PlayAnimationIfAvailable(SpriteAnimationComponent* anim, StringId name)
         {
-            (void)forceRestart;
-            if (!goc)
-                return;
-
-            auto* anim = goc->GetComponentType<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent);
             if (!anim)
                 return;
 
-            const int idx = FindAnimationIndex(anim, name);
+            const int idx = anim->FindAnimationIndex(name);
             if (idx >= 0 && idx != anim->ActiveAnimationIndex())
             {
                 anim->SetActiveAnimation(idx);
             }
         }
 
-        float GetAnimationDuration(GOC* enemy, const std::string& name)
+        float GetAnimationDuration(const SpriteAnimationComponent* anim, StringId name)
         {
-            auto* anim = enemy->GetComponentType<SpriteAnimationComponent>(
-                ComponentTypeId::CT_SpriteAnimationComponent);
-
             if (!anim) return 0.2f;
 
-            for (auto& a : anim->animations)
-            {
-                if (a.name == name)
-                {
-                    return a.config.totalFrames / a.config.fps;
-                }
-            }
-            return 0.2f;
+            const int idx = anim->FindAnimationIndex(name);
+            if (idx < 0) return 0.2f;
+
+            const auto& a = anim->animations[static_cast<std::size_t>(idx)];
+            return a.config.totalFrames / a.config.fps;
+        }
+
+        /*****************************************************************************************
+         \brief  Roll a percentage (0-99) from the enemy's own xorshift state. Unlike rand(),
+                 this has no shared state, so trees on worker threads stay independent.
+        *****************************************************************************************/
+        int RollPercent(std::uint32_t& state)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return static_cast<int>(state % 100u);
         }
     }
 
     /*****************************************************************************************
     \brief
-    Checks whether the player is within a specified distance of the given enemy.
+    Checks whether the enemy should be chasing the player.
 
-    \param enemy
-    Pointer to the enemy game object being evaluated.
+    \param board
+    Blackboard for the current frame.
+    \param agent
+    Enemy being evaluated.
     \param radius
-    Distance threshold for proximity detection (default is 0.1f).
+    Detection distance.
 
     \return
-    True if the player is within the given radius, otherwise false.
+    True if the player is within \p radius now or was seen recently.
+
+    \details
+    A sighting resets the chase timer; ActionChaseAttack() forgets the player once the
+    chase timer runs out.
     *****************************************************************************************/
-    bool IsPlayerNear(GOC* enemy, float radius)
+    bool ConditionPlayerNear(const AiBlackboard& board, const AiAgent& agent, float radius)
     {
-        if (!enemy)
-            return false;
-
-        GOC* player = nullptr;
-        auto& objects = FACTORY->Objects();
-
-        // Find the first object that has a PlayerComponent
-        for (auto& kv : objects)
+        EnemyAiState& ai = agent.ai->state;
+        if (agent.transform && board.PlayerWithin(agent.transform->x, agent.transform->y, radius))
         {
-            GOC* goc = kv.second.get();
-            if (!goc)
-                continue;
-
-            auto* base = goc->GetComponent(ComponentTypeId::CT_PlayerComponent);
-            if (base)
-            {
-                player = goc;
-                break;
-            }
+            ai.hasSeenPlayer = true;
+            ai.chaseTimer = 0.0f;
         }
-
-        if (!player)
-            return false;
-
-        // Access transforms of enemy and player
-        auto* enemyTra = enemy->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
-        auto* playerTra = player->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
-        if (!enemyTra || !playerTra)
-            return false;
-
-        float dx = enemyTra->x - playerTra->x;
-        float dy = enemyTra->y - playerTra->y;
-        return (dx * dx + dy * dy) <= radius * radius;
+        return ai.hasSeenPlayer;
     }
 
     /*****************************************************************************************
     \brief
-    Creates a default decision tree for basic enemy AI behavior.
-
-    \param enemy
-    Pointer to the enemy game object that will own the decision tree.
-    \param logic
-    Pointer to the LogicSystem, used to spawn hitboxes for attacks.
-
-    \return
-    A unique pointer to a newly created DecisionTree containing patrol and attack logic.
+    Simple left-right patrol with a pause when turning around at the patrol range or
+    in front of a wall.
     *****************************************************************************************/
-    std::unique_ptr<DecisionTree> CreateDefaultEnemyTree(GOC* enemy, LogicSystem* logic)
+    void ActionPatrol(const AiBlackboard& board, const AiAgent& agent, float dt)
     {
-        if (!enemy)
-            return nullptr;
-
-        const GOCId enemyID = enemy->GetId();
-        // ---------------------------------------------------------------------
-        // Patrol leaf: simple left-right patrol with pause when turning around.
-        // ---------------------------------------------------------------------
-        auto patrolLeaf = std::make_unique<DecisionNode>(
-            nullptr, nullptr, nullptr,
-            [enemyID](float dt)
-            {
-                GOC* enemy = FACTORY->GetObjectWithId(enemyID);
-                if (!enemy)
-                    return;
+        RigidBodyComponent* rb = agent.body;
+        TransformComponent* tr = agent.transform;
+        if (!(rb && tr))
+            return;
 
-                auto* rb = enemy->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
-                auto* tr = enemy->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
-                auto* ai = enemy->GetComponentType<EnemyDecisionTreeComponent>(ComponentTypeId::CT_EnemyDecisionTreeComponent);
+        EnemyAiState& ai = agent.ai->state;
 
-                if (!(rb && tr && ai))
-                    return;
+        // Initialize patrol origin once
+        if (!ai.patrolOriginSet)
+        {
+            ai.patrolOriginX = tr->x;
+            ai.patrolOriginY = tr->y;
+            ai.patrolOriginSet = true;
+            if (ai.dir == 0.0f)
+                ai.dir = 1.0f;
+        }
 
-                // Initialize patrol origin once
-                if (!ai->patrolOriginSet)
-                {
-                    ai->patrolOriginX = tr->x;
-                    ai->patrolOriginY = tr->y;
-                    ai->patrolOriginSet = true;
-                    if (ai->dir == 0.0f)
-                        ai->dir = 1.0f;
-                }
+        const float patrolSpeed = 0.6f;
+        const float patrolRange = 10.0f;
+        const float pauseDuration = 2.0f;
 
-                const float patrolSpeed = 0.6f;
-                const float patrolRange = 10.0f;
-                const float pauseDuration = 2.0f;
+        float leftEdge = ai.patrolOriginX - patrolRange;
+        float rightEdge = ai.patrolOriginX + patrolRange;
 
-                float leftEdge = ai->patrolOriginX - patrolRange;
-                float rightEdge = ai->patrolOriginX + patrolRange;
+        // Pause handling
+        if (ai.pauseTimer > 0.0f)
+        {
+            ai.pauseTimer -= dt;
+            rb->velX = 0.0f;
+            rb->velY = 0.0f;
+            return;
+        }
 
-                // Pause handling
-                if (ai->pauseTimer > 0.0f)
-                {
-                    ai->pauseTimer -= dt;
-                    rb->velX = 0.0f;
-                    rb->velY = 0.0f;
-                    return;
-                }
+        // Set velocity
+        rb->velX = patrolSpeed * ai.dir;
+        rb->velY = 0.0f;
 
-                // Set velocity
-                rb->velX = patrolSpeed * ai->dir;
-                rb->velY = 0.0f;
+        // Predict future position for collision detection
+        float futureX = tr->x + rb->velX * dt;
+        AABB futureBox(futureX, tr->y, rb->width, rb->height);
 
-                // Predict future position for collision detection
-                float futureX = tr->x + rb->velX * dt;
-                AABB futureBox(futureX, tr->y, rb->width, rb->height);
+        const bool collisionDetected = board.OverlapsWall(futureBox);
 
-                bool collisionDetected = false;
-                auto& objects = FACTORY->Objects();
+        // Check boundaries OR collision
+        if (collisionDetected || futureX <= leftEdge || futureX >= rightEdge)
+        {
+            ai.dir *= -1.0f;
+            ai.pauseTimer = pauseDuration;
+            rb->velX = 0.0f;
+        }
 
-                for (auto& [_, other] : objects)
-                {
+        ai.prevX = tr->x;
+        PlayAnimationIfAvailable(agent.animation, "idle"_sid);
+    }
 
-                    auto* rbO = other->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
-                    auto* trO = other->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
-                    if (!rbO || !trO)
-                        continue;
+    /*****************************************************************************************
+    \brief
+    Chase the player and request an attack when in range. Also drives enemy attack/idle
+    animations.
 
-                    std::string otherName = other->GetObjectName();
-                    std::transform(otherName.begin(), otherName.end(), otherName.begin(),
-                        [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+    \param ranged
+    True for ranged enemies: keep distance, retreat after shooting and fire projectiles.
+    *****************************************************************************************/
+    void ActionChaseAttack(const AiBlackboard& board, const AiAgent& agent, float dt, bool ranged)
+    {
+        EnemyAttackComponent* attack = agent.attack;
+        RigidBodyComponent* rb = agent.body;
+        TransformComponent* tr = agent.transform;
+        if (!attack || !rb || !tr)
+            return;
 
-                    if (otherName == "rect")
-                    {
-                        AABB wallBox(trO->x, trO->y, rbO->width, rbO->height);
-                        if (Collision::CheckCollisionRectToRect(futureBox, wallBox))
-                        {
-                            collisionDetected = true;
-                            break;
-                        }
-                    }
-                }
+        EnemyAiState& ai = agent.ai->state;
+        if (!board.HasPlayer())
+            return;
+
+        // Direction and distance to player
+        float dx = board.PlayerX() - tr->x;
+        float dy = board.PlayerY() - tr->y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        attack->attack_timer += dt;
+        const float speed = 1.0f;
+        const float accel = 2.0f;
+
+        const bool isRanged = ranged;
+
+        // Keep ranged enemies a bit closer so they don't aggro from too far away
+        float stopDistance = isRanged ? 1.0f : 0.1f;
+        //Ranged Retreat
+        const float preferredMinDistance = 0.5f;   // Too close → retreat
+        const float preferredMaxDistance = 1.2f;   // Too far → approach
+        const float retreatSpeed = 0.45f;
+        const float retreatDurationAfterShot = 3.0f;
+        // ---------------------------------------
+        // RANGED MOVEMENT / RETREAT
+        // ---------------------------------------
+        if (isRanged)
+        {
+            float norm = (distance > 0.001f) ? distance : 1.0f;
+            float dirX = dx / norm;
+            float dirY = dy / norm;
 
-                // Check boundaries OR collision
-                if (collisionDetected || futureX <= leftEdge || futureX >= rightEdge)
+            // 1️ Retreat after shooting
+            if (ai.retreatTimer > 0.0f)
+            {
+                ai.retreatTimer -= dt;
+                rb->velX = -dirX * retreatSpeed;
+                rb->velY = -dirY * retreatSpeed;
+            }
+            // 2️ Player too close → retreat with chance
+            else if (distance < preferredMinDistance)
+            {
+                if (RollPercent(ai.rngState) < 20)
+                {
+                    rb->velX = -dirX * retreatSpeed;
+                }
+                else
                 {
-                    ai->dir *= -1.0f;
-                    ai->pauseTimer = pauseDuration;
-                    rb->velX = 0.0f;
+                    rb->velX *= 0.5f;
                 }
+            }
+            // 3️ Player too far → approach
+            else if (distance > preferredMaxDistance)
+            {
+                rb->velX = dirX * speed;
 
-                ai->prevX = tr->x;
-                PlayAnimationIfAvailable(enemy, "idle");
             }
-        );
-
-        // ---------------------------------------------------------------------
-        // Attack leaf: chase the player and spawn a hitbox when in range.
-        // Also drives enemy attack/idle animations.
-        // Extended to support ranged enemies (projectiles) based on EnemyTypeComponent.
-        // ---------------------------------------------------------------------
-        auto AttackLeaf = std::make_unique<DecisionNode>(
-            nullptr,
-            nullptr,
-            nullptr,
-            [enemyID, logic](float dt)
+            // 4️ Ideal distance → idle/slow down
+            else
             {
-                GOC* enemy = FACTORY->GetObjectWithId(enemyID);
-                if (!enemy)
-                    return;
+                rb->velX *= 0.85f;
 
-                auto* attack = enemy->GetComponentType<EnemyAttackComponent>(ComponentTypeId::CT_EnemyAttackComponent);
-                auto* rb = enemy->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
-                auto* tr = enemy->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
-                auto* ai = enemy->GetComponentType<EnemyDecisionTreeComponent>(ComponentTypeId::CT_EnemyDecisionTreeComponent);
-                auto* typeComp = enemy->GetComponentType<EnemyTypeComponent>(ComponentTypeId::CT_EnemyTypeComponent);
-                auto* audio = enemy->GetComponentType<AudioComponent>(ComponentTypeId::CT_AudioComponent);
+            }
+        }
 
-                if (!attack || !rb || !tr || !ai)
-                    return;
+        // Smoothly move towards the player, around walls when the level has a flow field
+        if (distance > stopDistance)
+        {
+            float norm = (distance > 0.001f) ? distance : 1.0f;
+            float moveX = dx / norm;
+            float moveY = dy / norm;
+            if (const NavGrid* nav = board.Navigation())
+                nav->Steer(tr->x, tr->y, moveX, moveY);
+            float targetVX = moveX * speed;
+            float targetVY = moveY * speed;
+
+            // Smooth approach using simple linear interpolation
+            rb->velX += (targetVX - rb->velX) * std::min(accel * dt, 1.0f);
+            rb->velY += (targetVY - rb->velY) * std::min(accel * dt, 1.0f);
+        }
+        else
+        {
+            // Slow down when very close to the player
+            rb->velX *= 0.5f;
+            rb->velY *= 0.5f;
+        }
 
-                GOC* player = nullptr;
-                ai->chaseSpeed = 0.05f;
+        // Determine facing direction based on player position
+        ai.facing = (dx < 0.0f) ? Facing::LEFT : Facing::RIGHT;
 
-                auto& objects = FACTORY->Objects();
-                for (auto& kv : objects)
-                {
-                    GOC* goc = kv.second.get();
-                    if (!goc)
-                        continue;
+        if (attack->attack_timer >= attack->attack_speed &&
+            ai.retreatTimer <= 0.0f)
+        {
+            // Check range before attacking. Ranged enemies should only fire when much closer.
+            bool canAttack = isRanged ? (distance < 3.5f) : (distance < 0.8f);
 
-                    auto* base = goc->GetComponent(ComponentTypeId::CT_PlayerComponent);
-                    if (base)
-                    {
-                        player = goc;
-                        break;
-                    }
-                }
+            if (canAttack)
+            {
+                // Note: For melee, we check !attack->hitbox->active. For ranged, we just fire.
+                bool meleeReady = !isRanged && !attack->hitbox->active;
+                bool rangedReady = isRanged; // Ranged fires based on timer solely
 
-                if (!player)
-                    return;
-
-                auto* trplayer = player->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
-                if (!trplayer)
-                    return;
-
-                // Direction and distance to player
-                float dx = trplayer->x - tr->x;
-                float dy = trplayer->y - tr->y;
-                float distance = std::sqrt(dx * dx + dy * dy);
-                attack->attack_timer += dt;
-                const float speed = 1.0f;
-                const float accel = 2.0f;
-
-                // Determine behavior based on Type (melee vs ranged)
-                bool isRanged = (typeComp && typeComp->Etype == EnemyTypeComponent::EnemyType::ranged);
-
-
-                // Keep ranged enemies a bit closer so they don't aggro from too far away
-                float stopDistance = isRanged ? 1.0f : 0.1f;
-                //Ranged Retreat
-                const float preferredMinDistance = 0.5f;   // Too close → retreat
-                const float preferredMaxDistance = 1.2f;   // Too far → approach
-                const float retreatSpeed = 0.45f;
-                const float retreatDurationAfterShot = 3.0f;
-                // ---------------------------------------
-                // RANGED MOVEMENT / RETREAT
-                // ---------------------------------------
-                if (isRanged)
+                if (meleeReady || rangedReady)
                 {
-                    float norm = (distance > 0.001f) ? distance : 1.0f;
-                    float dirX = dx / norm;
-                    float dirY = dy / norm;
+                    attack->attack_timer = 0.0f;
+                    EnemyAttackRequest& request = ai.attackRequest;
 
-                    // 1️ Retreat after shooting
-                    if (ai->retreatTimer > 0.0f)
+                    if (isRanged)
                     {
-                        ai->retreatTimer -= dt;
-                        rb->velX = -dirX * retreatSpeed;
-                        rb->velY = -dirY * retreatSpeed;
+                        // --- Ranged Attack: Spawn Projectile ---
+                        float norm = (distance > 0.001f) ? distance : 1.0f;
+                        float dirX = dx / norm;
+                        float dirY = dy / norm;
+
+                        // Spawn offset to avoid immediate collisions with nearby hitboxes.
+                        const float halfW = rb->width * 0.5f;
+                        const float halfH = rb->height * 0.5f;
+                        const float spawnOffset = std::max(halfW, halfH) + 0.1f;
+
+                        request.kind = EnemyAttackRequest::Kind::Projectile;
+                        request.x = tr->x + dirX * spawnOffset;
+                        request.y = tr->y + dirY * spawnOffset;
+                        request.dirX = dirX;
+                        request.dirY = dirY;
+                        request.speed = 0.2f;       // Projectile speed
+                        request.width = 0.3f;       // Size
+                        request.height = 0.15f;
+                        request.damage = static_cast<float>(attack->damage);
+                        request.duration = 3.0f;    // Duration
+                        PlayAnimationIfAvailable(agent.animation, "rangeattack"_sid);
+                        ai.retreatTimer = retreatDurationAfterShot;
                     }
-                    // 2️ Player too close → retreat with chance
-                    else if (distance < preferredMinDistance)
-                    {
-                        if ((rand() % 100) < 20)
-                        {
-                            rb->velX = -dirX * retreatSpeed;
-                        }
-                        else
-                        {
-                            rb->velX *= 0.5f;
-                        }
-                    }
-                    // 3️ Player too far → approach
-                    else if (distance > preferredMaxDistance)
-                    {
-                        rb->velX = dirX * speed;
-
-                    }
-                    // 4️ Ideal distance → idle/slow down
                     else
                     {
-                        rb->velX *= 0.85f;
-
-                    }
-                }
-
-
+                        // --- Melee Attack: Spawn Hitbox ---
+                        attack->hitbox->active = true;
+                        float direction = (ai.facing == Facing::LEFT) ? -1.0f : 1.0f;
 
-                // Smoothly move towards the player
-                if (distance > stopDistance)
-                {
-                    float norm = (distance > 0.001f) ? distance : 1.0f;
-                    float targetVX = (dx / norm) * speed;
-                    float targetVY = (dy / norm) * speed;
+                        float hbWidth = rb->width * 1.2f;
+                        float hbHeight = rb->height * 0.8f;
 
-                    // Smooth approach using simple linear interpolation
-                    rb->velX += (targetVX - rb->velX) * std::min(accel * dt, 1.0f);
-                    rb->velY += (targetVY - rb->velY) * std::min(accel * dt, 1.0f);
-                }
-                else
-                {
-                    // Slow down when very close to the player
-                    rb->velX *= 0.5f;
-                    rb->velY *= 0.5f;
-                }
+                        attack->hitbox->duration = GetAnimationDuration(agent.animation, "slashattack"_sid);
 
+                        request.kind = EnemyAttackRequest::Kind::Melee;
+                        request.x = tr->x + (direction * hbWidth * 0.25f);   // just outside the enemy's hitbox
+                        request.y = tr->y;                                    // centered vertically
+                        request.width = hbWidth;
+                        request.height = hbHeight;
+                        request.damage = static_cast<float>(attack->damage);
+                        request.duration = attack->hitbox->duration;
 
-                // Determine facing direction based on player position
-                ai->facing = (dx < 0.0f) ? Facing::LEFT : Facing::RIGHT;
-
-                if (attack->attack_timer >= attack->attack_speed &&
-                    ai->retreatTimer <= 0.0f)
-                {
-                    // Check range before attacking. Ranged enemies should only fire when much closer.
-                    bool canAttack = isRanged ? (distance < 3.5f) : (distance < 0.8f);
-
-                    if (canAttack)
-                    {
-                        // Note: For melee, we check !attack->hitbox->active. For ranged, we just fire.
-                        bool meleeReady = !isRanged && !attack->hitbox->active;
-                        bool rangedReady = isRanged; // Ranged fires based on timer solely
-
-                        if (meleeReady || rangedReady)
-                        {
-                            attack->attack_timer = 0.0f;
-
-                            if (isRanged)
-                            {
-                                // --- Ranged Attack: Spawn Projectile ---
-                                float norm = (distance > 0.001f) ? distance : 1.0f;
-                                float dirX = dx / norm;
-                                float dirY = dy / norm;
-
-                                // Spawn offset to avoid immediate collisions with nearby hitboxes.
-                                float spawnX = tr->x;
-                                float spawnY = tr->y;
-                                if (rb)
-                                {
-                                    const float halfW = rb->width * 0.5f;
-                                    const float halfH = rb->height * 0.5f;
-                                    const float spawnOffset = std::max(halfW, halfH) + 0.1f;
-                                    spawnX += dirX * spawnOffset;
-                                    spawnY += dirY * spawnOffset;
-                                }
-
-                                logic->hitBoxSystem->SpawnProjectile(
-                                    enemy,
-                                    spawnX, spawnY,
-                                    dirX, dirY,
-                                    0.2f,       // Projectile speed 
-                                    0.3f, 0.15f, // Size
-                                    static_cast<float>(attack->damage),
-                                    3.0f,        // Duration
-                                    HitBoxComponent::Team::Enemy
-                                );
-                                if (audio)
-                                {
-                                    audio->TriggerSound("EnemyAttack");
-                                }
-                                PlayAnimationIfAvailable(enemy, "rangeattack", true);
-                                ai->retreatTimer = retreatDurationAfterShot;
-                            }
-                            else
-                            {
-                                // --- Melee Attack: Spawn Hitbox ---
-                                attack->hitbox->active = true;
-                                float direction = (ai->facing == Facing::LEFT) ? -1.0f : 1.0f;
-
-                                float hbWidth = rb->width * 1.2f;
-                                float hbHeight = rb->height * 0.8f;
-
-                                // Spawn X just outside enemy's hitbox
-                                float spawnX = tr->x + (direction * hbWidth * 0.25f);
-                                float spawnY = tr->y; // centered vertically
-
-                                attack->hitbox->duration = GetAnimationDuration(enemy, "slashattack");
-
-                                logic->hitBoxSystem->SpawnHitBox(
-                                    enemy,
-                                    spawnX,
-                                    spawnY,
-                                    hbWidth,
-                                    hbHeight,
-                                    static_cast<float>(attack->damage),
-                                    attack->hitbox->duration,
-                                    HitBoxComponent::Team::Enemy
-                                );
-                                if (audio)
-                                {
-                                    audio->TriggerSound("EnemyAttack");
-                                }
-
-                                // Play attack animation when slashing
-                                PlayAnimationIfAvailable(enemy, "slashattack", true);
-                            }
-                        }
+                        // Play attack animation when slashing
+                        PlayAnimationIfAvailable(agent.animation, "slashattack"_sid);
                     }
                 }
-
-                // Update hitbox lifetime and return to idle animation when not attacking
-                // (Only relevant for melee hitboxes attached to the enemy)
-                if (!isRanged && attack->hitbox->active)
-                {
-                    attack->hitboxElapsed += dt;
-                    if (attack->hitboxElapsed >= attack->hitbox->duration)
-                    {
-                        attack->hitbox->active = false;
-                        attack->hitboxElapsed = 0.0f;
-                        PlayAnimationIfAvailable(enemy, "idle");
-                    }
-                }
-                else if (isRanged && attack->attack_timer > 0.5f)
-                {
-                    // Simple fallback for ranged to go back to idle after shooting
-                    PlayAnimationIfAvailable(enemy, "idle");
-                }
-
-                // Update chase duration state
-                if (distance > (isRanged ? 4.0f : 0.5f))
-                {
-                    ai->chaseTimer += dt;
-                    if (ai->chaseTimer >= ai->maxChaseDuration)
-                    {
-                        ai->hasSeenPlayer = false;
-                        ai->chaseTimer = 0.0f;
-                    }
-                }
-                else
-                {
-                    ai->chaseTimer = 0.0f;   // reset while player is near
-                    ai->hasSeenPlayer = true;
-                }
             }
-        );
-
-        // ---------------------------------------------------------------------
-        // Root decision: if the player is near (or has been seen recently),
-        // go to the attack branch, otherwise patrol.
-        // ---------------------------------------------------------------------
-        auto root = std::make_unique<DecisionNode>(
-            [enemyID](float)
-            {
-                GOC* enemy = FACTORY->GetObjectWithId(enemyID);
-                if (!enemy)
-                    return false;
-
-                auto* ai = enemy->GetComponentType<EnemyDecisionTreeComponent>(ComponentTypeId::CT_EnemyDecisionTreeComponent);
-                if (!ai)
-                    return false;
+        }
 
-                // Refresh "seen player" state based on proximity
-                // Reduced detection radius so enemies don't aggro from across the arena
-                if (IsPlayerNear(enemy, 0.2f))
-                {
-                    ai->hasSeenPlayer = true;
-                    ai->chaseTimer = 0.0f;
-                }
+        // Update hitbox lifetime and return to idle animation when not attacking
+        // (Only relevant for melee hitboxes attached to the enemy)
+        if (!isRanged && attack->hitbox->active)
+        {
+            attack->hitboxElapsed += dt;
+            if (attack->hitboxElapsed >= attack->hitbox->duration)
+            {
+                attack->hitbox->active = false;
+                attack->hitboxElapsed = 0.0f;
+                PlayAnimationIfAvailable(agent.animation, "idle"_sid);
+            }
+        }
+        else if (isRanged && attack->attack_timer > 0.5f)
+        {
+            // Simple fallback for ranged to go back to idle after shooting
+            PlayAnimationIfAvailable(agent.animation, "idle"_sid);
+        }
 
-                return ai->hasSeenPlayer;
-            },
-            std::move(AttackLeaf),
-            std::move(patrolLeaf),
-            [](float) { /* Optional: root on-run hook (unused) */ }
-        );
+        // Update chase duration state
+        if (distance > (isRanged ? 4.0f : 0.5f))
+        {
+            ai.chaseTimer += dt;
+            if (ai.chaseTimer >= ai.maxChaseDuration)
+            {
+                ai.hasSeenPlayer = false;
+                ai.chaseTimer = 0.0f;
+            }
+        }
+        else
+        {
+            ai.chaseTimer = 0.0f;   // reset while player is near
+            ai.hasSeenPlayer = true;
+        }
+    }
 
-        return std::make_unique<DecisionTree>(std::move(root));
+    /*****************************************************************************************
+    \brief
+    Stand still and play the idle animation.
+    *****************************************************************************************/
+    void ActionIdle(const AiAgent& agent)
+    {
+        if (agent.body)
+        {
+            agent.body->velX = 0.0f;
+            agent.body->velY = 0.0f;
+        }
+        PlayAnimationIfAvailable(agent.animation, "idle"_sid);
     }
 
     /*****************************************************************************************
     \brief
-    Updates and executes the default decision tree for a given enemy.
+    Spawns the attack the enemy's tree requested this update, if any, and clears it.
 
-    \param enemy
-    Pointer to the enemy game object whose decision tree should be evaluated.
-    \param dt
-    Floating-point delta time or contextual value for logic evaluation.
+    \param agent
+    Enemy whose request should be applied.
     \param logic
-    Pointer to LogicSystem, used during attack leaf execution.
+    LogicSystem whose HitBoxSystem receives the hitbox or projectile.
 
-    \details
-    Initializes the decision tree if it does not yet exist, then runs it to determine
-    and perform the appropriate behavior.
+    \return
+    True if an attack was spawned.
+
+    \note
+    Main thread only: touches the shared hitbox pool and the audio system.
     *****************************************************************************************/
-    void UpdateDefaultEnemyTree(GOC* enemy, float dt, LogicSystem* logic)
+    bool ApplyEnemyAttackRequest(const AiAgent& agent, LogicSystem* logic)
     {
-        if (!enemy)
-            return;
+        EnemyAiState& ai = agent.ai->state;
+        if (ai.attackRequest.kind == EnemyAttackRequest::Kind::None)
+            return false;
 
-        auto* enemyDecisionTree =
-            enemy->GetComponentType<EnemyDecisionTreeComponent>(ComponentTypeId::CT_EnemyDecisionTreeComponent);
-        if (!enemyDecisionTree)
-            return;
+        const EnemyAttackRequest request = ai.attackRequest;
+        ai.attackRequest = {};
+        if (!logic || !logic->hitBoxSystem)
+            return false;
 
-        // If the enemy is dead, avoid running the decision tree so death animations are not overridden.
-        if (auto* health = enemy->GetComponentType<EnemyHealthComponent>(ComponentTypeId::CT_EnemyHealthComponent))
+        if (request.kind == EnemyAttackRequest::Kind::Projectile)
         {
-            if (health->enemyHealth <= 0)
-            {
-                if (auto* rb = enemy->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent))
-                {
-                    rb->velX = 0.0f;
-                    rb->velY = 0.0f;
-                }
-                return;
-            }
+            logic->hitBoxSystem->SpawnProjectile(
+                agent.object,
+                request.x, request.y,
+                request.dirX, request.dirY,
+                request.speed,
+                request.width, request.height,
+                request.damage,
+                request.duration,
+                HitBoxComponent::Team::Enemy
+            );
         }
-
-        // Lazy initialization of the decision tree
-        if (!enemyDecisionTree->tree)
+        else
         {
-            enemyDecisionTree->tree = CreateDefaultEnemyTree(enemy, logic);
+            logic->hitBoxSystem->SpawnHitBox(
+                agent.object,
+                request.x,
+                request.y,
+                request.width,
+                request.height,
+                request.damage,
+                request.duration,
+                HitBoxComponent::Team::Enemy
+            );
         }
 
-        // Run the tree with delta time
-        if (enemyDecisionTree->tree)
+        if (auto* audio = agent.object->GetComponentType<AudioComponent>(ComponentTypeId::CT_AudioComponent))
         {
-            enemyDecisionTree->tree->run(dt);
+            audio->TriggerSound("EnemyAttack");
         }
+        return true;
     }
 }
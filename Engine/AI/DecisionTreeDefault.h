@@ -4,43 +4,44 @@
  \author    jianwei.c (jianwei.c@digipen.edu) - Primary Author, 100%
 
  \brief     Declaration of default decision tree logic for enemy AI behavior. This module
-            defines helper functions to create and update a standard enemy decision tree
-            using basic conditions such as player proximity and health state.
+            declares the conditions and actions that the decision tree interpreter
+            (RunDecisionTree) dispatches to.
 
  \details
             The default decision tree provides a simple AI structure for enemies:
             - Detects player proximity for initiating attacks.
-            - Evaluates health to determine when to flee.
+            - Chases and attacks (melee or ranged) while the player is remembered.
             - Falls back to patrol behavior when no immediate action is required.
 
             These utilities can be reused across multiple enemy types that require
             basic reactive decision-making.
 
+            Behaviors read the player and walls from the per-frame AiBlackboard and only
+            touch their own enemy's components, so different enemies may be evaluated on
+            different threads. Attacks are recorded as an EnemyAttackRequest and spawned by
+            ApplyEnemyAttackRequest() on the main thread.
+
  \copyright
             All content 2025 DigiPen Institute of Technology Singapore.
             All rights reserved.
 *********************************************************************************************/
 #pragma once
 #include "Composition/Composition.h"
-#include "Factory/Factory.h"
 #include "Common/ComponentTypeID.h"
-#include "DecisionTree.h"
-#include "DecisionNode.h"
+#include "AI/AiBlackboard.h"
+#include "AI/DecisionTreeVM.h"
 #include "Component/EnemyDecisionTreeComponent.h"
-#include "Component/EnemyHealthComponent.h"
 #include "Component/EnemyAttackComponent.h"
 #include "Component/AudioComponent.h"
 #include "Component/TransformComponent.h"
-#include "Component/PlayerComponent.h"
 #include "Physics/Dynamics/RigidBodyComponent.h"
-#include "Physics/System/Physics.h"
 #include "Systems/LogicSystem.h"
-#include <cstdio>
-#include <random>
 namespace Framework 
 {
  class LogicSystem;
- bool IsPlayerNear(GOC* enemy, float radius = 0.1f); 
- std::unique_ptr<DecisionTree> CreateDefaultEnemyTree(GOC* enemy, LogicSystem* logic);
- void UpdateDefaultEnemyTree(GOC* enemy, float dt, LogicSystem* logic);
+ bool ConditionPlayerNear(const AiBlackboard& board, const AiAgent& agent, float radius);
+ void ActionPatrol(const AiBlackboard& board, const AiAgent& agent, float dt);
+ void ActionChaseAttack(const AiBlackboard& board, const AiAgent& agent, float dt, bool ranged);
+ void ActionIdle(const AiAgent& agent);
+ bool ApplyEnemyAttackRequest(const AiAgent& agent, LogicSystem* logic);
 }
\ No newline at end of file
@@ -0,0 +1,232 @@
+/*********************************************************************************************
+ \file      DecisionTreeLibrary.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements DecisionTreeLibrary: JSON parsing, id-to-index conversion, validation
+            and the built-in default enemy trees.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "AI/DecisionTreeLibrary.h"
+#include "Common/StringId.h"
+#include "Core/PathUtils.h"
+#include "../ThirdParty/json_dep/json.hpp"
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <unordered_map>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    using namespace Framework::literals;
+
+    namespace
+    {
+        using TreeMap = std::unordered_map<std::string, std::unique_ptr<DecisionTreeAsset>>;
+
+        TreeMap& Cache()
+        {
+            static TreeMap trees;
+            return trees;
+        }
+
+        /// Case-insensitive name lookups, e.g. "PlayerNear" or "playernear".
+        bool ParseCondition(std::string_view name, DTConditionType& out)
+        {
+            switch (StringId::Folded(name).Value())
+            {
+            case "none"_sid.Value():       out = DTConditionType::None; return true;
+            case "playernear"_sid.Value(): out = DTConditionType::PlayerNear; return true;
+            case "alwaystrue"_sid.Value(): out = DTConditionType::AlwaysTrue; return true;
+            default:                       return false;
+            }
+        }
+
+        bool ParseAction(std::string_view name, DTActionType& out)
+        {
+            switch (StringId::Folded(name).Value())
+            {
+            case "none"_sid.Value():   out = DTActionType::None; return true;
+            case "patrol"_sid.Value(): out = DTActionType::Patrol; return true;
+            case "melee"_sid.Value():  out = DTActionType::Melee; return true;
+            case "ranged"_sid.Value(): out = DTActionType::Ranged; return true;
+            case "idle"_sid.Value():   out = DTActionType::Idle; return true;
+            default:                   return false;
+            }
+        }
+
+        /// Root condition -> attack action on true, patrol on false.
+        DecisionTreeAsset MakeChaseOrPatrolTree(std::string_view treeId, DTActionType attack)
+        {
+            DecisionTreeAsset tree;
+            tree.treeId = std::string(treeId);
+            tree.rootNodeId = 0;
+
+            DecisionTreeNodeData root;
+            root.NodeId = 0;
+            root.type = DTNodeType::Condition;
+            root.conditiontype = DTConditionType::PlayerNear;
+            root.ConditionValue = 0.2f;   // small, so enemies don't aggro from across the arena
+            root.trueChild = 1;
+            root.falseChild = 2;
+
+            DecisionTreeNodeData attackLeaf;
+            attackLeaf.NodeId = 1;
+            attackLeaf.action = attack;
+
+            DecisionTreeNodeData patrolLeaf;
+            patrolLeaf.NodeId = 2;
+            patrolLeaf.action = DTActionType::Patrol;
+
+            tree.nodes = { root, attackLeaf, patrolLeaf };
+            return tree;
+        }
+    }
+
+    const DecisionTreeAsset* DecisionTreeLibrary::Get(std::string_view treeId)
+    {
+        TreeMap& trees = Cache();
+        const std::string key(treeId);
+        if (auto it = trees.find(key); it != trees.end())
+            return it->second.get();
+
+        auto asset = std::make_unique<DecisionTreeAsset>();
+        const std::filesystem::path file = ResolveDataPath(std::filesystem::path("AI") / (key + ".json"));
+        std::error_code ec;
+        if (!std::filesystem::exists(file, ec) || !LoadFromFile(file, *asset))
+        {
+            *asset = BuiltIn(treeId);
+            if (asset->nodes.empty())
+            {
+                std::cerr << "[DecisionTreeLibrary] Unknown tree '" << key << "' and no file at " << file << "\n";
+                trees.emplace(key, nullptr);
+                return nullptr;
+            }
+        }
+
+        const DecisionTreeAsset* result = asset.get();
+        trees.emplace(key, std::move(asset));
+        return result;
+    }
+
+    void DecisionTreeLibrary::Reload()
+    {
+        Cache().clear();
+    }
+
+    /*****************************************************************************************
+      \brief Read nodes, then map every id (root, children) to its position in the array.
+    *****************************************************************************************/
+    bool DecisionTreeLibrary::LoadFromFile(const std::filesystem::path& file, DecisionTreeAsset& out)
+    {
+        std::ifstream in(file);
+        if (!in.is_open())
+        {
+            std::cerr << "[DecisionTreeLibrary] Could not open " << file << "\n";
+            return false;
+        }
+
+        nlohmann::json j = nlohmann::json::parse(in, nullptr, false);
+        if (j.is_discarded() || !j.is_object() || !j.contains("nodes") || !j["nodes"].is_array())
+        {
+            std::cerr << "[DecisionTreeLibrary] " << file << " is not a decision tree (missing \"nodes\")\n";
+            return false;
+        }
+
+        DecisionTreeAsset tree;
+        tree.treeId = j.value("id", file.stem().string());
+        const int rootId = j.value("root", -1);
+
+        std::unordered_map<int, int> indexOf;
+        for (const auto& jn : j["nodes"])
+        {
+            DecisionTreeNodeData node;
+            node.NodeId = jn.value("id", static_cast<int>(tree.nodes.size()));
+            node.trueChild = jn.value("true", -1);
+            node.falseChild = jn.value("false", -1);
+            node.ConditionValue = jn.value("value", 0.0f);
+
+            const std::string type = jn.value("type", std::string("action"));
+            node.type = (StringId::Folded(type) == "condition"_sid) ? DTNodeType::Condition : DTNodeType::Action;
+
+            const std::string condition = jn.value("condition", std::string("None"));
+            const std::string action = jn.value("action", std::string("None"));
+            if (!ParseCondition(condition, node.conditiontype) || !ParseAction(action, node.action))
+            {
+                std::cerr << "[DecisionTreeLibrary] " << file << ": node " << node.NodeId
+                    << " has unknown condition '" << condition << "' or action '" << action << "'\n";
+                return false;
+            }
+
+            if (!indexOf.emplace(node.NodeId, static_cast<int>(tree.nodes.size())).second)
+            {
+                std::cerr << "[DecisionTreeLibrary] " << file << ": duplicate node id " << node.NodeId << "\n";
+                return false;
+            }
+            tree.nodes.push_back(node);
+        }
+
+        auto toIndex = [&indexOf](int id) {
+            auto it = indexOf.find(id);
+            return it == indexOf.end() ? -1 : it->second;
+        };
+        tree.rootNodeId = toIndex(rootId);
+        for (std::size_t i = 0; i < tree.nodes.size(); ++i)
+        {
+            DecisionTreeNodeData& node = tree.nodes[i];
+            node.NodeId = static_cast<int>(i);
+            node.trueChild = toIndex(node.trueChild);
+            node.falseChild = toIndex(node.falseChild);
+        }
+
+        if (!Validate(tree))
+        {
+            std::cerr << "[DecisionTreeLibrary] " << file << " failed validation\n";
+            return false;
+        }
+
+        out = std::move(tree);
+        return true;
+    }
+
+    DecisionTreeAsset DecisionTreeLibrary::BuiltIn(std::string_view treeId)
+    {
+        if (treeId == kMeleeTree)
+            return MakeChaseOrPatrolTree(treeId, DTActionType::Melee);
+        if (treeId == kRangedTree)
+            return MakeChaseOrPatrolTree(treeId, DTActionType::Ranged);
+        return {};
+    }
+
+    /*****************************************************************************************
+      \brief A tree is valid when the root exists, every child is -1 or in range, and every
+             condition node can reach an action (a child or its own fallback action).
+             Cycles are allowed by the format; the interpreter bounds its walk instead.
+    *****************************************************************************************/
+    bool DecisionTreeLibrary::Validate(const DecisionTreeAsset& asset)
+    {
+        const int count = static_cast<int>(asset.nodes.size());
+        if (asset.rootNodeId < 0 || asset.rootNodeId >= count)
+            return false;
+
+        for (int i = 0; i < count; ++i)
+        {
+            const DecisionTreeNodeData& node = asset.nodes[static_cast<std::size_t>(i)];
+            if (node.NodeId != i)
+                return false;
+            if (node.trueChild < -1 || node.trueChild >= count || node.falseChild < -1 || node.falseChild >= count)
+                return false;
+            if (node.type == DTNodeType::Condition && node.action == DTActionType::None &&
+                (node.trueChild < 0 || node.falseChild < 0))
+                return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,66 @@
+/*********************************************************************************************
+ \file      DecisionTreeLibrary.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Loads and shares DecisionTreeAssets by id.
+ \details   Get("enemy_melee") returns the tree from Data_Files/AI/enemy_melee.json, loading
+            it on first use. Built-in copies of the default trees ("enemy_melee" and
+            "enemy_ranged") are used when the file is missing or invalid, so enemies always
+            have a tree. Every enemy with the same tree id shares one asset.
+
+            JSON layout:
+            \code
+            { "id": "enemy_melee", "root": 0,
+              "nodes": [
+                { "id": 0, "type": "condition", "condition": "PlayerNear", "value": 0.2,
+                  "true": 1, "false": 2 },
+                { "id": 1, "type": "action", "action": "Melee" },
+                { "id": 2, "type": "action", "action": "Patrol" } ] }
+            \endcode
+            Loading replaces node ids with array indices; a valid asset therefore has
+            NodeId == index and children that are -1 or in range.
+
+            Get() and Reload() are main-thread only. The returned pointers stay valid until
+            Reload().
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "AI/DecisionTreeAsset.h"
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class DecisionTreeLibrary
+      \brief Static cache of shared decision tree assets.
+    *****************************************************************************************/
+    class DecisionTreeLibrary
+    {
+    public:
+        static constexpr std::string_view kMeleeTree = "enemy_melee";
+        static constexpr std::string_view kRangedTree = "enemy_ranged";
+
+        /// Shared tree for \a treeId; null only if the id is unknown and has no file.
+        static const DecisionTreeAsset* Get(std::string_view treeId);
+
+        /// Drop every cached tree so the next Get() reads the files again.
+        static void Reload();
+
+        /**
+         * \brief Parse a tree file and convert node ids to indices.
+         * \return True if \a out holds a valid tree; errors are logged with the file name.
+         */
+        static bool LoadFromFile(const std::filesystem::path& file, DecisionTreeAsset& out);
+
+        /// Built-in default tree for \a treeId (empty asset if there is none).
+        static DecisionTreeAsset BuiltIn(std::string_view treeId);
+
+        /// Check child indices and node kinds of an index-based asset.
+        static bool Validate(const DecisionTreeAsset& asset);
+    };
+}
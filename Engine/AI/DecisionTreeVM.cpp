@@ -0,0 +1,82 @@
+/*********************************************************************************************
+ \file      DecisionTreeVM.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements RunDecisionTree(), the switch-dispatched walk over a flat
+            DecisionTreeAsset.
+ \details   A condition node continues into the chosen child, or runs its own action when
+            that child is missing. The walk stops after one action or after visiting as many
+            nodes as the tree has, so a malformed cycle can never hang an update.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "AI/DecisionTreeVM.h"
+#include "AI/DecisionTreeDefault.h"
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        bool EvaluateCondition(const DecisionTreeNodeData& node, const AiBlackboard& board, const AiAgent& agent)
+        {
+            switch (node.conditiontype)
+            {
+            case DTConditionType::PlayerNear: return ConditionPlayerNear(board, agent, node.ConditionValue);
+            case DTConditionType::AlwaysTrue: return true;
+            case DTConditionType::None:       return true;
+            }
+            return false;
+        }
+
+        void RunAction(DTActionType action, const AiBlackboard& board, const AiAgent& agent, float dt)
+        {
+            switch (action)
+            {
+            case DTActionType::Patrol: ActionPatrol(board, agent, dt); return;
+            case DTActionType::Melee:  ActionChaseAttack(board, agent, dt, false); return;
+            case DTActionType::Ranged: ActionChaseAttack(board, agent, dt, true); return;
+            case DTActionType::Idle:   ActionIdle(agent); return;
+            case DTActionType::None:   return;
+            }
+        }
+    }
+
+    void SeedEnemyAiState(EnemyAiState& state, std::uint32_t seed)
+    {
+        state.rngState = 0x9E3779B9u ^ (seed * 2654435761u);
+        if (state.rngState == 0u)
+            state.rngState = 0x9E3779B9u;
+    }
+
+    void RunDecisionTree(const DecisionTreeAsset& tree, const AiBlackboard& board,
+        const AiAgent& agent, float dt)
+    {
+        const int count = static_cast<int>(tree.nodes.size());
+        int index = tree.rootNodeId;
+
+        for (int steps = 0; steps < count && index >= 0 && index < count; ++steps)
+        {
+            const DecisionTreeNodeData& node = tree.nodes[static_cast<std::size_t>(index)];
+            if (node.type == DTNodeType::Action)
+            {
+                RunAction(node.action, board, agent, dt);
+                return;
+            }
+
+            const int next = EvaluateCondition(node, board, agent) ? node.trueChild : node.falseChild;
+            if (next < 0)
+            {
+                RunAction(node.action, board, agent, dt);
+                return;
+            }
+            index = next;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*********************************************************************************************
+ \file      DecisionTreeVM.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Interpreter for flat DecisionTreeAsset node arrays, plus the per-enemy POD state
+            it reads and writes.
+ \details   RunDecisionTree() walks the node array from the root. Condition and action nodes
+            dispatch through a switch on DTConditionType / DTActionType to the behaviours in
+            DecisionTreeDefault.cpp. There are no per-enemy allocations and no std::function
+            calls: an enemy is a pointer to a shared asset plus one EnemyAiState.
+
+            The interpreter only writes the enemy's own components and state, so different
+            enemies may be run on different threads. Attacks are recorded in
+            EnemyAiState::attackRequest and spawned later on the main thread.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "AI/DecisionTreeAsset.h"
+#include <cstdint>
+#include <type_traits>
+
+namespace Framework
+{
+    class AiBlackboard;
+    struct AiAgent;
+
+    enum class Facing { LEFT, RIGHT };
+
+    /*****************************************************************************************
+      \struct EnemyAttackRequest
+      \brief  Attack recorded by the decision tree and spawned later by AiSystem.
+
+      Trees may run on worker threads, where spawning hitboxes or playing sounds is not
+      safe. The tree fills this in instead, and AiSystem applies it on the main thread
+      once the whole batch has finished.
+    *****************************************************************************************/
+    struct EnemyAttackRequest
+    {
+        enum class Kind { None, Melee, Projectile };
+
+        Kind  kind = Kind::None;
+        float x = 0.0f;         ///< Spawn centre
+        float y = 0.0f;
+        float dirX = 0.0f;      ///< Projectile direction (unit length)
+        float dirY = 0.0f;
+        float speed = 0.0f;     ///< Projectile speed
+        float width = 0.0f;
+        float height = 0.0f;
+        float damage = 0.0f;
+        float duration = 0.0f;
+    };
+
+    /*****************************************************************************************
+      \struct EnemyAiState
+      \brief  Everything one enemy's tree remembers between updates.
+    *****************************************************************************************/
+    struct EnemyAiState
+    {
+        float dir = 1.0f;                    ///< Patrol direction (1.0 for right, -1.0 for left).
+        float pauseTimer = 0.0f;             ///< Pause left before patrol turns around.
+        float chaseTimer = 0.0f;             ///< Time spent chasing while the player is out of range.
+        float maxChaseDuration = 3.0f;       ///< Chase time before the enemy forgets the player.
+        float retreatTimer = 0.0f;           ///< Ranged retreat left after a shot.
+        float patrolOriginX = 0.0f;
+        float patrolOriginY = 0.0f;
+        float prevX = 0.0f;
+        bool  patrolOriginSet = false;
+        bool  hasSeenPlayer = false;         ///< Tracks whether the enemy has detected the player.
+        Facing facing = Facing::RIGHT;
+        float accumulatedDt = 0.0f;          ///< Time since the last run (AiLodScheduler skips far enemies).
+        std::uint32_t rngState = 0x9E3779B9u;  ///< Per-enemy xorshift state, safe on worker threads.
+        EnemyAttackRequest attackRequest;       ///< Pending attack for AiSystem to spawn this frame.
+    };
+    static_assert(std::is_trivially_copyable_v<EnemyAiState>, "EnemyAiState must stay a POD");
+
+    /*****************************************************************************************
+      \brief Seed \a state's random stream from an object id (never zero).
+    *****************************************************************************************/
+    void SeedEnemyAiState(EnemyAiState& state, std::uint32_t seed);
+
+    /*****************************************************************************************
+      \brief Evaluate \a tree for one enemy.
+      \param tree  Shared asset with index-based children (see DecisionTreeLibrary).
+      \param board Blackboard for the current frame.
+      \param agent Enemy and its cached component pointers.
+      \param dt    Delta time in seconds.
+    *****************************************************************************************/
+    void RunDecisionTree(const DecisionTreeAsset& tree, const AiBlackboard& board,
+        const AiAgent& agent, float dt);
+}
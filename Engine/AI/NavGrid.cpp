@@ -0,0 +1,311 @@
+/*********************************************************************************************
+ \file      NavGrid.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements NavGrid: wall rasterisation, the BFS flow field and steering lookups.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "AI/NavGrid.h"
+#include <algorithm>
+#include <cmath>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        /// Flow values 0-7 index kNeighbourX/Y; the others are special.
+        constexpr std::uint8_t kFlowAtTarget = 8;
+        constexpr std::uint8_t kFlowNone = 0xFF;
+
+        /// Orthogonal neighbours first, so ties prefer straight moves.
+        constexpr int kNeighbourX[8] = { 1, -1, 0, 0, 1, -1, 1, -1 };
+        constexpr int kNeighbourY[8] = { 0, 0, 1, -1, 1, 1, -1, -1 };
+
+        /// How many rings of cells around a blocked target are searched for a walkable seed.
+        constexpr int kMaxSeedRing = 4;
+    }
+
+    /*****************************************************************************************
+      \brief Bound the walls plus margin, pick a cell size under maxCells, then mark every
+             cell whose centre lies inside an inflated wall.
+    *****************************************************************************************/
+    void NavGrid::Build(std::span<const AABB> walls, const Settings& settings)
+    {
+        Clear();
+        if (walls.empty())
+            return;
+
+        float minX = walls[0].min.getX(), minY = walls[0].min.getY();
+        float maxX = walls[0].max.getX(), maxY = walls[0].max.getY();
+        for (const AABB& wall : walls)
+        {
+            minX = std::min(minX, wall.min.getX());
+            minY = std::min(minY, wall.min.getY());
+            maxX = std::max(maxX, wall.max.getX());
+            maxY = std::max(maxY, wall.max.getY());
+        }
+        minX -= settings.margin;
+        minY -= settings.margin;
+        maxX += settings.margin;
+        maxY += settings.margin;
+
+        const float width = maxX - minX;
+        const float height = maxY - minY;
+        const float maxCells = static_cast<float>(std::max<std::size_t>(settings.maxCells, 1));
+        cellSize = std::max({ settings.cellSize, std::sqrt(width * height / maxCells), 1e-3f });
+        columns = std::max(1, static_cast<int>(std::ceil(width / cellSize)));
+        rows = std::max(1, static_cast<int>(std::ceil(height / cellSize)));
+        while (static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows) > settings.maxCells && settings.maxCells > 0)
+        {
+            cellSize *= 1.1f;
+            columns = std::max(1, static_cast<int>(std::ceil(width / cellSize)));
+            rows = std::max(1, static_cast<int>(std::ceil(height / cellSize)));
+        }
+        originX = minX;
+        originY = minY;
+
+        const std::size_t count = static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows);
+        blocked.assign(count, 0);
+        steps.assign(count, kUnreachable);
+        flow.assign(count, kFlowNone);
+        frontier.reserve(count);
+
+        // A cell is blocked when its centre is inside a wall grown by the agent radius.
+        const float r = settings.agentRadius;
+        for (const AABB& wall : walls)
+        {
+            const float x0 = wall.min.getX() - r, x1 = wall.max.getX() + r;
+            const float y0 = wall.min.getY() - r, y1 = wall.max.getY() + r;
+            const int c0 = std::max(0, static_cast<int>(std::ceil((x0 - originX) / cellSize - 0.5f)));
+            const int c1 = std::min(columns - 1, static_cast<int>(std::floor((x1 - originX) / cellSize - 0.5f)));
+            const int r0 = std::max(0, static_cast<int>(std::ceil((y0 - originY) / cellSize - 0.5f)));
+            const int r1 = std::min(rows - 1, static_cast<int>(std::floor((y1 - originY) / cellSize - 0.5f)));
+            for (int row = r0; row <= r1; ++row)
+                for (int col = c0; col <= c1; ++col)
+                    blocked[static_cast<std::size_t>(row) * columns + col] = 1;
+        }
+        blockedCount = static_cast<std::size_t>(std::count(blocked.begin(), blocked.end(), std::uint8_t{ 1 }));
+    }
+
+    void NavGrid::Clear()
+    {
+        columns = rows = 0;
+        blockedCount = reachableCount = 0;
+        blocked.clear();
+        steps.clear();
+        flow.clear();
+        frontier.clear();
+        requestedCell = -1;
+        targetCell = -1;
+    }
+
+    int NavGrid::CellAt(float x, float y) const
+    {
+        if (blocked.empty())
+            return -1;
+        const int col = static_cast<int>(std::floor((x - originX) / cellSize));
+        const int row = static_cast<int>(std::floor((y - originY) / cellSize));
+        if (col < 0 || row < 0 || col >= columns || row >= rows)
+            return -1;
+        return row * columns + col;
+    }
+
+    /*****************************************************************************************
+      \brief Walkable cell nearest to (x, y) in the first ring around \a cell that has one.
+             Returns -1 when none is found within kMaxSeedRing rings.
+    *****************************************************************************************/
+    int NavGrid::NearestWalkableCell(int cell, float x, float y) const
+    {
+        const int col = cell % columns;
+        const int row = cell / columns;
+        for (int ring = 1; ring <= kMaxSeedRing; ++ring)
+        {
+            int best = -1;
+            float bestDistSq = 0.0f;
+            for (int r = row - ring; r <= row + ring; ++r)
+            {
+                if (r < 0 || r >= rows)
+                    continue;
+                // Interior rows only contribute their two edge cells.
+                const int step = (r == row - ring || r == row + ring) ? 1 : 2 * ring;
+                for (int c = col - ring; c <= col + ring; c += step)
+                {
+                    if (c < 0 || c >= columns)
+                        continue;
+                    const int index = r * columns + c;
+                    if (blocked[static_cast<std::size_t>(index)])
+                        continue;
+                    const float dx = originX + (static_cast<float>(c) + 0.5f) * cellSize - x;
+                    const float dy = originY + (static_cast<float>(r) + 0.5f) * cellSize - y;
+                    const float distSq = dx * dx + dy * dy;
+                    if (best < 0 || distSq < bestDistSq)
+                    {
+                        best = index;
+                        bestDistSq = distSq;
+                    }
+                }
+            }
+            if (best >= 0)
+                return best;
+        }
+        return -1;
+    }
+
+    /*****************************************************************************************
+      \brief 4-connected BFS from the target, then one pass choosing each cell's downhill
+             neighbour among all 8. Skipped while the target stays in the same cell.
+             A target inside an inflated wall (the player against a wall) seeds the search
+             from the nearest walkable cell instead.
+    *****************************************************************************************/
+    bool NavGrid::UpdateFlowField(float x, float y)
+    {
+        targetX = x;
+        targetY = y;
+
+        const int requested = CellAt(x, y);
+        if (requested >= 0 && requested == requestedCell && targetCell >= 0)
+            return false;
+
+        requestedCell = requested;
+        targetCell = -1;
+        reachableCount = 0;
+        if (requested < 0)
+            return false;
+
+        const int cell = blocked[static_cast<std::size_t>(requested)]
+            ? NearestWalkableCell(requested, x, y) : requested;
+        if (cell < 0)
+            return false;
+
+        std::fill(steps.begin(), steps.end(), kUnreachable);
+        frontier.clear();
+        steps[static_cast<std::size_t>(cell)] = 0;
+        frontier.push_back(cell);
+
+        for (std::size_t head = 0; head < frontier.size(); ++head)
+        {
+            const int current = frontier[head];
+            const int col = current % columns;
+            const int row = current / columns;
+            const std::uint32_t next = steps[static_cast<std::size_t>(current)] + 1;
+            for (int n = 0; n < 4; ++n)
+            {
+                const int nc = col + kNeighbourX[n];
+                const int nr = row + kNeighbourY[n];
+                if (nc < 0 || nr < 0 || nc >= columns || nr >= rows)
+                    continue;
+                const std::size_t index = static_cast<std::size_t>(nr) * columns + nc;
+                if (blocked[index] || steps[index] != kUnreachable)
+                    continue;
+                steps[index] = next;
+                frontier.push_back(static_cast<int>(index));
+            }
+        }
+        reachableCount = frontier.size();
+
+        std::fill(flow.begin(), flow.end(), kFlowNone);
+        flow[static_cast<std::size_t>(cell)] = kFlowAtTarget;
+        for (std::size_t i = 1; i < frontier.size(); ++i)
+        {
+            const int current = frontier[i];
+            const int col = current % columns;
+            const int row = current / columns;
+            std::uint32_t best = steps[static_cast<std::size_t>(current)];
+            std::uint8_t bestDir = kFlowNone;
+            for (int n = 0; n < 8; ++n)
+            {
+                const int nc = col + kNeighbourX[n];
+                const int nr = row + kNeighbourY[n];
+                if (nc < 0 || nr < 0 || nc >= columns || nr >= rows)
+                    continue;
+                // Diagonals need both orthogonal cells free, or the agent would clip a corner.
+                if (n >= 4 && (blocked[static_cast<std::size_t>(row) * columns + nc] ||
+                               blocked[static_cast<std::size_t>(nr) * columns + col]))
+                    continue;
+                const std::uint32_t s = steps[static_cast<std::size_t>(nr) * columns + nc];
+                if (s < best)
+                {
+                    best = s;
+                    bestDir = static_cast<std::uint8_t>(n);
+                }
+            }
+            flow[static_cast<std::size_t>(current)] = bestDir;
+        }
+
+        targetCell = cell;
+        return true;
+    }
+
+    bool NavGrid::Steer(float x, float y, float& dirX, float& dirY) const
+    {
+        if (targetCell < 0)
+            return false;
+        const int cell = CellAt(x, y);
+        if (cell < 0)
+            return false;
+
+        const std::uint8_t f = flow[static_cast<std::size_t>(cell)];
+        float toX = 0.0f;
+        float toY = 0.0f;
+        if (f == kFlowAtTarget)
+        {
+            toX = targetX - x;
+            toY = targetY - y;
+        }
+        else if (f < 8)
+        {
+            // Head for the next cell's centre rather than along the grid axis, so agents
+            // that sit off-centre are pulled back onto the path.
+            const int col = cell % columns + kNeighbourX[f];
+            const int row = cell / columns + kNeighbourY[f];
+            toX = originX + (static_cast<float>(col) + 0.5f) * cellSize - x;
+            toY = originY + (static_cast<float>(row) + 0.5f) * cellSize - y;
+        }
+        else
+        {
+            return false;
+        }
+
+        const float length = std::sqrt(toX * toX + toY * toY);
+        if (length > 1e-5f)
+        {
+            dirX = toX / length;
+            dirY = toY / length;
+        }
+        else
+        {
+            dirX = dirY = 0.0f;
+        }
+        return true;
+    }
+
+    bool NavGrid::IsWalkable(float x, float y) const
+    {
+        const int cell = CellAt(x, y);
+        return cell >= 0 && !blocked[static_cast<std::size_t>(cell)];
+    }
+
+    void NavGrid::Bounds(float& minX, float& minY, float& maxX, float& maxY) const
+    {
+        minX = originX;
+        minY = originY;
+        maxX = originX + static_cast<float>(columns) * cellSize;
+        maxY = originY + static_cast<float>(rows) * cellSize;
+    }
+
+    std::uint32_t NavGrid::StepsToTarget(float x, float y) const
+    {
+        const int cell = CellAt(x, y);
+        if (targetCell < 0 || cell < 0)
+            return kUnreachable;
+        return steps[static_cast<std::size_t>(cell)];
+    }
+}
@@ -0,0 +1,117 @@
+/*********************************************************************************************
+ \file      NavGrid.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Walkable grid over the level's static walls, with one shared flow field toward
+            a target (the player).
+ \details   The grid is built once per level from the wall AABBs. Each wall is inflated by
+            the agent radius, so a cell centre that is walkable has room for an enemy.
+
+            The flow field is a breadth-first search outward from the target cell. Each
+            reachable cell then stores which of its 8 neighbours is one step closer. Every
+            chasing enemy shares this one field, so the cost per frame is one BFS plus one
+            table lookup per enemy. The search is skipped while the target stays in the
+            same cell. Because walls are inflated, a player standing against one is often
+            in a blocked cell; the search then starts from the nearest walkable cell.
+
+            Diagonal steps are only taken when both adjacent orthogonal cells are walkable,
+            so enemies never cut a wall corner.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "Physics/Collision/Collision.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class NavGrid
+      \brief Static walkability grid plus a cached BFS flow field.
+    *****************************************************************************************/
+    class NavGrid
+    {
+    public:
+        struct Settings
+        {
+            float       cellSize = 0.1f;      ///< World units per cell
+            float       agentRadius = 0.1f;   ///< Walls are inflated by this much
+            float       margin = 1.0f;        ///< Walkable border added around the walls
+            std::size_t maxCells = 256 * 256; ///< Cell size grows to stay under this
+        };
+
+        /// Replace the grid with one covering \a walls. An empty span clears the grid.
+        void Build(std::span<const AABB> walls, const Settings& settings);
+
+        void Clear();
+
+        bool IsBuilt() const { return !blocked.empty(); }
+
+        /*************************************************************************************
+          \brief Point the flow field at (x, y).
+          \return True if the BFS ran, false if the cached field was reused or the target
+                  is off the grid or walled in with no walkable cell nearby (the field is
+                  then empty). A target inside an inflated wall seeds from the nearest
+                  walkable cell.
+        *************************************************************************************/
+        bool UpdateFlowField(float targetX, float targetY);
+
+        /// Force the next UpdateFlowField() to search even if the target cell is unchanged.
+        void InvalidateFlowField() { targetCell = -1; }
+
+        /// True when the last UpdateFlowField() produced a usable field.
+        bool HasFlowField() const { return targetCell >= 0; }
+
+        /*************************************************************************************
+          \brief Unit direction for an agent at (x, y) to follow toward the target.
+          \return False when (x, y) is off the grid or cannot reach the target. The outputs
+                  are then left untouched, so callers can pre-fill the straight-line heading.
+        *************************************************************************************/
+        bool Steer(float x, float y, float& dirX, float& dirY) const;
+
+        /// BFS step count from (x, y) to the target, or kUnreachable.
+        std::uint32_t StepsToTarget(float x, float y) const;
+
+        static constexpr std::uint32_t kUnreachable = 0xFFFFFFFFu;
+
+        /// True if (x, y) is on the grid and outside every inflated wall.
+        bool IsWalkable(float x, float y) const;
+
+        /// World-space area covered by the grid.
+        void Bounds(float& minX, float& minY, float& maxX, float& maxY) const;
+
+        int Columns() const { return columns; }
+        int Rows() const { return rows; }
+        float CellSize() const { return cellSize; }
+        std::size_t CellCount() const { return blocked.size(); }
+        std::size_t BlockedCount() const { return blockedCount; }
+        std::size_t ReachableCount() const { return reachableCount; }
+
+    private:
+        int CellAt(float x, float y) const;   ///< -1 when off the grid
+        int NearestWalkableCell(int cell, float x, float y) const;
+
+        float originX = 0.0f;
+        float originY = 0.0f;
+        float cellSize = 0.1f;
+        int   columns = 0;
+        int   rows = 0;
+        std::size_t blockedCount = 0;
+        std::size_t reachableCount = 0;
+
+        std::vector<std::uint8_t>  blocked;    ///< 1 = inside an (inflated) wall
+        std::vector<std::uint32_t> steps;      ///< BFS distance in 4-connected steps
+        std::vector<std::uint8_t>  flow;       ///< Neighbour index to step to, see NavGrid.cpp
+        std::vector<int>           frontier;   ///< BFS queue, reused between searches
+
+        int   requestedCell = -1;   ///< Cell the target is in (may be blocked)
+        int   targetCell = -1;      ///< Cell the BFS started from
+        float targetX = 0.0f;
+        float targetY = 0.0f;
+    };
+}
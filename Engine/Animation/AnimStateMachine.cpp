@@ -0,0 +1,155 @@
+/*********************************************************************************************
+ \file      AnimStateMachine.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements AnimStateMachineAsset::Compile() and the per-object instance.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Animation/AnimStateMachine.h"
+#include "Component/SpriteAnimationComponent.h"
+#include <iostream>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        /// Shared by every asset, so an asset reloaded in place never reuses a revision.
+        std::uint32_t gNextRevision = 1;
+    }
+
+    /*****************************************************************************************
+      \brief Check the indices, then resolve every (state, mask) pair by walking the
+             transitions in order. A mask with no matching transition stays put.
+    *****************************************************************************************/
+    bool AnimStateMachineAsset::Compile()
+    {
+        // Bumped even on failure so instances bound to the old table rebind (and find it empty).
+        revision = gNextRevision++;
+        table.clear();
+        const int stateCount = static_cast<int>(states.size());
+        if (stateCount == 0 || states.size() > kMaxStates || signals.size() > kMaxSignals)
+        {
+            std::cerr << "[AnimStateMachine] '" << id << "' needs 1-" << kMaxStates << " states and at most "
+                << kMaxSignals << " signals\n";
+            return false;
+        }
+        if (initialState < 0 || initialState >= stateCount)
+        {
+            std::cerr << "[AnimStateMachine] '" << id << "' has no valid initial state\n";
+            return false;
+        }
+
+        signalCount = static_cast<std::uint32_t>(signals.size());
+        const std::uint32_t maskCount = 1u << signalCount;
+        for (const Transition& transition : transitions)
+        {
+            if (transition.from < -1 || transition.from >= stateCount || transition.to < 0 || transition.to >= stateCount ||
+                ((transition.when | transition.unless) & ~(maskCount - 1u)) != 0)
+            {
+                std::cerr << "[AnimStateMachine] '" << id << "' has a transition with an invalid state or signal\n";
+                return false;
+            }
+        }
+
+        for (State& state : states)
+        {
+            state.nameId = StringId::InternFolded(state.name);
+            state.clipId = StringId::InternFolded(state.clip.empty() ? state.name : state.clip);
+        }
+
+        table.resize(static_cast<std::size_t>(stateCount) * maskCount);
+        for (int from = 0; from < stateCount; ++from)
+        {
+            for (std::uint32_t mask = 0; mask < maskCount; ++mask)
+            {
+                int next = from;
+                for (const Transition& transition : transitions)
+                {
+                    if ((transition.from == -1 || transition.from == from) &&
+                        (mask & transition.when) == transition.when &&
+                        (mask & transition.unless) == 0)
+                    {
+                        next = transition.to;
+                        break;
+                    }
+                }
+                table[(static_cast<std::size_t>(from) << signalCount) | mask] = static_cast<std::uint8_t>(next);
+            }
+        }
+
+        return true;
+    }
+
+    int AnimStateMachineAsset::FindState(StringId foldedName) const
+    {
+        for (std::size_t i = 0; i < states.size(); ++i)
+        {
+            if (states[i].nameId == foldedName)
+                return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    std::uint32_t AnimStateMachineAsset::SignalBit(StringId foldedName) const
+    {
+        for (std::size_t i = 0; i < signals.size(); ++i)
+        {
+            if (StringId::Folded(signals[i]) == foldedName)
+                return 1u << i;
+        }
+        return 0;
+    }
+
+    /*****************************************************************************************
+      \brief The only name lookups of the machine: one FindAnimationIndex per state.
+    *****************************************************************************************/
+    void AnimStateMachineInstance::Bind(const AnimStateMachineAsset* machine, const SpriteAnimationComponent& anim)
+    {
+        Reset();
+        if (!machine || !machine->IsCompiled())
+            return;
+
+        asset = machine;
+        revision = machine->Revision();
+        clipCount = anim.animations.size();
+        clipForState.resize(machine->states.size());
+        for (std::size_t i = 0; i < machine->states.size(); ++i)
+            clipForState[i] = anim.FindAnimationIndex(machine->states[i].clipId);
+        state = machine->initialState;
+    }
+
+    bool AnimStateMachineInstance::IsBoundTo(const AnimStateMachineAsset* machine, const SpriteAnimationComponent& anim) const
+    {
+        return asset && asset == machine && revision == machine->Revision() && clipCount == anim.animations.size();
+    }
+
+    int AnimStateMachineInstance::ClipForState(int index) const
+    {
+        return index >= 0 && index < static_cast<int>(clipForState.size())
+            ? clipForState[static_cast<std::size_t>(index)]
+            : -1;
+    }
+
+    int AnimStateMachineInstance::Step(SpriteAnimationComponent& anim, std::uint32_t signalBits)
+    {
+        if (!asset || revision != asset->Revision())
+            return -1;
+
+        lastSignals = signalBits;
+        state = asset->Next(state, signalBits);
+
+        // Also re-applies the clip if something else (AI, the editor) switched it.
+        const int clip = clipForState[static_cast<std::size_t>(state)];
+        if (clip >= 0 && clip != anim.ActiveAnimationIndex())
+            anim.SetActiveAnimation(clip);
+        return state;
+    }
+}
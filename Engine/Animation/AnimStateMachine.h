@@ -0,0 +1,122 @@
+/*********************************************************************************************
+ \file      AnimStateMachine.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Data-driven animation state machine: named states bound to sprite-sheet clips,
+            transitions guarded by boolean signals, compiled into a flat transition table.
+ \details   Gameplay code sets one bit per signal (e.g. "dead", "moving") each frame and
+            asks the machine for the next state. Transitions are tried in file order, and
+            the first one whose "when" signals are all set and whose "unless" signals are
+            all clear wins. A transition from -1 applies to every state.
+
+            Compile() evaluates that rule for every (state, signal mask) pair once, so a
+            step is a single table read: table[(state << signalCount) | mask]. Signals are
+            capped at kMaxSignals, which keeps the table at most states x 256 bytes.
+
+            One asset is shared by every object that names it (AnimStateMachineLibrary).
+            Per-object data lives in AnimStateMachineInstance, which also resolves each
+            state's clip name to an index into the object's animations[] once, when it is
+            bound, instead of on every switch.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "Common/StringId.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Framework
+{
+    class SpriteAnimationComponent;
+
+    /*****************************************************************************************
+      \struct AnimStateMachineAsset
+      \brief  Shared description of a state machine plus its compiled transition table.
+    *****************************************************************************************/
+    struct AnimStateMachineAsset
+    {
+        static constexpr std::size_t kMaxSignals = 8;
+        static constexpr std::size_t kMaxStates = 255;
+
+        struct State
+        {
+            std::string name;
+            std::string clip;          ///< Name of the SpriteAnimationComponent clip to play
+            StringId    nameId;        ///< Folded name / clip, filled by Compile()
+            StringId    clipId;
+        };
+
+        struct Transition
+        {
+            int           from = -1;   ///< State index, or -1 for any state
+            int           to = 0;
+            std::uint32_t when = 0;    ///< Signal bits that must be set
+            std::uint32_t unless = 0;  ///< Signal bits that must be clear
+        };
+
+        std::string              id;
+        std::vector<std::string> signals;
+        std::vector<State>       states;
+        std::vector<Transition>  transitions;
+        int                      initialState = 0;
+
+        /// Rebuild ids and the transition table. Call after any edit; returns false if invalid.
+        bool Compile();
+
+        /// State after \a state sees \a signalBits. Only valid after a successful Compile().
+        int Next(int state, std::uint32_t signalBits) const
+        {
+            const std::uint32_t mask = signalBits & ((1u << signalCount) - 1u);
+            return table[(static_cast<std::size_t>(state) << signalCount) | mask];
+        }
+
+        int           FindState(StringId foldedName) const;    ///< -1 if unknown; needs Compile()
+        std::uint32_t SignalBit(StringId foldedName) const;   ///< 0 if the signal is unknown
+        bool          IsCompiled() const { return !table.empty(); }
+        std::uint32_t Revision() const { return revision; }   ///< Changes on every Compile()
+
+    private:
+        std::vector<std::uint8_t> table;
+        std::uint32_t             signalCount = 0;
+        std::uint32_t             revision = 0;
+    };
+
+    /*****************************************************************************************
+      \class AnimStateMachineInstance
+      \brief Current state of one object plus its state -> clip index binding.
+    *****************************************************************************************/
+    class AnimStateMachineInstance
+    {
+    public:
+        /// Bind to \a asset for \a anim's clips and enter the initial state.
+        void Bind(const AnimStateMachineAsset* asset, const SpriteAnimationComponent& anim);
+
+        /// True if bound to \a asset at its current revision for \a anim's clip list.
+        bool IsBoundTo(const AnimStateMachineAsset* asset, const SpriteAnimationComponent& anim) const;
+
+        /*************************************************************************************
+          \brief Advance one step and make sure \a anim plays the current state's clip.
+          \return The (possibly unchanged) state index, or -1 when unbound.
+        *************************************************************************************/
+        int Step(SpriteAnimationComponent& anim, std::uint32_t signalBits);
+
+        void Reset() { *this = AnimStateMachineInstance{}; }
+
+        const AnimStateMachineAsset* Asset() const { return asset; }
+        int           State() const { return state; }
+        int           ClipForState(int index) const;   ///< -1 if the object has no such clip
+        std::uint32_t LastSignals() const { return lastSignals; }
+
+    private:
+        const AnimStateMachineAsset* asset = nullptr;
+        std::uint32_t                revision = 0;
+        std::size_t                  clipCount = 0;
+        std::vector<int>             clipForState;
+        int                          state = -1;
+        std::uint32_t                lastSignals = 0;
+    };
+}
@@ -0,0 +1,284 @@
+/*********************************************************************************************
+ \file      AnimStateMachineLibrary.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements AnimStateMachineLibrary: JSON load/save, name-to-index conversion and
+            the built-in player machine.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Animation/AnimStateMachineLibrary.h"
+#include "Core/PathUtils.h"
+#include "../ThirdParty/json_dep/json.hpp"
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <unordered_map>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        using MachineMap = std::unordered_map<std::string, std::unique_ptr<AnimStateMachineAsset>>;
+
+        MachineMap& Cache()
+        {
+            static MachineMap machines;
+            return machines;
+        }
+
+        /// File (or built-in) contents for \a key; false if there is neither. The id is
+        /// always \a key so Save() writes back to the file the machine came from.
+        bool LoadOrBuiltIn(const std::string& key, AnimStateMachineAsset& out)
+        {
+            const std::filesystem::path file = AnimStateMachineLibrary::PathFor(key);
+            std::error_code ec;
+            if (!std::filesystem::exists(file, ec) || !AnimStateMachineLibrary::LoadFromFile(file, out))
+                out = AnimStateMachineLibrary::BuiltIn(key);
+            out.id = key;
+            return out.IsCompiled();
+        }
+
+        /// The rules LogicSystem used to hard-code: death, then knockback, then the attack
+        /// being played, then run/idle from movement.
+        AnimStateMachineAsset MakePlayerMachine()
+        {
+            AnimStateMachineAsset machine;
+            machine.id = std::string(AnimStateMachineLibrary::kPlayerMachine);
+            machine.signals = { "dead", "knockback", "attack1", "attack2", "attack3", "throw", "moving" };
+            for (const char* name : { "idle", "run", "attack1", "attack2", "attack3", "throw", "knockback", "death" })
+                machine.states.push_back({ name, name, {}, {} });
+            machine.initialState = 0;
+
+            // State and signal indices follow the two lists above.
+            auto anyTo = [&machine](int state, std::uint32_t when) {
+                machine.transitions.push_back({ -1, state, when, 0 });
+            };
+            anyTo(7, 1u << 0);   // death
+            anyTo(6, 1u << 1);   // knockback
+            anyTo(5, 1u << 5);   // throw
+            anyTo(2, 1u << 2);   // attack1..3
+            anyTo(3, 1u << 3);
+            anyTo(4, 1u << 4);
+            anyTo(1, 1u << 6);   // run while moving
+            anyTo(0, 0);         // otherwise idle
+            machine.Compile();
+            return machine;
+        }
+
+        /// Signal names -> bit mask; false on an unknown name.
+        bool ParseSignals(const nlohmann::json& names, const std::vector<std::string>& signals, std::uint32_t& out)
+        {
+            out = 0;
+            if (!names.is_array())
+                return names.is_null();
+            for (const auto& name : names)
+            {
+                const std::string text = name.is_string() ? name.get<std::string>() : std::string{};
+                std::uint32_t bit = 0;
+                for (std::size_t i = 0; i < signals.size(); ++i)
+                {
+                    if (StringId::Folded(signals[i]) == StringId::Folded(text))
+                        bit = 1u << i;
+                }
+                if (!bit)
+                    return false;
+                out |= bit;
+            }
+            return true;
+        }
+
+        nlohmann::json SignalNames(std::uint32_t bits, const std::vector<std::string>& signals)
+        {
+            nlohmann::json names = nlohmann::json::array();
+            for (std::size_t i = 0; i < signals.size(); ++i)
+            {
+                if (bits & (1u << i))
+                    names.push_back(signals[i]);
+            }
+            return names;
+        }
+    }
+
+    std::filesystem::path AnimStateMachineLibrary::PathFor(std::string_view machineId)
+    {
+        return ResolveDataPath(std::filesystem::path("Animation") / (std::string(machineId) + ".json"));
+    }
+
+    const AnimStateMachineAsset* AnimStateMachineLibrary::Get(std::string_view machineId)
+    {
+        return GetMutable(machineId);
+    }
+
+    AnimStateMachineAsset* AnimStateMachineLibrary::GetMutable(std::string_view machineId)
+    {
+        MachineMap& machines = Cache();
+        const std::string key(machineId);
+        if (auto it = machines.find(key); it != machines.end())
+            return it->second.get();
+
+        auto asset = std::make_unique<AnimStateMachineAsset>();
+        if (!LoadOrBuiltIn(key, *asset))
+        {
+            std::cerr << "[AnimStateMachineLibrary] Unknown machine '" << key << "' and no file at " << PathFor(key) << "\n";
+            machines.emplace(key, nullptr);
+            return nullptr;
+        }
+
+        AnimStateMachineAsset* result = asset.get();
+        machines.emplace(key, std::move(asset));
+        return result;
+    }
+
+    /*****************************************************************************************
+      \brief Assign in place: instances hold asset pointers and notice the new revision.
+    *****************************************************************************************/
+    void AnimStateMachineLibrary::Reload()
+    {
+        for (auto& [key, asset] : Cache())
+        {
+            AnimStateMachineAsset fresh;
+            if (asset && LoadOrBuiltIn(key, fresh))
+                *asset = std::move(fresh);
+        }
+    }
+
+    bool AnimStateMachineLibrary::LoadFromFile(const std::filesystem::path& file, AnimStateMachineAsset& out)
+    {
+        std::ifstream in(file);
+        if (!in.is_open())
+        {
+            std::cerr << "[AnimStateMachineLibrary] Could not open " << file << "\n";
+            return false;
+        }
+
+        nlohmann::json j = nlohmann::json::parse(in, nullptr, false);
+        if (j.is_discarded() || !j.is_object() || !j.contains("states") || !j["states"].is_array())
+        {
+            std::cerr << "[AnimStateMachineLibrary] " << file << " is not a state machine (missing \"states\")\n";
+            return false;
+        }
+
+        AnimStateMachineAsset machine;
+        machine.id = j.value("id", file.stem().string());
+        if (auto it = j.find("signals"); it != j.end() && it->is_array())
+        {
+            for (const auto& name : *it)
+                machine.signals.push_back(name.is_string() ? name.get<std::string>() : std::string{});
+        }
+
+        std::unordered_map<std::uint64_t, int> indexOf;
+        for (const auto& js : j["states"])
+        {
+            AnimStateMachineAsset::State state;
+            state.name = js.value("name", std::string{});
+            state.clip = js.value("clip", state.name);
+            if (state.name.empty() || !indexOf.emplace(StringId::Folded(state.name).Value(), static_cast<int>(machine.states.size())).second)
+            {
+                std::cerr << "[AnimStateMachineLibrary] " << file << ": missing or duplicate state name '" << state.name << "'\n";
+                return false;
+            }
+            machine.states.push_back(std::move(state));
+        }
+
+        auto toIndex = [&indexOf](const std::string& name) {
+            auto it = indexOf.find(StringId::Folded(name).Value());
+            return it == indexOf.end() ? -2 : it->second;
+        };
+        machine.initialState = toIndex(j.value("initial", machine.states.empty() ? std::string{} : machine.states.front().name));
+
+        if (auto it = j.find("transitions"); it != j.end() && it->is_array())
+        {
+            for (const auto& jt : *it)
+            {
+                AnimStateMachineAsset::Transition transition;
+                const std::string from = jt.value("from", std::string("*"));
+                const std::string to = jt.value("to", std::string{});
+                transition.from = from == "*" ? -1 : toIndex(from);
+                transition.to = toIndex(to);
+                const bool signalsOk =
+                    ParseSignals(jt.contains("when") ? jt["when"] : nlohmann::json(), machine.signals, transition.when) &&
+                    ParseSignals(jt.contains("unless") ? jt["unless"] : nlohmann::json(), machine.signals, transition.unless);
+                if (transition.from < -1 || transition.to < 0 || !signalsOk)
+                {
+                    std::cerr << "[AnimStateMachineLibrary] " << file << ": transition '" << from << "' -> '" << to
+                        << "' names an unknown state or signal\n";
+                    return false;
+                }
+                machine.transitions.push_back(transition);
+            }
+        }
+
+        if (!machine.Compile())
+        {
+            std::cerr << "[AnimStateMachineLibrary] " << file << " failed to compile\n";
+            return false;
+        }
+
+        out = std::move(machine);
+        return true;
+    }
+
+    bool AnimStateMachineLibrary::Save(const AnimStateMachineAsset& asset)
+    {
+        if (!asset.IsCompiled())
+        {
+            std::cerr << "[AnimStateMachineLibrary] Not saving '" << asset.id << "': it does not compile\n";
+            return false;
+        }
+
+        const auto stateName = [&asset](int index) {
+            return index < 0 ? std::string("*") : asset.states[static_cast<std::size_t>(index)].name;
+        };
+
+        nlohmann::json states = nlohmann::json::array();
+        for (const auto& state : asset.states)
+            states.push_back({ {"name", state.name}, {"clip", state.clip} });
+
+        nlohmann::json transitions = nlohmann::json::array();
+        for (const auto& transition : asset.transitions)
+        {
+            nlohmann::json jt = { {"from", stateName(transition.from)}, {"to", stateName(transition.to)} };
+            if (transition.when)
+                jt["when"] = SignalNames(transition.when, asset.signals);
+            if (transition.unless)
+                jt["unless"] = SignalNames(transition.unless, asset.signals);
+            transitions.push_back(std::move(jt));
+        }
+
+        const nlohmann::json j = {
+            {"id", asset.id},
+            {"signals", asset.signals},
+            {"initial", stateName(asset.initialState)},
+            {"states", states},
+            {"transitions", transitions}
+        };
+
+        const std::filesystem::path file = PathFor(asset.id);
+        std::error_code ec;
+        std::filesystem::create_directories(file.parent_path(), ec);
+        std::ofstream outFile(file);
+        if (!outFile.is_open())
+        {
+            std::cerr << "[AnimStateMachineLibrary] Could not write " << file << "\n";
+            return false;
+        }
+        outFile << j.dump(2) << "\n";
+        std::cout << "[AnimStateMachineLibrary] Saved " << file << "\n";
+        return true;
+    }
+
+    AnimStateMachineAsset AnimStateMachineLibrary::BuiltIn(std::string_view machineId)
+    {
+        if (machineId == kPlayerMachine)
+            return MakePlayerMachine();
+        return {};
+    }
+}
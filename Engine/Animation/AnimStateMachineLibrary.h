@@ -0,0 +1,75 @@
+/*********************************************************************************************
+ \file      AnimStateMachineLibrary.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Loads, compiles and shares AnimStateMachineAssets by id.
+ \details   Get("player") returns the machine from Data_Files/Animation/player.json, loading
+            and compiling it on first use. A built-in copy of the player machine is used
+            when the file is missing or invalid. Every object whose SpriteAnimationComponent
+            names the same machine shares one asset.
+
+            JSON layout:
+            \code
+            { "id": "player",
+              "signals": ["dead", "moving"],
+              "initial": "idle",
+              "states": [
+                { "name": "idle", "clip": "idle" },
+                { "name": "run", "clip": "run" },
+                { "name": "death", "clip": "death" } ],
+              "transitions": [
+                { "from": "*", "to": "death", "when": ["dead"] },
+                { "from": "idle", "to": "run", "when": ["moving"] },
+                { "from": "run", "to": "idle", "unless": ["moving"] } ] }
+            \endcode
+            States and signals are referred to by name in the file and by index once
+            loaded. "clip" defaults to the state name.
+
+            Get(), Reload() and Save() are main-thread only. Reload() re-reads the files
+            into the existing assets, so returned pointers stay valid for the whole run.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "Animation/AnimStateMachine.h"
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class AnimStateMachineLibrary
+      \brief Static cache of shared, compiled animation state machines.
+    *****************************************************************************************/
+    class AnimStateMachineLibrary
+    {
+    public:
+        static constexpr std::string_view kPlayerMachine = "player";
+
+        /// Shared machine for \a machineId; null only if the id is unknown and has no file.
+        static const AnimStateMachineAsset* Get(std::string_view machineId);
+
+        /// Editable access for AnimationEditorPanel; call Compile() on it after each change.
+        static AnimStateMachineAsset* GetMutable(std::string_view machineId);
+
+        /// Re-read every cached machine from disk (built-in copies where the file is gone).
+        static void Reload();
+
+        /// Write \a asset to Data_Files/Animation/<id>.json.
+        static bool Save(const AnimStateMachineAsset& asset);
+
+        /**
+         * \brief Parse a machine file and compile it.
+         * \return True if \a out holds a compiled machine; errors are logged with the file name.
+         */
+        static bool LoadFromFile(const std::filesystem::path& file, AnimStateMachineAsset& out);
+
+        /// Built-in machine for \a machineId, compiled (empty asset if there is none).
+        static AnimStateMachineAsset BuiltIn(std::string_view machineId);
+
+        static std::filesystem::path PathFor(std::string_view machineId);
+    };
+}
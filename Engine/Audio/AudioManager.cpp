@@ -115,9 +115,12 @@ bool AudioManager::loadSound(const std::string& name, const std::string& filePat
     }
 
     // Check if sound is already loaded
-    if (m_sounds.find(name) != m_sounds.end()) 
-    { 
-        std::cout << "Sound '" << name << "' is already loaded" << std::endl; return true;
+    {
+        std::lock_guard<std::mutex> lock(m_loadMutex);
+        if (m_sounds.find(name) != m_sounds.end())
+        {
+            std::cout << "Sound '" << name << "' is already loaded" << std::endl; return true;
+        }
     }
 
     std::string fullPath = getFullPath(filePath);
@@ -140,8 +143,17 @@ bool AudioManager::loadSound(const std::string& name, const std::string& filePat
         return false;
     }
     
-    m_sounds[name] = sound;
-    
+    // CreateSound runs unlocked so several sounds can decode at once; the map is only
+    // touched under the lock. If another thread registered the same name meanwhile, keep theirs.
+    {
+        std::lock_guard<std::mutex> lock(m_loadMutex);
+        if (!m_sounds.emplace(name, sound).second)
+        {
+            FMOD_Sound_Release(sound);
+            return true;
+        }
+    }
+
     std::cout << "Loaded sound: " << name << " from " << fullPath << std::endl;
     return true;
 }
@@ -17,6 +17,7 @@
 #include <unordered_map>
 #include <memory>
 #include <vector>
+#include <mutex>
 #include "fmod.h"
 
 struct FadeData
@@ -63,6 +64,7 @@ class AudioManager
     private:
     FMOD_SYSTEM* m_system;///Pointer to the FMOD system instance.
     std::unordered_map<std::string, FMOD_SOUND*> m_sounds;///Map of loaded sounds by name.
+    std::mutex m_loadMutex;///Guards m_sounds inside loadSound(), which startup workers call concurrently.
     std::unordered_map<std::string, std::vector<FMOD_CHANNEL*>> m_channels;///Map of channels for each sound.
     std::vector<FadeData> m_fades;
     std::string getFullPath(const std::string& fileName) const;
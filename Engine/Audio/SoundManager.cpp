@@ -40,6 +40,11 @@ bool SoundManager::initialize()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
+    // Already running (the startup preloader initializes audio early so sounds can be
+    // opened in parallel); keep the existing system and the sounds it holds.
+    if (m_audioManager)
+        return true;
+
     // Create and initialize AudioManager
     auto audio = std::make_shared<AudioManager>();
 
@@ -0,0 +1,82 @@
+/*********************************************************************************************
+ \file      StringId.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements the StringId intern table used to resolve ids back to text.
+ \details   The table only grows; ids are interned when data-driven names are assigned
+            (texture keys, object names), not on lookup, so the mutex is off the hot path.
+            A hash collision between two different strings is reported once per id.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "StringId.h"
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        std::mutex& TableMutex()
+        {
+            static std::mutex m;
+            return m;
+        }
+
+        /// Function-local so ids interned during static initialization are safe.
+        std::unordered_map<std::uint64_t, std::string>& Table()
+        {
+            static std::unordered_map<std::uint64_t, std::string> table;
+            return table;
+        }
+
+        StringId Register(StringId id, std::string_view text)
+        {
+            if (id.IsNull())
+                return id;
+
+            std::lock_guard<std::mutex> lock(TableMutex());
+            auto [it, inserted] = Table().try_emplace(id.Value(), text);
+            if (!inserted && it->second != text)
+            {
+                std::cerr << "[StringId] Hash collision: '" << it->second << "' and '"
+                    << text << "' share id " << std::hex << id.Value() << std::dec << "\n";
+            }
+            return id;
+        }
+    }
+
+    StringId StringId::Intern(std::string_view text)
+    {
+        return Register(StringId(text), text);
+    }
+
+    StringId StringId::InternFolded(std::string_view text)
+    {
+        std::string lower(text);
+        for (char& c : lower)
+        {
+            if (c >= 'A' && c <= 'Z')
+                c = static_cast<char>(c - 'A' + 'a');
+        }
+        return Register(StringId(lower), lower);
+    }
+
+    std::string_view StringId::Str() const
+    {
+        if (IsNull())
+            return {};
+
+        std::lock_guard<std::mutex> lock(TableMutex());
+        auto it = Table().find(value);
+        return it != Table().end() ? std::string_view(it->second) : std::string_view{};
+    }
+} // namespace Framework
@@ -0,0 +1,173 @@
+/*********************************************************************************************
+ \file      StringId.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Declares StringId, a 64-bit hashed identifier for engine names, and
+            InternedString, a string that carries its StringId alongside the text.
+ \details   Hot paths (texture lookups, animation and sound selection, object-name checks)
+            compare and hash StringIds instead of std::strings. Literals are hashed at
+            compile time:
+            \code
+                using namespace Framework::literals;
+                if (obj->GetObjectNameId() == "player"_sid) { ... }
+                switch (StringId(name).Value()) { case "Slash"_sid.Value(): ... }
+            \endcode
+
+            Two flavours of hash are provided:
+            - StringId(text)          exact, case-sensitive.
+            - StringId::Folded(text)  ASCII case-insensitive; equals StringId(lowercase text),
+                                      so folded ids compare equal to lowercase literals.
+
+            Runtime strings that should be readable later (editor display, logs) are
+            registered with StringId::Intern(); Str() resolves them back. Literal-only ids
+            are never registered and resolve to an empty view.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class StringId
+      \brief FNV-1a 64-bit hash of a name. The empty string maps to the null id (0).
+    *****************************************************************************************/
+    class StringId
+    {
+    public:
+        constexpr StringId() = default;
+        constexpr explicit StringId(std::string_view text) : value(Hash(text, false)) {}
+
+        /// Case-insensitive (ASCII) id; identical to StringId of the lowercased text.
+        static constexpr StringId Folded(std::string_view text)
+        {
+            StringId id;
+            id.value = Hash(text, true);
+            return id;
+        }
+
+        /// Hash \a text and remember it so Str() can resolve the id later.
+        static StringId Intern(std::string_view text);
+        /// Folded variant of Intern(); the lowercased text is what gets remembered.
+        static StringId InternFolded(std::string_view text);
+
+        /// Original text if the id was interned, otherwise an empty view.
+        std::string_view Str() const;
+
+        constexpr std::uint64_t Value() const { return value; }
+        constexpr bool IsNull() const { return value == 0; }
+        constexpr explicit operator bool() const { return value != 0; }
+
+        friend constexpr bool operator==(StringId a, StringId b) { return a.value == b.value; }
+        friend constexpr bool operator!=(StringId a, StringId b) { return a.value != b.value; }
+        friend constexpr bool operator<(StringId a, StringId b) { return a.value < b.value; }
+
+    private:
+        static constexpr std::uint64_t kOffset = 14695981039346656037ull;
+        static constexpr std::uint64_t kPrime = 1099511628211ull;
+
+        static constexpr std::uint64_t Hash(std::string_view text, bool fold)
+        {
+            if (text.empty())
+                return 0;
+            std::uint64_t h = kOffset;
+            for (char ch : text)
+            {
+                unsigned char c = static_cast<unsigned char>(ch);
+                if (fold && c >= 'A' && c <= 'Z')
+                    c = static_cast<unsigned char>(c - 'A' + 'a');
+                h ^= c;
+                h *= kPrime;
+            }
+            return h;
+        }
+
+        std::uint64_t value = 0;
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, StringId id)
+    {
+        const std::string_view text = id.Str();
+        if (!text.empty())
+            return os << text;
+        return os << "#" << std::hex << id.Value() << std::dec;
+    }
+
+    namespace literals
+    {
+        /// Compile-time exact id: "player"_sid
+        constexpr StringId operator""_sid(const char* text, std::size_t length)
+        {
+            return StringId(std::string_view(text, length));
+        }
+    }
+
+    /*****************************************************************************************
+      \class InternedString
+      \brief std::string plus its interned StringId, kept in sync on every assignment.
+      \details Used for data-driven keys that are looked up every frame (e.g. texture keys):
+               readers use id() for hashing/comparison and str() for display or file paths.
+               Converts implicitly to const std::string& so existing string-based call sites
+               keep working.
+    *****************************************************************************************/
+    class InternedString
+    {
+    public:
+        InternedString() = default;
+        explicit InternedString(std::string text) : text(std::move(text)), sid(StringId::Intern(this->text)) {}
+        explicit InternedString(const char* text) : InternedString(std::string(text ? text : "")) {}
+        explicit InternedString(std::string_view text) : InternedString(std::string(text)) {}
+
+        /// Re-assigning the same text (common in per-frame animation code) skips interning.
+        InternedString& operator=(std::string value)
+        {
+            if (value == text)
+                return *this;
+            text = std::move(value);
+            sid = StringId::Intern(text);
+            return *this;
+        }
+        InternedString& operator=(const char* value) { return *this = std::string(value ? value : ""); }
+        InternedString& operator=(std::string_view value) { return *this = std::string(value); }
+
+        const std::string& str() const { return text; }
+        const char* c_str() const { return text.c_str(); }
+        StringId id() const { return sid; }
+        bool empty() const { return text.empty(); }
+        std::size_t size() const { return text.size(); }
+        void clear() { text.clear(); sid = StringId{}; }
+
+        operator const std::string&() const { return text; }
+
+        friend bool operator==(const InternedString& a, const InternedString& b) { return a.sid == b.sid; }
+        friend bool operator!=(const InternedString& a, const InternedString& b) { return a.sid != b.sid; }
+        friend bool operator==(const InternedString& a, std::string_view b) { return a.text == b; }
+        friend bool operator!=(const InternedString& a, std::string_view b) { return a.text != b; }
+
+    private:
+        std::string text;
+        StringId    sid;
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const InternedString& s)
+    {
+        return os << s.str();
+    }
+} // namespace Framework
+
+template <>
+struct std::hash<Framework::StringId>
+{
+    std::size_t operator()(Framework::StringId id) const noexcept
+    {
+        return static_cast<std::size_t>(id.Value());
+    }
+};
@@ -56,6 +56,12 @@ namespace Framework {
          *************************************************************************************/
         virtual void draw() {};
 
+        /*************************************************************************************
+         \brief optional hook run after every simulation step while RenderSnapshot is
+                capturing; copy what draw() needs into RenderSnapshot::Back()
+         *************************************************************************************/
+        virtual void CaptureRenderState() {}
+
         /*************************************************************************************
          \brief optional shutdown hook for derived system
         *************************************************************************************/
@@ -0,0 +1,30 @@
+/*********************************************************************************************
+ \file      VerboseLog.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Compile-time removable logging for high-frequency gameplay events.
+ \details   SOFASPUDS_VLOG(tag, message) writes "[tag] message" to std::cout only when the
+            engine is built with SOFASPUDS_ENABLE_VERBOSE_LOGS=1 (CMake option of the same
+            name, OFF by default). Otherwise the macro expands to nothing, so the message
+            expression is never evaluated and builds no strings:
+            \code
+                SOFASPUDS_VLOG("HitBox", "spawned at (" << x << ", " << y << ")");
+            \endcode
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#ifndef SOFASPUDS_ENABLE_VERBOSE_LOGS
+#define SOFASPUDS_ENABLE_VERBOSE_LOGS 0
+#endif
+
+#if SOFASPUDS_ENABLE_VERBOSE_LOGS
+#include <iostream>
+#define SOFASPUDS_VLOG(tag, message) \
+    do { std::cout << "[" << tag << "] " << message << '\n'; } while (0)
+#else
+#define SOFASPUDS_VLOG(tag, message) \
+    do { } while (0)
+#endif
@@ -31,6 +31,7 @@
 #include "Audio/SoundManager.h"
 #include <memory>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <vector>
 #include <fstream>
@@ -257,29 +258,24 @@ namespace Framework
           \details
               Useful for one-shot events such as effects, hits, UI sounds, or ambient cues.
         *************************************************************************************/
-        void TriggerSound(const std::string& name)
+        void TriggerSound(std::string_view name)
         {
             ensureInitialized();
-            std::string clipToPlay = name;
 
-            if (name == "Slash")
-                clipToPlay = GetRandomFrom(slashClips);
-            else if (name == "Punch")
-                clipToPlay = GetRandomFrom(punchClips);
-            else if (name == "Ineffective")
-                clipToPlay = GetRandomFrom(ineffectiveClips);
-            else if (name == "GrappleShoot")
-                clipToPlay = GetRandomFrom(grappleClips);
+            // Group names are matched by compile-time hash instead of a chain of string compares.
+            switch (StringId(name).Value())
+            {
+            case StringId("Slash").Value():        Play(GetRandomFrom(slashClips)); return;
+            case StringId("Punch").Value():        Play(GetRandomFrom(punchClips)); return;
+            case StringId("Ineffective").Value():  Play(GetRandomFrom(ineffectiveClips)); return;
+            case StringId("GrappleShoot").Value(): Play(GetRandomFrom(grappleClips)); return;
 
             // Enemy groups
-            else if (name == "EnemyAttack")
-                clipToPlay = GetRandomFrom(attackClips);
-            else if (name == "EnemyHit")
-                clipToPlay = GetRandomFrom(hurtClips);
-            else if (name == "EnemyDeath")
-                clipToPlay = GetRandomFrom(deathClips);
-
-            Play(clipToPlay);
+            case StringId("EnemyAttack").Value():  Play(GetRandomFrom(attackClips)); return;
+            case StringId("EnemyHit").Value():     Play(GetRandomFrom(hurtClips)); return;
+            case StringId("EnemyDeath").Value():   Play(GetRandomFrom(deathClips)); return;
+            default:                               Play(std::string(name)); return;
+            }
         }
         /*************************************************************************************
           \brief Selects a random element from a list of strings.
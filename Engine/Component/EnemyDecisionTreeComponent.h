@@ -8,15 +8,14 @@
             behavior such as idle, chase, or patrol states using decision-tree logic.
 
  \details
-            EnemyDecisionTreeComponent integrates the AI/DecisionTree system into the
-            engine's ECS architecture. When initialized, it automatically constructs a
-            default decision tree for the owning GameObjectComposition via
-            CreateDefaultEnemyTree(). The component stores additional runtime data such
-            as movement direction, chase timers, and flags indicating whether the player
-            has been seen.
+            EnemyDecisionTreeComponent integrates the AI decision tree system into the
+            engine's ECS architecture. It points at a DecisionTreeAsset shared by every
+            enemy using the same tree (looked up by AiSystem through DecisionTreeLibrary)
+            and keeps this enemy's runtime data, such as movement direction, chase timers,
+            and whether the player has been seen, in an EnemyAiState POD.
 
             Responsibilities:
-            - Owns and updates an AI DecisionTree instance.
+            - Selects the tree ("tree" key in JSON; defaults to the enemy type's tree).
             - Tracks state data like chase direction, pause timers, and player detection.
             - Provides a framework for extensible enemy AI logic.
 
@@ -28,11 +27,12 @@
 #include "Composition/Component.h"
 #include "Memory/ComponentPool.h"
 #include "Serialization/Serialization.h"
-#include "AI/DecisionTreeDefault.h"
+#include "AI/DecisionTreeVM.h"
 #include "Composition/Composition.h"
-#include "AI/DecisionTree.h"
 #include "Systems/LogicSystem.h"
+#include <cstdint>
 #include <iostream>
+#include <string>
 
 #define NOMINMAX
 #if defined(APIENTRY)
@@ -44,69 +44,32 @@
 #endif
 
 namespace Framework {
-    enum class Facing { LEFT, RIGHT };
-    /*****************************************************************************************
-      \brief Creates a default decision tree for an enemy.
-      \param enemy  Pointer to the enemy GameObjectComposition.
-      \return A unique_ptr to a new DecisionTree instance configured for default AI behavior.
-    *****************************************************************************************/
-    std::unique_ptr<DecisionTree> CreateDefaultEnemyTree(GOC* enemy, LogicSystem* logic);
-
     /*****************************************************************************************
       \class EnemyDecisionTreeComponent
       \brief Component responsible for managing the AI decision tree of an enemy.
 
-      This component attaches a DecisionTree to an enemy entity, initializing it with
-      default behaviors defined in AI/DecisionTreeDefault.h. It tracks state variables
-      such as movement direction, chase duration, and player detection flags.
+      This component links an enemy entity to a shared DecisionTreeAsset (see
+      AI/DecisionTreeLibrary.h) and owns the per-enemy EnemyAiState the tree operates on.
     *****************************************************************************************/
     class EnemyDecisionTreeComponent : public GameComponent
     {
     public:
-        std::unique_ptr<DecisionTree> tree;  ///< The decision tree controlling enemy behavior.
-        float dir = 0.0f;                    ///< Movement direction (1.0 for right, -1.0 for left).
-        float pauseTimer = 0.0f;             ///< Timer used for brief pauses between AI actions.
-        float chaseSpeed = 0.0f;             ///< Current speed while chasing the player.
-        float chaseTimer = 0.0f;             ///< Accumulated time spent in chase mode.
-        float maxChaseDuration = 3.0f;       ///< Maximum allowed chase time before reset.
-        float retreatTimer = 0.0f;           ///< Retreat Timer
-        bool rangedAttackActive = false;     ///< True while a ranged attack animation is playing.
-        bool rangedProjectileFired = false;  ///< True once the ranged projectile has been spawned.
-        float rangedAttackTimer = 0.0f;      ///< Timer tracking ranged attack animation elapsed time.
-        float rangedAttackDuration = 0.0f;   ///< Cached duration for the ranged attack animation.
-        bool hasSeenPlayer = false;          ///< Tracks whether the enemy has detected the player.
-        float prevX = 0.0f;
-        float prevY = 0.0f;
-        float stuckXTimer = 0.0f;  // how long X has been stuck
-        float stuckYTimer = 0.0f;  // how long Y has been stuck
-        const float stuckThreshold = 0.2f; // seconds before trying alternative axis
-        float patrolOriginX = 0.0f; //patrol origin x
-        float patrolOriginY = 0.0f;// patrol origin y
-        bool patrolOriginSet = false; // set patrol origin
-        Facing facing = Facing::RIGHT;
+        const DecisionTreeAsset* tree = nullptr;  ///< Shared tree, resolved by AiSystem from treeId.
+        std::string treeId;                       ///< Tree to run; empty picks the enemy type's default.
+        EnemyAiState state;                       ///< Per-enemy data read and written by the tree.
 
         EnemyDecisionTreeComponent() = default;
 
         /*************************************************************************************
-          \brief Initializes the decision tree for this enemy component.
+          \brief Resets the runtime state of this enemy.
           \details
-              - Retrieves the owning GameObjectComposition.
-              - Constructs a default DecisionTree using CreateDefaultEnemyTree().
-              - Logs a debug message upon successful initialization.
+              - Clears patrol origin, timers and player detection.
+              - Drops the tree pointer so AiSystem resolves it again from treeId.
         *************************************************************************************/
         void initialize() override
         {
-            patrolOriginSet = false;
-            patrolOriginX = 0.0f;
-            patrolOriginY = 0.0f;
-
-            chaseTimer = 0.0f;
-            retreatTimer = 0.0f;
-            pauseTimer = 0.0f;
-            hasSeenPlayer = false;
-            dir = 1.0f;
-            prevX = prevY = 0.0f;
-            stuckXTimer = stuckYTimer = 0.0f;
+            state = EnemyAiState{};
+            tree = nullptr;
             std::cout << "[EnemyDecisionTreeComponent] Tree initialized.\n";   
         }
 
@@ -120,27 +83,26 @@ namespace Framework {
         /*************************************************************************************
           \brief Serializes the component data.
           \param s  Reference to the serializer.
-          \note  Currently a placeholder; no serializable data yet.
+          \note  Reads the optional "tree" id (e.g. "enemy_ranged").
         *************************************************************************************/
-        void Serialize(ISerializer& s) override { (void)s; }
+        void Serialize(ISerializer& s) override
+        {
+            if (s.HasKey("tree")) StreamRead(s, "tree", treeId);
+        }
 
         /*************************************************************************************
           \brief Creates a deep copy of this component.
           \return A unique_ptr holding a cloned EnemyDecisionTreeComponent.
+          \note  The clone patrols around its own spawn point and has no pending attack.
         *************************************************************************************/
         ComponentHandle Clone() const override
         {
             auto copy = ComponentPool<EnemyDecisionTreeComponent>::CreateTyped();
-            copy->dir = dir;
-            copy->pauseTimer = pauseTimer;
-            copy->chaseSpeed = chaseSpeed;
-            copy->chaseTimer = chaseTimer;
-            copy->maxChaseDuration = maxChaseDuration;
-            copy->rangedAttackActive = rangedAttackActive;
-            copy->rangedProjectileFired = rangedProjectileFired;
-            copy->rangedAttackTimer = rangedAttackTimer;
-            copy->rangedAttackDuration = rangedAttackDuration;
-            copy->hasSeenPlayer = hasSeenPlayer;
+            copy->tree = tree;
+            copy->treeId = treeId;
+            copy->state = state;
+            copy->state.patrolOriginSet = false;
+            copy->state.attackRequest = {};
 
             return copy;
         }
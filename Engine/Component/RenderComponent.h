@@ -131,7 +131,7 @@ namespace Framework {
         int layer = 0;
 
         unsigned int texture_id{ 0 };
-        std::string  texture_key;
+        InternedString texture_key;   ///< Interned so the per-frame lookup hashes nothing
         std::string  texture_path;
 
         bool visible{ true };
@@ -147,7 +147,7 @@ namespace Framework {
             if (texture_key.empty())
                 return;
 
-            texture_id = Resource_Manager::getTexture(texture_key);
+            texture_id = Resource_Manager::getTexture(texture_key.id());
             if (texture_id)
                 return;
 
@@ -158,7 +158,7 @@ namespace Framework {
             const std::string& pathStr = resolvedPath.empty() ? texture_path : resolvedPath.string();
 
             if (Resource_Manager::load(texture_key, pathStr))
-                texture_id = Resource_Manager::getTexture(texture_key);
+                texture_id = Resource_Manager::getTexture(texture_key.id());
         }
 
         /*************************************************************************************
@@ -201,6 +201,8 @@ namespace Framework {
 
         /*************************************************************************************
           \brief Creates a clone of this RenderComponent.
+          \note  texture_id is not copied; initialize() re-resolves it from texture_key,
+                 since a prefab template's cached handle may belong to an evicted texture.
         *************************************************************************************/
         ComponentHandle Clone() const override {
             auto copy = ComponentPool<RenderComponent>::CreateTyped();
@@ -211,7 +213,6 @@ namespace Framework {
             copy->b = b;
             copy->a = a;
             copy->texture_key = texture_key;
-            copy->texture_id = texture_id;
             copy->texture_path = texture_path;
             copy->visible = visible;
             copy->layer = layer;
@@ -15,6 +15,7 @@
             - Integrates with Resource_Manager to resolve and (re)bind textures at runtime.
             - Advances animation state over time and exposes sampling info (texture + UV)
               for the RenderSystem and editor tools such as the Animation Editor panel.
+              In game, AnimationSystem does the advancing in bulk and fills `sampled`.
             - Handles JSON-driven serialization for both legacy and sprite-sheet formats,
               including restoration of the active animation index.
  \copyright
@@ -28,6 +29,7 @@
 #include "Serialization/Serialization.h"
 #include "Resource_Asset_Manager/Resource_Manager.h"
 #include "Core/PathUtils.h"
+#include "Animation/AnimStateMachineLibrary.h"
 #include <glm/vec4.hpp>
 
 #include <algorithm>
@@ -94,6 +96,7 @@ namespace Framework {
         *************************************************************************************/
         struct SpriteSheetAnimation {
             std::string name{ "idle" };       ///< Logical name of the animation (e.g., "run").
+            StringId    nameId{ StringId::Folded("idle") }; ///< Case-folded id of name (see RefreshNameIds).
             std::string spriteSheetPath{};    ///< Original path to the sprite sheet asset.
             std::string textureKey{};         ///< Resource_Manager key used to fetch the texture.
             AnimConfig  config{};             ///< Grid and playback configuration.
@@ -114,6 +117,10 @@ namespace Framework {
         std::vector<SpriteSheetAnimation> animations{}; ///< Set of named sprite-sheet animations.
         int activeAnimation{ 0 };                       ///< Index into animations[] for active clip.
 
+        // --- state machine ---------------------------------------------------
+        std::string              stateMachine{};  ///< AnimStateMachineLibrary id; empty = clips are switched by hand.
+        AnimStateMachineInstance machine{};       ///< Runtime state; not serialized, rebinds on demand.
+
         // ---------------------------------------------------------------------
         // Engine lifecycle
         // ---------------------------------------------------------------------
@@ -138,6 +145,7 @@ namespace Framework {
             * "config" object containing layout/fps/loop fields
             * optional "currentFrame"
           - "activeAnimation" index to restore current sheet animation selection.
+          - optional "stateMachine" id (see AnimStateMachineLibrary).
         *************************************************************************************/
         void Serialize(ISerializer& s) override {
             if (s.HasKey("fps")) StreamRead(s, "fps", fps);
@@ -219,6 +227,11 @@ namespace Framework {
             if (s.HasKey("activeAnimation")) {
                 StreamRead(s, "activeAnimation", activeAnimation);
             }
+
+            if (s.HasKey("stateMachine"))
+                StreamRead(s, "stateMachine", stateMachine);
+
+            RefreshNameIds();
         }
 
         /*************************************************************************************
@@ -236,7 +249,12 @@ namespace Framework {
             copy->currentFrame = currentFrame;
             copy->accumulator = accumulator;
             copy->animations = animations;
+            // The source (often a prefab template) may hold a handle to an evicted
+            // texture; let the clone re-resolve lazily by key.
+            for (auto& anim : copy->animations)
+                anim.textureId = 0;
             copy->activeAnimation = activeAnimation;
+            copy->stateMachine = stateMachine;   // the clone binds its own instance
             return copy;
         }
 
@@ -296,6 +314,27 @@ namespace Framework {
             return clamped;
         }
 
+        /*************************************************************************************
+          \brief Find a sprite-sheet animation by case-folded id.
+          \param foldedName StringId::Folded(name); lowercase "_sid" literals also match.
+          \return Index into animations[], or -1 if no animation has that name.
+        *************************************************************************************/
+        int FindAnimationIndex(StringId foldedName) const {
+            for (std::size_t i = 0; i < animations.size(); ++i) {
+                if (animations[i].nameId == foldedName)
+                    return static_cast<int>(i);
+            }
+            return -1;
+        }
+
+        /*************************************************************************************
+          \brief Recompute nameId for every animation. Call after assigning names directly.
+        *************************************************************************************/
+        void RefreshNameIds() {
+            for (auto& anim : animations)
+                anim.nameId = StringId::InternFolded(anim.name);
+        }
+
         /*************************************************************************************
           \brief Get a pointer to the active sprite-sheet animation.
           \return Pointer to the active SpriteSheetAnimation, or nullptr if none exist.
@@ -337,6 +376,30 @@ namespace Framework {
             }
         }
 
+        /*************************************************************************************
+          \brief State machine named by stateMachine (or \p fallbackId when that is empty),
+                 bound to this component's clips.
+
+          Binding resolves each state's clip index once; it is redone only when the machine
+          is recompiled (editor, reload) or the clip list changes size.
+          \return The bound instance, or nullptr if there is no usable machine.
+        *************************************************************************************/
+        AnimStateMachineInstance* BoundStateMachine(std::string_view fallbackId = {}) {
+            const std::string_view id = stateMachine.empty() ? fallbackId : std::string_view(stateMachine);
+            if (id.empty())
+                return nullptr;
+
+            const AnimStateMachineAsset* asset = machine.Asset();
+            if (!asset || asset->id != id)
+                asset = AnimStateMachineLibrary::Get(id);
+            if (!asset)
+                return nullptr;
+
+            if (!machine.IsBoundTo(asset, *this))
+                machine.Bind(asset, *this);
+            return machine.Asset() ? &machine : nullptr;
+        }
+
         // ---------------------------------------------------------------------
         // Texture maintenance helpers (used after undo/redo)
         // ---------------------------------------------------------------------
@@ -522,6 +585,32 @@ namespace Framework {
             return sample;
         }
 
+        /*************************************************************************************
+          \struct FrameSample
+          \brief  Texture and UV rect of the active clip's current frame, written each update
+                  by AnimationSystem so the renderer does not resample the sheet.
+        *************************************************************************************/
+        struct FrameSample {
+            unsigned  texture{ 0 };
+            glm::vec4 uv{ 0.f, 0.f, 1.f, 1.f };
+            int       animation{ -1 };  ///< activeAnimation the sample was taken from
+            int       frame{ -1 };      ///< currentFrame the sample was taken from
+        };
+        FrameSample sampled{};          ///< Runtime only; not serialized or cloned.
+
+        /*************************************************************************************
+          \brief The AnimationSystem sample, if the active clip and frame still match it.
+          \return nullptr when something changed them since the last update (editor, undo),
+                  in which case callers fall back to CurrentSheetSample().
+        *************************************************************************************/
+        const FrameSample* FreshSample() const {
+            const SpriteSheetAnimation* anim = ActiveAnimation();
+            if (!anim || sampled.texture == 0 || sampled.animation != ActiveAnimationIndex() ||
+                sampled.frame != anim->currentFrame || sampled.texture != anim->textureId)
+                return nullptr;
+            return &sampled;
+        }
+
         /*************************************************************************************
           \brief Ensure a default set of named animations exists.
 
@@ -541,6 +630,7 @@ namespace Framework {
             for (const char* name : kDefaultNames) {
                 SpriteSheetAnimation anim{};
                 anim.name = name;
+                anim.nameId = StringId::InternFolded(name);
                 anim.textureKey = std::string(name) + "_sheet";
                 animations.push_back(std::move(anim));
             }
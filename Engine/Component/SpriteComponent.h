@@ -35,7 +35,7 @@ namespace Framework {
         // runtime
         unsigned int texture_id{ 0 };  ///< OpenGL texture ID (assigned at runtime)
 
-        std::string texture_key; ///< Unique key used to identify the texture in Resource_Manager
+        InternedString texture_key; ///< Unique key used to identify the texture in Resource_Manager (interned)
         std::string path;        ///< Optional path to the texture file (used if key is missing)
 
         /*************************************************************************************
@@ -49,7 +49,7 @@ namespace Framework {
             if (texture_key.empty())
                 return;
 
-            texture_id = Resource_Manager::getTexture(texture_key);
+            texture_id = Resource_Manager::getTexture(texture_key.id());
             if (texture_id)
                 return;
 
@@ -79,7 +79,7 @@ namespace Framework {
 
             // load file and re-fetch id
             if (Resource_Manager::load(texture_key, pathStr)) {
-                texture_id = Resource_Manager::getTexture(texture_key);
+                texture_id = Resource_Manager::getTexture(texture_key.id());
             }
         }
 
@@ -97,12 +97,13 @@ namespace Framework {
         /*************************************************************************************
           \brief Creates a deep copy of the SpriteComponent.
           \return A unique_ptr to the cloned SpriteComponent.
-          \note  Copies the texture_key, texture_id, and path values into the new instance.
+          \note  Copies the texture_key and path. texture_id is left at 0: the source (often
+                 a prefab template) may hold a handle to an evicted texture, so initialize()
+                 re-resolves it by key, reloading it if needed.
         *************************************************************************************/
         ComponentHandle Clone() const override {
             auto copy = ComponentPool<SpriteComponent>::CreateTyped();
             copy->texture_key = texture_key;
-            copy->texture_id = texture_id;
             copy->path = path;
             return copy;
         }
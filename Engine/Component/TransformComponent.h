@@ -35,6 +35,13 @@ namespace Framework {
         float rot{ 0.0f }; ///< Rotation angle (in radians or degrees depending on convention)
         float scaleX{ 1.0f }; ///< Scale factor along the X axis
         float scaleY{ 1.0f }; ///< Scale factor along the Y axis
+
+        // Pose at the start of the latest fixed step; runtime only (not serialized or cloned).
+        // Written by RenderInterpolation::SaveStep().
+        float prevX{ 0.0f };
+        float prevY{ 0.0f };
+        float prevRot{ 0.0f };
+        bool  hasPrev{ false };
         /*************************************************************************************
           \brief Initializes the transform component.
           \note  Logs the current transform state to the console for debugging purposes.
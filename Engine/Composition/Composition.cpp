@@ -15,7 +15,10 @@
 
 #include "Composition.h"
 #include "Factory/Factory.h"
+#include "Factory/FactoryEvents.h"
+#include "Messaging_System/EventBus.h"
 #include "Core/Layer.h"
+#include <algorithm>
 #include <utility>
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
@@ -125,6 +128,7 @@ ote   The clone is registered with the factory and assigned a new unique ID.
 
         // Copy name (optional but useful)
         clone->ObjectName = ObjectName;
+        clone->ObjectNameId = ObjectNameId;
 
         // Avoid reallocations
         clone->Components.reserve(Components.size());
@@ -137,6 +141,7 @@ ote   The clone is registered with the factory and assigned a new unique ID.
             newComp->set_owner(clone);            // rewire owner
             newComp->set_type(up->GetTypeId());   // preserve type id
             clone->Components.emplace_back(std::move(newComp));
+            clone->NotifyComponentAdded(*clone->Components.back());
         }
         clone->SetLayerName(LayerName);
         clone->initialize();
@@ -167,5 +172,29 @@ ote   The clone is registered with the factory and assigned a new unique ID.
         //std::move transfer ownership from caller into the vector so GameObjectComposition own it component exclusively
         //emplace_back effienctly construct or move object at the end of the vector
         Components.emplace_back(std::move(comp));
+        NotifyComponentAdded(*Components.back());
+    }
+
+    /*************************************************************************************
+      \brief Removes the first component with the given type id.
+      \details Listeners get ComponentRemovedEvent while the component still exists.
+    *************************************************************************************/
+    bool GameObjectComposition::RemoveComponent(ComponentTypeId typeId)
+    {
+        auto it = std::find_if(Components.begin(), Components.end(),
+            [typeId](const UptrComp& up) { return up && up->GetTypeId() == typeId; });
+        if (it == Components.end())
+            return false;
+
+        if (ObjectId != 0)
+            EventBus::Instance().Publish(ComponentRemovedEvent{ this, ObjectId, typeId });
+        Components.erase(it);
+        return true;
+    }
+
+    void GameObjectComposition::NotifyComponentAdded(const GameComponent& component)
+    {
+        if (ObjectId != 0)
+            EventBus::Instance().Publish(ComponentAddedEvent{ this, ObjectId, component.GetTypeId() });
     }
 }
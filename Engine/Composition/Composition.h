@@ -16,10 +16,13 @@
 
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include "Component.h"
 #include "Common/MessageCom.h"
+#include "Common/StringId.h"
 #include <string>
 #include "Memory/ComponentPool.h"
+#include "Memory/LevelArena.h"
 
 
 
@@ -50,7 +53,11 @@ namespace Framework {
           \brief Sets the name of this game object.
           \param name  String name to assign.
         *************************************************************************************/
-        void SetObjectName(const std::string& name) { ObjectName = name; }
+        void SetObjectName(const std::string& name)
+        {
+            ObjectName = name;
+            ObjectNameId = StringId::InternFolded(name);
+        }
 
         /*************************************************************************************
           \brief Retrieves the name of this game object.
@@ -59,6 +66,12 @@ namespace Framework {
         *************************************************************************************/
         const std::string& GetObjectName() const { return ObjectName; }
 
+        /*************************************************************************************
+          \brief Case-folded id of the object name, for per-frame checks such as
+                 GetObjectNameId() == "player"_sid (matches "Player" and "player").
+        *************************************************************************************/
+        StringId GetObjectNameId() const { return ObjectNameId; }
+
         /*************************************************************************************
         \brief Sets the logical layer name that this object belongs to.
         \param layer String layer identifier (e.g., "Gameplay", "UI").
@@ -181,9 +194,17 @@ eturn Const pointer to the component if found, nullptr otherwise.
             raw->set_owner(this);
             raw->set_type(typeId);
             Components.emplace_back(std::move(handle));
+            NotifyComponentAdded(*raw);
             return raw;
         }
 
+        /*************************************************************************************
+          \brief Removes and releases the first component with the given type ID.
+          \param typeId  The ComponentTypeId to remove.
+          \return True if a component was removed.
+        *************************************************************************************/
+        bool RemoveComponent(ComponentTypeId typeId);
+
         /*************************************************************************************
           \brief Retrieves the unique ID of this GOC.
           
@@ -198,13 +219,18 @@ eturn Const pointer to the component if found, nullptr otherwise.
         ~GameObjectComposition() noexcept;
 
     private:
+        /// Publish ComponentAddedEvent once this object is registered (see FactoryEvents.h).
+        void NotifyComponentAdded(const GameComponent& component);
+
         // use unique pointer as The composition exclusively owns its components when the GameObjectComposition
         //is destroy every unique_ptr is delete its component
         //unique pointer are move-only so a component instance cant be owned by 2 game object
         using UptrComp = ComponentHandle;
-        std::vector<UptrComp> Components; //owned
+        // Drawn from the level arena when the object is built by a level load.
+        std::pmr::vector<UptrComp> Components{ LevelArena::ActiveResource() }; //owned
         GOCId ObjectId = 0;
         std::string ObjectName;
+        StringId ObjectNameId{};   ///< Folded id of ObjectName, kept in sync by SetObjectName
         std::string LayerName{ "Gameplay:0" };
 
 
@@ -26,6 +26,7 @@
 
 #include "Factory/Factory.h"
 #include "Core/PathUtils.h"
+#include "Resource_Asset_Manager/StartupPreloader.h"
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
 
@@ -41,8 +42,21 @@ namespace Framework
 
     namespace
     {
-        // Only treat files shaped like:
+        // Only treat documents shaped like:
         // { "GameObject": { "name": "...", "Components": { ... } } }
+        static bool IsPrefabDocument(const nlohmann::json& j)
+        {
+            if (!j.is_object() || !j.contains("GameObject") || !j["GameObject"].is_object())
+                return false;
+
+            auto& go = j["GameObject"];
+
+            if (!go.contains("Components") || !go["Components"].is_object())
+                return false;
+
+            return true;
+        }
+
         static bool IsPrefabJson(const std::filesystem::path& path)
         {
             if (path.extension() != ".json")
@@ -56,16 +70,7 @@ namespace Framework
             {
                 nlohmann::json j;
                 in >> j;
-
-                if (!j.contains("GameObject") || !j["GameObject"].is_object())
-                    return false;
-
-                auto& go = j["GameObject"];
-
-                if (!go.contains("Components") || !go["Components"].is_object())
-                    return false;
-
-                return true;
+                return IsPrefabDocument(j);
             }
             catch (...)
             {
@@ -76,10 +81,21 @@ namespace Framework
 
         static void RegisterPrefabFromFile(const std::filesystem::path& path)
         {
-            if (!IsPrefabJson(path))
-                return;
+            GOC* templateGoc = nullptr;
 
-            GOC* templateGoc = FACTORY->CreateTemplate(path.string());
+            // Parsed on a worker during startup: build straight from it (one parse per file).
+            if (auto document = StartupPreloader::TakeJsonDocument(path))
+            {
+                if (!IsPrefabDocument(*document))
+                    return;
+                templateGoc = FACTORY->CreateTemplateFromDocument(std::move(*document));
+            }
+            else
+            {
+                if (!IsPrefabJson(path))
+                    return;
+                templateGoc = FACTORY->CreateTemplate(path.string());
+            }
             if (!templateGoc)
                 return;
 
@@ -11,6 +11,8 @@
             - Orders rendering with ImGui: beginFrame → ImGui BeginFrame → user render → ImGui EndFrame
               → endFrame → swapBuffers.
             - Provides Quit() to request a graceful exit on the next loop iteration.
+            - Optionally pipelines: the frame's fixed steps run on the SimulationThread while
+              the main thread renders the snapshot of the previous frame's last step.
             Notes:
             * dt is clamped to <= 0.1s to avoid simulation explosions after stalls.
             * Callbacks are checked for null before use, keeping Core lightweight and embeddable.
@@ -20,12 +22,46 @@
 *********************************************************************************************/
 
 #include "Core.hpp"
+#include <algorithm>
 #include "Debug/Perf.h" 
+#include "Debug/Profiler.h"
+#include "Core/FramePacing.h"
+#include "Core/JobSystem.h"
+#include "Input/Input.h"
+#include "Core/SimulationThread.h"
+#include "Graphics/GpuTimer.h"
+#include "Systems/RenderSnapshot.h"
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
 #ifdef _DEBUG
 #define new DBG_NEW       // <- redefine new AFTER all includes
 #endif
+
+namespace {
+    using SecondsF = std::chrono::duration<float>;
+
+    /// One frame's fixed steps; run inline, or on the SimulationThread when pipelined.
+    struct StepJob {
+        Core::UpdateFn update = nullptr;
+        SecondsF       step{};
+        SecondsF*      accumulator = nullptr;
+        int            maxSubSteps = 0;
+        int            subSteps = 0;
+    };
+
+    void RunSteps(void* data) {
+        StepJob& job = *static_cast<StepJob*>(data);
+        PROFILE_SCOPE("Core::Simulate");
+        job.subSteps = 0;
+        while (*job.accumulator >= job.step && job.subSteps < job.maxSubSteps) {
+            Framework::FramePacing::CountStep();
+            if (job.update) job.update(job.step.count());
+            *job.accumulator -= job.step;
+            ++job.subSteps;
+        }
+    }
+}
+
 Core::Core(int width, int height, const char* title, bool fullscreen)
     : m_Running(false),
     // create window immediately (unique_ptr ensures RAII cleanup)
@@ -43,23 +79,28 @@ void Core::Run() {
     if (init) init(*m_Window);
 
     auto t_prev = Clock::now();
-    //target simulation step (60 hz)
-    const SecondsF fixedStep{ 1.0f / 60.0f };
     // carry over leftover frame time
     SecondsF accumulator = SecondsF::zero();
-    // safety cap to avoid a spiral of death
-    constexpr int kMaxSubSteps = 5;
+    // simulation rate and vsync currently in effect (FramePacing may change them at runtime)
+    int appliedHz = 0;
+    bool appliedVSync = true;
+    // safety cap to avoid a spiral of death (5 steps at 60 Hz, scaled with the rate)
+    int maxSubSteps = 5;
     bool wasSuspended = false;
 
     while (m_Running && !m_Window->shouldClose()) {
         // Process input/events (keyboard, mouse, OS signals)
         m_Window->pollEvents();
+        // GLFW input must be read here on the main thread; the steps may run on the simulation thread
+        Framework::InputManager::SampleWindow(m_Window->raw());
 
         // Determine whether the application should be suspended.
        // Suspended when:
        //   • Window is iconified (minimized)   → IsIconified() == true
        //   • OR window has no focus (ALT-TAB, CTRL-ALT-DEL, Task Manager, etc.) → !HasFocus()
-        const bool suspended = m_Window->IsIconified() || !m_Window->HasFocus();
+        // A lockstep replay keeps running unattended in the background.
+        const bool suspended = !Framework::FramePacing::GetSettings().lockstep &&
+            (m_Window->IsIconified() || !m_Window->HasFocus());
 
         // -----------------------------------------------------------------------------
         // ENTERING SUSPENDED STATE
@@ -124,33 +165,83 @@ void Core::Run() {
 
         Framework::PerfFrameStart(frameDt, false);
 
-        // Accumulate elapsed time and step the simulation with a fixed timestep
-        accumulator += SecondsF{ frameDt };
-        int subSteps = 0;
-        while (accumulator >= fixedStep && subSteps < kMaxSubSteps) {
-            if (update) update(fixedStep.count());
-            accumulator -= fixedStep;
-            ++subSteps;
-        }
-
-        // Game/logic update
-        // Drop excess time if we hit the cap to prevent spiral of death
-        if (subSteps == kMaxSubSteps && accumulator > fixedStep) {
+        // Pick up simulation rate / vsync changes from the Perf window
+        const Framework::FramePacing::Settings pacing = Framework::FramePacing::GetSettings();
+        if (pacing.simulationHz != appliedHz) {
+            appliedHz = pacing.simulationHz;
+            m_FixedStep = SecondsF{ 1.0f / static_cast<float>(appliedHz) };
+            maxSubSteps = std::max(1, appliedHz / 12);
             accumulator = SecondsF::zero();
         }
+        if (pacing.vsync != appliedVSync) {
+            appliedVSync = pacing.vsync;
+            m_Window->SetVSync(appliedVSync);
+        }
+
+        // Snapshots are captured after every step while pipelining is enabled; a frame only
+        // pipelines once an earlier frame has published one to draw.
+        Framework::RenderSnapshot::SetCapturing(pacing.pipelined);
+        const bool pipelineFrame = pacing.pipelined && Framework::RenderSnapshot::Front().valid &&
+            pipelineGate && pipelineGate();
 
-        m_CurrentNumSteps = subSteps;
+        // Accumulate elapsed time and step the simulation with a fixed timestep
+        // (lockstep: exactly one step per frame, independent of the wall clock)
+        if (pacing.lockstep)
+            accumulator = m_FixedStep;
+        else
+            accumulator += SecondsF{ frameDt };
+        StepJob job{ update, m_FixedStep, &accumulator, maxSubSteps };
+        auto finishSteps = [&] {
+            // Drop excess time if we hit the cap to prevent spiral of death
+            if (job.subSteps == maxSubSteps && accumulator > m_FixedStep) {
+                accumulator = SecondsF::zero();
+            }
+            m_CurrentNumSteps = job.subSteps;
+            // Leftover time as a fraction of a step: how far the render is between the last two steps
+            Framework::FramePacing::SetFrameState(job.subSteps, accumulator / m_FixedStep);
+            if (Framework::RenderSnapshot::Capturing())
+                Framework::RenderSnapshot::Publish(Framework::FramePacing::InterpolationAlpha());
+        };
+
+        if (pipelineFrame) {
+            // Steps for this frame run while render() draws the previous frame's snapshot
+            Framework::SimulationThread::Kick(&RunSteps, &job);
+        } else {
+            RunSteps(&job);
+            finishSteps();
+        }
 
         // Rendering stage
-        m_Window->beginFrame();    // clear buffers, prepare GL state
-        ImGuiLayer::BeginFrame();  // start ImGui frame AFTER pollEvents and BEFORE user render
-        if (render) render();      // user drawing code
-        ImGuiLayer::EndFrame();    // draw ImGui last into the same framebuffer
-        m_Window->endFrame();      // flush GL commands
-        m_Window->swapBuffers();   // present frame to screen
+        {
+            PROFILE_SCOPE("Core::Render");
+            gfx::GpuTimer::BeginFrame(); // collect GPU pass times from earlier frames
+            m_Window->beginFrame();    // clear buffers, prepare GL state
+            ImGuiLayer::BeginFrame();  // start ImGui frame AFTER pollEvents and BEFORE user render
+            if (render) render();      // user drawing code
+            if (pipelineFrame) {
+                Framework::SimulationThread::Sync();   // no-op if RenderSystem already synced
+                finishSteps();
+            }
+            {
+                gfx::GpuTimer::Scope imguiTimer(gfx::GpuPass::ImGui);
+                ImGuiLayer::EndFrame();    // draw ImGui last into the same framebuffer
+            }
+            m_Window->endFrame();      // flush GL commands
+        }
+        {
+            PROFILE_SCOPE("Core::SwapBuffers");
+            m_Window->swapBuffers();   // present frame to screen
+        }
+        {
+            PROFILE_SCOPE("Core::FrameLimiter");
+            Framework::FramePacing::WaitForNextFrame(); // no-op unless a frame cap is set
+        }
+        Framework::FramePacing::EndFrame();
     }
 
     // Cleanup stage
+    Framework::SimulationThread::Shutdown();
+    Framework::JobSystem::Shutdown();
     if (shutdown) shutdown();
 }
 
@@ -7,9 +7,11 @@
             orderly frame flow:
              pollEvents → accumulate frame dt → fixed-step update → beginFrame →
              ImGui::BeginFrame → user render → ImGui::EndFrame → endFrame → swapBuffers.
-            The simulation advances using a 60 Hz fixed timestep (with a safety cap on
-            sub-steps) while the measured frame delta is still clamped (≤ 0.1s) to avoid
-            runaway accumulation after stalls.
+            The simulation advances using a fixed timestep (30/60/120 Hz, see FramePacing,
+            with a safety cap on sub-steps) while the measured frame delta is still clamped
+            (≤ 0.1s) to avoid runaway accumulation after stalls.
+            With pipelining on and the pipeline gate returning true, the fixed steps run on
+            the SimulationThread while render() draws the previous step's RenderSnapshot.
  \copyright
             All content ©2025 DigiPen Institute of Technology Singapore.
             All rights reserved.
@@ -28,6 +30,7 @@ public:
     using RenderFn = void(*)();             // Called every frame to draw
     using ShutdownFn = void(*)();             // Called once at shutdown
     using SuspendFn = void(*)(bool);         // Called when the app is suspended/resumed
+    using PipelineGateFn = bool(*)();        // May this frame simulate on the worker thread?
 
     /// \brief Create a windowed application core.
     Core(int width, int height, const char* title, bool fullscreen);
@@ -44,6 +47,8 @@ public:
         init = i; update = u; render = r; shutdown = s;
     }
     void SetSuspendCallback(SuspendFn s) { onSuspend = s; }
+    /// \brief Without a gate, frames never pipeline (render() must be able to draw from the snapshot).
+    void SetPipelineGate(PipelineGateFn g) { pipelineGate = g; }
     int GetCurrentNumSteps() const noexcept { return m_CurrentNumSteps; }
     float GetFixedDeltaSeconds() const noexcept { return m_FixedStep.count(); }
 
@@ -61,4 +66,5 @@ private:
     RenderFn   render{ nullptr };
     ShutdownFn shutdown{ nullptr };
     SuspendFn  onSuspend{ nullptr };
+    PipelineGateFn pipelineGate{ nullptr };
 };
@@ -0,0 +1,215 @@
+/*********************************************************************************************
+ \file      FramePacing.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements FramePacing: settings, the hybrid sleep/spin limiter and interval
+            statistics.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "FramePacing.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        constexpr double kMinSpinUs = 200.0;        // spin at least this long before a deadline
+
+        struct PacingState
+        {
+            FramePacing::Settings settings;
+
+            std::atomic<std::uint64_t> steps{ 0 };   // counted on the simulation thread when pipelined
+            int           subSteps = 0;
+            float         alpha = 0.0f;
+
+            Clock::time_point deadline{};
+            bool              haveDeadline = false;
+            double            sleepOvershootUs = 1000.0;   // pessimistic until measured
+
+            Clock::time_point lastPresent{};
+            bool              havePresent = false;
+            float             intervals[FramePacing::kHistory] = {};
+            std::size_t       head = 0;
+            std::size_t       count = 0;
+        };
+
+        PacingState& State()
+        {
+            static PacingState state;
+            return state;
+        }
+    }
+
+    FramePacing::Settings FramePacing::GetSettings()
+    {
+        return State().settings;
+    }
+
+    void FramePacing::SetSimulationHz(int hz)
+    {
+        State().settings.simulationHz = hz < 45 ? 30 : (hz < 90 ? 60 : 120);
+    }
+
+    void FramePacing::SetVSync(bool on)
+    {
+        State().settings.vsync = on;
+    }
+
+    void FramePacing::SetFrameCap(int fps)
+    {
+        PacingState& state = State();
+        state.settings.frameCap = std::max(0, fps);
+        state.haveDeadline = false;
+    }
+
+    void FramePacing::SetInterpolation(bool on)
+    {
+        State().settings.interpolate = on;
+    }
+
+    void FramePacing::SetPipelined(bool on)
+    {
+        State().settings.pipelined = on;
+    }
+
+    void FramePacing::SetLockstep(bool on)
+    {
+        State().settings.lockstep = on;
+    }
+
+    void FramePacing::CountStep()
+    {
+        State().steps.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::uint64_t FramePacing::StepCount()
+    {
+        return State().steps.load(std::memory_order_relaxed);
+    }
+
+    void FramePacing::SetFrameState(int subSteps, float alpha)
+    {
+        PacingState& state = State();
+        state.subSteps = subSteps;
+        state.alpha = std::clamp(alpha, 0.0f, 1.0f);
+    }
+
+    float FramePacing::InterpolationAlpha()
+    {
+        const PacingState& state = State();
+        return state.settings.interpolate ? state.alpha : 1.0f;
+    }
+
+    /*****************************************************************************************
+      \brief Deadlines advance by exactly one period so the cap does not drift. A frame that
+             overran by more than a whole period restarts the schedule from now instead of
+             rushing to catch up.
+    *****************************************************************************************/
+    void FramePacing::WaitForNextFrame()
+    {
+        PacingState& state = State();
+        if (state.settings.frameCap <= 0)
+        {
+            state.haveDeadline = false;
+            return;
+        }
+
+        const auto period = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1.0 / state.settings.frameCap));
+        Clock::time_point now = Clock::now();
+        if (!state.haveDeadline || state.deadline + period < now)
+            state.deadline = now;
+        state.deadline += period;
+        state.haveDeadline = true;
+
+        const auto spinWindow = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::micro>(std::max(kMinSpinUs, state.sleepOvershootUs * 1.5)));
+        if (state.deadline - now > spinWindow)
+        {
+            const auto requested = state.deadline - now - spinWindow;
+            std::this_thread::sleep_for(requested);
+            const Clock::time_point woke = Clock::now();
+            const double overshootUs = std::max(0.0,
+                std::chrono::duration<double, std::micro>((woke - now) - requested).count());
+            state.sleepOvershootUs += (overshootUs - state.sleepOvershootUs) * 0.1;
+            now = woke;
+        }
+        while (now < state.deadline)
+        {
+            std::this_thread::yield();
+            now = Clock::now();
+        }
+    }
+
+    void FramePacing::EndFrame()
+    {
+        PacingState& state = State();
+        const Clock::time_point now = Clock::now();
+        if (state.havePresent)
+        {
+            state.intervals[state.head] = std::chrono::duration<float, std::milli>(now - state.lastPresent).count();
+            state.head = (state.head + 1) % kHistory;
+            state.count = std::min(state.count + 1, kHistory);
+        }
+        state.lastPresent = now;
+        state.havePresent = true;
+    }
+
+    FramePacing::Stats FramePacing::GetStats()
+    {
+        const PacingState& state = State();
+        Stats stats;
+        stats.samples = state.count;
+        stats.subSteps = state.subSteps;
+        stats.alpha = state.alpha;
+        stats.sleepOvershootUs = state.sleepOvershootUs;
+        if (state.count == 0)
+            return stats;
+
+        double sum = 0.0;
+        for (std::size_t i = 0; i < state.count; ++i)
+        {
+            sum += state.intervals[i];
+            stats.worstMs = std::max(stats.worstMs, static_cast<double>(state.intervals[i]));
+        }
+        stats.avgMs = sum / static_cast<double>(state.count);
+
+        double variance = 0.0;
+        for (std::size_t i = 0; i < state.count; ++i)
+        {
+            const double d = state.intervals[i] - stats.avgMs;
+            variance += d * d;
+        }
+        stats.jitterMs = std::sqrt(variance / static_cast<double>(state.count));
+
+        stats.targetMs = state.settings.frameCap > 0 ? 1000.0 / state.settings.frameCap : stats.avgMs;
+        for (std::size_t i = 0; i < state.count; ++i)
+        {
+            if (state.intervals[i] > stats.targetMs * 1.5)
+                ++stats.longFrames;
+        }
+        return stats;
+    }
+
+    void FramePacing::CopyHistory(float (&out)[kHistory])
+    {
+        const PacingState& state = State();
+        for (std::size_t i = 0; i < kHistory; ++i)
+            out[i] = state.intervals[(state.head + i) % kHistory];
+    }
+}
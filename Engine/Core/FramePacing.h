@@ -0,0 +1,100 @@
+/*********************************************************************************************
+ \file      FramePacing.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Simulation rate, vsync and frame-cap settings for Core::Run, the frame limiter,
+            and frame pacing statistics.
+ \details   Core::Run reads GetSettings() at the top of every frame. The simulation steps at
+            30, 60 or 120 Hz regardless of the display. Rendering happens once per frame, and
+            with interpolation on it shows Transforms blended between the last two steps
+            (InterpolationAlpha(), see RenderInterpolation). A 144 Hz monitor therefore gets
+            144 distinct images from a 60 Hz simulation.
+
+            A frame cap (mainly for vsync off) can be set. WaitForNextFrame() sleeps until shortly
+            before the deadline and then spins the rest. The spin window tracks how late
+            sleep_for() has been waking up (an exponential average of the overshoot), so
+            coarse OS timers get a wider window instead of a missed deadline.
+
+            With pipelining on, Core runs the fixed steps for frame N+1 on the simulation
+            thread while the main thread draws frame N from the RenderSnapshot (see
+            SimulationThread). Core only engages it when the game's pipeline gate allows.
+
+            Lockstep (set by InputRecorder during a replay) runs exactly one fixed step per
+            frame whatever the wall clock says, and keeps running when the window loses
+            focus. A replayed session therefore simulates the same steps on any machine.
+
+            Stats are measured present to present, after the limiter. They cover the last
+            kHistory frames: mean, standard deviation (jitter), worst frame, and frames that
+            took more than 1.5x the target interval.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class FramePacing
+      \brief Static frame timing settings shared by Core (reader) and the editor (writer).
+    *****************************************************************************************/
+    class FramePacing
+    {
+    public:
+        static constexpr std::size_t kHistory = 240;
+
+        struct Settings
+        {
+            int  simulationHz = 60;     ///< 30, 60 or 120
+            bool vsync = true;
+            int  frameCap = 0;          ///< Frames per second when > 0; applied with or without vsync
+            bool interpolate = true;    ///< Blend Transforms between the last two steps
+            bool pipelined = false;     ///< Simulate on the worker thread while the main thread draws
+            bool lockstep = false;      ///< One fixed step per frame, never suspended (input replay)
+        };
+
+        struct Stats
+        {
+            std::size_t samples = 0;
+            double      avgMs = 0.0;
+            double      jitterMs = 0.0;     ///< Standard deviation of the frame interval
+            double      worstMs = 0.0;
+            unsigned    longFrames = 0;     ///< Intervals above 1.5x targetMs
+            double      targetMs = 0.0;     ///< Cap interval, or the average when uncapped
+            double      sleepOvershootUs = 0.0;
+            int         subSteps = 0;       ///< Fixed steps run in the last frame
+            float       alpha = 0.0f;       ///< Interpolation factor used for the last frame
+        };
+
+        static Settings GetSettings();
+        /// \a hz is snapped to the nearest of 30, 60 and 120.
+        static void SetSimulationHz(int hz);
+        static void SetVSync(bool on);
+        static void SetFrameCap(int fps);
+        static void SetInterpolation(bool on);
+        static void SetPipelined(bool on);
+        static void SetLockstep(bool on);
+
+        /// Core: one fixed step is about to run.
+        static void CountStep();
+        /// Fixed steps run since start; RenderInterpolation compares against it.
+        static std::uint64_t StepCount();
+
+        /// Core: record this frame's step count and leftover fraction of a step.
+        static void SetFrameState(int subSteps, float alpha);
+        /// Leftover fraction of a step in [0, 1]; 1 when interpolation is off.
+        static float InterpolationAlpha();
+
+        /// Core: sleep + spin until the frame-cap deadline (returns at once when uncapped).
+        static void WaitForNextFrame();
+        /// Core: record the present-to-present interval.
+        static void EndFrame();
+
+        static Stats GetStats();
+        /// Frame intervals in ms, oldest first.
+        static void CopyHistory(float (&out)[kHistory]);
+    };
+}
@@ -0,0 +1,225 @@
+/*********************************************************************************************
+ \file      JobSystem.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements JobSystem with long-lived std::threads, one shared index counter and a
+            pair of condition variables.
+ \details   A call is published under the mutex with a new generation number. Each worker
+            that wakes for it registers itself (`inside`) before reading the call, and the
+            caller only returns, or publishes the next call, once every index has finished
+            and `inside` is back to zero. A worker that wakes late therefore finds the index
+            counter exhausted and never runs an index of a later call with a stale fn.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Core/JobSystem.h"
+#include "Debug/Profiler.h"
+#include "Memory/FrameArena.h"
+#include "Memory/HeapCounter.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        struct PoolState
+        {
+            std::vector<std::thread> threads;
+            std::mutex               submitMutex;   // one Run() at a time
+            std::mutex               mutex;
+            std::condition_variable  wake;
+            std::condition_variable  done;
+
+            JobSystem::BatchFn       fn = nullptr;
+            void*                    data = nullptr;
+            std::size_t              count = 0;
+            std::atomic<std::size_t> next{ 0 };
+            std::size_t              finished = 0;  // indices run, under mutex
+            unsigned                 wanted = 0;    // workers asked to join this call
+            unsigned                 joined = 0;
+            unsigned                 inside = 0;    // workers currently reading this call
+            std::uint64_t            generation = 0;
+            bool                     quit = false;
+            std::exception_ptr       error;
+            std::uint64_t            allocations = 0;   // made by workers for this call, under mutex
+        };
+
+        PoolState& State()
+        {
+            static PoolState state;
+            return state;
+        }
+
+        unsigned DesiredWorkers()
+        {
+            const unsigned hw = std::thread::hardware_concurrency();
+            return hw > 1 ? hw - 1 : 0;
+        }
+
+        /// Run indices until the counter is exhausted. Returns how many ran.
+        std::size_t Drain(PoolState& state, JobSystem::BatchFn fn, void* data, std::size_t count)
+        {
+            std::size_t ran = 0;
+            for (std::size_t i = state.next.fetch_add(1, std::memory_order_relaxed); i < count;
+                i = state.next.fetch_add(1, std::memory_order_relaxed))
+            {
+                try
+                {
+                    fn(data, i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    if (!state.error)
+                        state.error = std::current_exception();
+                }
+                ++ran;
+            }
+            return ran;
+        }
+
+        void WorkerMain(unsigned index)
+        {
+            if (Profiler::kEnabled)
+                Profiler::SetThreadName("job " + std::to_string(index));
+            FrameArena arena;
+            FrameArena::ThreadScope arenaScope(arena);
+
+            PoolState& state = State();
+            std::uint64_t seen = 0;
+            std::unique_lock<std::mutex> lock(state.mutex);
+            for (;;)
+            {
+                state.wake.wait(lock, [&state, &seen] {
+                    return state.quit || (state.generation != seen && state.joined < state.wanted);
+                });
+                if (state.quit)
+                    return;
+
+                seen = state.generation;
+                ++state.joined;
+                ++state.inside;
+                JobSystem::BatchFn fn = state.fn;
+                void* data = state.data;
+                const std::size_t count = state.count;
+                lock.unlock();
+
+                arena.BeginFrame();
+                const std::uint64_t allocationsBefore = HeapCounter::ThreadAllocations();
+                const std::size_t ran = Drain(state, fn, data, count);
+                const std::uint64_t allocations = HeapCounter::ThreadAllocations() - allocationsBefore;
+
+                lock.lock();
+                state.finished += ran;
+                state.allocations += allocations;
+                --state.inside;
+                if (state.inside == 0 && state.finished == state.count)
+                    state.done.notify_all();
+            }
+        }
+
+        void StartWorkers(PoolState& state)
+        {
+            const unsigned workers = DesiredWorkers();
+            state.threads.reserve(workers);
+            for (unsigned i = 0; i < workers; ++i)
+                state.threads.emplace_back(WorkerMain, i + 1);
+        }
+    }
+
+    /*****************************************************************************************
+      \brief Publish the call, help drain it, then wait for the workers to let go of it.
+             Small calls (one index) and single-core machines run inline.
+    *****************************************************************************************/
+    unsigned JobSystem::Run(std::size_t count, BatchFn fn, void* data)
+    {
+        if (count == 0)
+            return 0;
+        if (count == 1 || DesiredWorkers() == 0)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                fn(data, i);
+            return 0;
+        }
+
+        PoolState& state = State();
+        std::lock_guard<std::mutex> submit(state.submitMutex);
+        unsigned wanted = 0;
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            if (state.threads.empty())
+            {
+                state.quit = false;
+                StartWorkers(state);
+            }
+            state.done.wait(lock, [&state] { return state.inside == 0; });
+
+            wanted = static_cast<unsigned>(std::min<std::size_t>(count - 1, state.threads.size()));
+            state.fn = fn;
+            state.data = data;
+            state.count = count;
+            state.next.store(0, std::memory_order_relaxed);
+            state.finished = 0;
+            state.wanted = wanted;
+            state.joined = 0;
+            state.error = nullptr;
+            state.allocations = 0;
+            ++state.generation;
+        }
+        state.wake.notify_all();
+
+        const std::size_t ran = Drain(state, fn, data, count);
+
+        std::exception_ptr error;
+        std::uint64_t workerAllocations = 0;
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.finished += ran;
+            state.done.wait(lock, [&state] { return state.inside == 0 && state.finished == state.count; });
+            state.wanted = 0;   // late wakers skip the finished call
+            std::swap(error, state.error);
+            workerAllocations = state.allocations;
+        }
+        HeapCounter::AddThreadAllocations(workerAllocations);   // count them in the caller's phase
+        if (error)
+            std::rethrow_exception(error);
+        return wanted;
+    }
+
+    unsigned JobSystem::WorkerCount()
+    {
+        return DesiredWorkers();
+    }
+
+    void JobSystem::Shutdown()
+    {
+        PoolState& state = State();
+        std::lock_guard<std::mutex> submit(state.submitMutex);
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.quit = true;
+        }
+        state.wake.notify_all();
+        for (std::thread& t : state.threads)
+        {
+            if (t.joinable())
+                t.join();
+        }
+        state.threads.clear();
+    }
+}
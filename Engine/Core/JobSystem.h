@@ -0,0 +1,55 @@
+/*********************************************************************************************
+ \file      JobSystem.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Persistent worker pool for splitting per-frame work into batches.
+ \details   ParallelFor(count, fn) runs fn(0) .. fn(count - 1) across the pool and the
+            calling thread, and returns once every index has run. The workers are created
+            on first use (hardware_concurrency() - 1 of them) and sleep on a condition
+            variable between calls, so a call costs a wake-up, not a thread start. That is
+            the difference from TaskGraph, which starts and joins its own threads and is
+            meant for one-off dependency graphs such as startup loading.
+
+            Indices are handed out one at a time from an atomic counter, so uneven batches
+            balance themselves. One ParallelFor runs at a time; a second caller waits for
+            the first. fn must not call ParallelFor itself. If fn throws, the remaining
+            indices still run and the first exception is rethrown to the caller.
+
+            Each worker binds its own FrameArena, rewound at the start of every call, and
+            names its profiler lane "job N". Heap allocations the workers make during a call
+            are credited to the caller's HeapCounter::ThreadAllocations().
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstddef>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class JobSystem
+      \brief Static fork/join pool shared by the systems (AiSystem batches).
+    *****************************************************************************************/
+    class JobSystem
+    {
+    public:
+        using BatchFn = void(*)(void* data, std::size_t index);
+
+        /// Run \a fn(\a data, i) for every i in [0, \a count). Returns the workers that took part.
+        static unsigned Run(std::size_t count, BatchFn fn, void* data);
+
+        /// Run \a fn(i) for every i in [0, \a count). \a fn is called by reference, without copies.
+        template <typename Fn>
+        static unsigned ParallelFor(std::size_t count, Fn& fn)
+        {
+            return Run(count, [](void* data, std::size_t index) { (*static_cast<Fn*>(data))(index); }, &fn);
+        }
+
+        /// Worker threads in the pool (0 on a single-core machine; everything then runs inline).
+        static unsigned WorkerCount();
+        /// Join the workers (Core::Run calls this before shutdown()).
+        static void Shutdown();
+    };
+}
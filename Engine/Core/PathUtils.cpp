@@ -11,6 +11,8 @@
               repo copy vs. copied build output).
             - Resolve relative asset/data paths against the discovered roots, with
               fallbacks for typical relative layouts.
+            - Cache the discovered roots and memoize resolved paths per root, counting
+              every filesystem query so the Perf overlay can show per-frame syscalls.
  \copyright
             All content  2025 DigiPen Institute of Technology Singapore.
             All rights reserved.
@@ -34,8 +36,12 @@
 #endif
 
 #include <array>
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
@@ -47,6 +53,43 @@ namespace Framework
 {
     namespace
     {
+        /// Number of filesystem queries issued by this module (exists, is_directory, ...).
+        std::atomic<std::uint64_t> gFsCalls{ 0 };
+        std::atomic<std::uint64_t> gCacheHits{ 0 };
+        std::atomic<std::uint64_t> gCacheMisses{ 0 };
+
+        /*************************************************************************************
+          \brief Cached root plus the relative paths already resolved against it.
+        *************************************************************************************/
+        struct RootCache
+        {
+            bool discovered = false;
+            std::filesystem::path root;
+            std::unordered_map<std::string, std::filesystem::path> resolved;
+        };
+
+        std::mutex gPathCacheMutex;
+        RootCache gAssetsCache;
+        RootCache gDataCache;
+        unsigned gRootGeneration = 0;
+
+        /*************************************************************************************
+          \brief Counted wrappers around std::filesystem queries.
+        *************************************************************************************/
+        bool PathExists(const std::filesystem::path& p)
+        {
+            ++gFsCalls;
+            std::error_code ec;
+            return std::filesystem::exists(p, ec);
+        }
+
+        bool IsExistingDirectory(const std::filesystem::path& p)
+        {
+            gFsCalls += 2;
+            std::error_code ec;
+            return std::filesystem::exists(p, ec) && std::filesystem::is_directory(p, ec);
+        }
+
         /*************************************************************************************
           \brief  Return the weakly canonical version of a path if possible.
 
@@ -55,6 +98,7 @@ namespace Framework
         *************************************************************************************/
         std::filesystem::path CanonicalIfPossible(const std::filesystem::path& p)
         {
+            ++gFsCalls;
             std::error_code ec;
             auto canonical = std::filesystem::weakly_canonical(p, ec);
             return ec ? p : canonical;
@@ -81,6 +125,7 @@ namespace Framework
         {
             namespace fs = std::filesystem;
             std::vector<fs::path> found;
+            ++gFsCalls; // current_path
             std::vector<fs::path> roots{ fs::current_path(), GetExecutableDir() };
             std::unordered_set<std::string> seen;
 
@@ -89,8 +134,7 @@ namespace Framework
                     if (p.empty())
                         return;
 
-                    std::error_code ec;
-                    if (!fs::exists(p, ec) || !fs::is_directory(p, ec))
+                    if (!IsExistingDirectory(p))
                         return;
 
                     auto canonical = CanonicalIfPossible(p);
@@ -145,10 +189,7 @@ namespace Framework
         *************************************************************************************/
         bool HasSubdirectory(const std::filesystem::path& root, const char* child)
         {
-            std::error_code ec;
-            auto candidate = root / child;
-            return std::filesystem::exists(candidate, ec)
-                && std::filesystem::is_directory(candidate, ec);
+            return IsExistingDirectory(root / child);
         }
 
         /*************************************************************************************
@@ -163,10 +204,7 @@ namespace Framework
         *************************************************************************************/
         bool HasSiblingDirectory(const std::filesystem::path& root, const char* sibling)
         {
-            std::error_code ec;
-            auto candidate = root.parent_path() / sibling;
-            return std::filesystem::exists(candidate, ec)
-                && std::filesystem::is_directory(candidate, ec);
+            return IsExistingDirectory(root.parent_path() / sibling);
         }
 
         /*************************************************************************************
@@ -259,14 +297,154 @@ namespace Framework
 
             for (const auto& candidate : candidates)
             {
-                std::error_code ec;
-                if (fs::exists(candidate, ec))
+                if (PathExists(candidate))
                     return CanonicalIfPossible(candidate);
             }
 
             // Fall back to either rel or root/rel if nothing exists yet.
             return root.empty() ? rel : (root / rel);
         }
+
+        /*************************************************************************************
+          \brief Probe the filesystem for the assets root (uncached, see FindAssetsRoot()).
+        *************************************************************************************/
+        std::filesystem::path DiscoverAssetsRoot()
+        {
+            namespace fs = std::filesystem;
+
+            auto candidates = CollectNearbyDirectories("assets");
+
+            // Pick the candidate that actually contains textures/fonts (likely the full repo
+            // assets directory). If none match the heuristic, fall back to the nearest one.
+            int bestScore = -1;
+            fs::path best;
+            for (const auto& c : candidates)
+            {
+                const int score = ScoreAssetsRoot(c);
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    best = c;
+                }
+            }
+
+            if (!best.empty())
+                return CanonicalIfPossible(best);
+
+            // Fallback: probe some common relative paths from the current directory.
+            static const char* rels[] = {
+                "assets",
+                "../assets",
+                "../../assets",
+                "../../../assets"
+            };
+
+            for (auto rel : rels)
+            {
+                fs::path candidate = rel;
+                if (IsExistingDirectory(candidate))
+                    return CanonicalIfPossible(candidate);
+            }
+
+            return {};
+        }
+
+        /*************************************************************************************
+          \brief Probe the filesystem for the Data_Files root (uncached, see FindDataFilesRoot()).
+
+          Strategy:
+          - Use CollectNearbyDirectories("Data_Files") to find all candidates.
+          - Score each candidate with ScoreDataFilesRoot(), preferring repo copies over
+            build copies (e.g. those adjacent to ".git" and "Engine").
+          - If no scored candidate is found, fall back to common relative layouts:
+            "Data_Files", "../Data_Files", "../../Data_Files", "../../../Data_Files".
+
+          \return Canonicalized Data_Files root path, or an empty path if nothing is found.
+        *************************************************************************************/
+        std::filesystem::path DiscoverDataFilesRoot()
+        {
+            namespace fs = std::filesystem;
+
+            auto candidates = CollectNearbyDirectories("Data_Files");
+
+            int bestScore = -1;
+            fs::path best;
+            for (const auto& c : candidates)
+            {
+                const int score = ScoreDataFilesRoot(c);
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    best = c;
+                }
+            }
+
+            if (!best.empty())
+                return CanonicalIfPossible(best);
+
+            static const char* rels[] = {
+                "Data_Files",
+                "../Data_Files",
+                "../../Data_Files",
+                "../../../Data_Files"
+            };
+
+            for (auto rel : rels)
+            {
+                fs::path candidate = rel;
+                if (IsExistingDirectory(candidate))
+                    return CanonicalIfPossible(candidate);
+            }
+
+            return {};
+        }
+
+        /*************************************************************************************
+          \brief Return the cached root, discovering it on first use.
+          \note  Caller must hold gPathCacheMutex.
+        *************************************************************************************/
+        const std::filesystem::path& CachedRoot(RootCache& cache, std::filesystem::path(*discover)())
+        {
+            if (!cache.discovered)
+            {
+                cache.root = discover();
+                cache.discovered = true;
+            }
+            return cache.root;
+        }
+
+        /*************************************************************************************
+          \brief Resolve \c relative through a root cache, memoizing the result.
+
+          The filesystem probing in ResolveAgainstRoot() runs outside the lock so parallel
+          loaders do not serialize on disk access; the first writer wins on insert.
+        *************************************************************************************/
+        std::filesystem::path ResolveCached(RootCache& cache,
+            std::filesystem::path(*discover)(),
+            const std::filesystem::path& relative,
+            std::string_view dirname)
+        {
+            std::string key = relative.generic_string();
+            std::filesystem::path root;
+            {
+                std::lock_guard<std::mutex> lock(gPathCacheMutex);
+                auto it = cache.resolved.find(key);
+                if (it != cache.resolved.end())
+                {
+                    ++gCacheHits;
+                    return it->second;
+                }
+                root = CachedRoot(cache, discover);
+            }
+
+            ++gCacheMisses;
+            std::filesystem::path resolved = ResolveAgainstRoot(root, relative, dirname);
+
+            std::lock_guard<std::mutex> lock(gPathCacheMutex);
+            if (cache.discovered && cache.root == root)
+                cache.resolved.emplace(std::move(key), resolved);
+            return resolved;
+        }
     } // anonymous namespace
 
     /*************************************************************************************
@@ -287,6 +465,7 @@ namespace Framework
     *************************************************************************************/
     std::filesystem::path GetExecutableDir()
     {
+        ++gFsCalls;
 #if defined(_WIN32)
         char buf[MAX_PATH] = {};
         GetModuleFileNameA(nullptr, buf, MAX_PATH);
@@ -331,102 +510,27 @@ namespace Framework
         (containing "Textures", "Fonts", etc.).
       - If no candidates pass the heuristic, fall back to a few common relative paths:
         "assets", "../assets", "../../assets", "../../../assets".
+      - The probe runs once; later calls return the cached root.
 
       \return Canonicalized assets root path, or an empty path if nothing is found.
     *************************************************************************************/
     std::filesystem::path FindAssetsRoot()
     {
-        namespace fs = std::filesystem;
-
-        auto candidates = CollectNearbyDirectories("assets");
-
-        // Pick the candidate that actually contains textures/fonts (likely the full repo
-        // assets directory). If none match the heuristic, fall back to the nearest one.
-        int bestScore = -1;
-        fs::path best;
-        for (const auto& c : candidates)
-        {
-            const int score = ScoreAssetsRoot(c);
-            if (score > bestScore)
-            {
-                bestScore = score;
-                best = c;
-            }
-        }
-
-        if (!best.empty())
-            return CanonicalIfPossible(best);
-
-        // Fallback: probe some common relative paths from the current directory.
-        static const char* rels[] = {
-            "assets",
-            "../assets",
-            "../../assets",
-            "../../../assets"
-        };
-
-        for (auto rel : rels)
-        {
-            fs::path candidate = rel;
-            std::error_code ec;
-            if (fs::exists(candidate, ec) && fs::is_directory(candidate, ec))
-                return CanonicalIfPossible(candidate);
-        }
-
-        return {};
+        std::lock_guard<std::mutex> lock(gPathCacheMutex);
+        return CachedRoot(gAssetsCache, &DiscoverAssetsRoot);
     }
 
     /*************************************************************************************
-      \brief Locate the "best" Data_Files root directory.
-
-      Strategy:
-      - Use CollectNearbyDirectories("Data_Files") to find all candidates.
-      - Score each candidate with ScoreDataFilesRoot(), preferring repo copies over
-        build copies (e.g. those adjacent to ".git" and "Engine").
-      - If no scored candidate is found, fall back to common relative layouts:
-        "Data_Files", "../Data_Files", "../../Data_Files", "../../../Data_Files".
-
+      \brief Locate the "best" Data_Files root directory (cached).
       \return Canonicalized Data_Files root path, or an empty path if nothing is found.
     *************************************************************************************/
     std::filesystem::path FindDataFilesRoot()
     {
-        namespace fs = std::filesystem;
-
-        auto candidates = CollectNearbyDirectories("Data_Files");
-
-        int bestScore = -1;
-        fs::path best;
-        for (const auto& c : candidates)
-        {
-            const int score = ScoreDataFilesRoot(c);
-            if (score > bestScore)
-            {
-                bestScore = score;
-                best = c;
-            }
-        }
-
-        if (!best.empty())
-            return CanonicalIfPossible(best);
-
-        static const char* rels[] = {
-            "Data_Files",
-            "../Data_Files",
-            "../../Data_Files",
-            "../../../Data_Files"
-        };
-
-        for (auto rel : rels)
-        {
-            fs::path candidate = rel;
-            std::error_code ec;
-            if (fs::exists(candidate, ec) && fs::is_directory(candidate, ec))
-                return CanonicalIfPossible(candidate);
-        }
-
-        return {};
+        std::lock_guard<std::mutex> lock(gPathCacheMutex);
+        return CachedRoot(gDataCache, &DiscoverDataFilesRoot);
     }
 
+
     /*************************************************************************************
       \brief Resolve an asset-relative path against the discovered assets root.
 
@@ -438,7 +542,7 @@ namespace Framework
     *************************************************************************************/
     std::filesystem::path ResolveAssetPath(const std::filesystem::path& relative)
     {
-        return ResolveAgainstRoot(FindAssetsRoot(), relative, "assets");
+        return ResolveCached(gAssetsCache, &DiscoverAssetsRoot, relative, "assets");
     }
 
     /*************************************************************************************
@@ -452,7 +556,50 @@ namespace Framework
     *************************************************************************************/
     std::filesystem::path ResolveDataPath(const std::filesystem::path& relative)
     {
-        return ResolveAgainstRoot(FindDataFilesRoot(), relative, "Data_Files");
+        return ResolveCached(gDataCache, &DiscoverDataFilesRoot, relative, "Data_Files");
+    }
+
+    /*************************************************************************************
+      \brief Re-check the roots and forget memoized paths of any root that moved.
+
+      Roots are rediscovered immediately. A root that resolves to the same directory
+      keeps its memoized paths; one that changed is replaced, its paths are rebuilt
+      lazily on the next Resolve*Path call, and the generation counter is bumped.
+    *************************************************************************************/
+    void InvalidatePathCache()
+    {
+        std::filesystem::path assets = DiscoverAssetsRoot();
+        std::filesystem::path data = DiscoverDataFilesRoot();
+
+        std::lock_guard<std::mutex> lock(gPathCacheMutex);
+        auto updateRoot = [](RootCache& cache, std::filesystem::path root)
+        {
+            if (cache.discovered && cache.root == root)
+                return false;
+            const bool moved = cache.discovered;
+            cache = RootCache{ true, std::move(root), {} };
+            return moved;
+        };
+        const bool assetsMoved = updateRoot(gAssetsCache, std::move(assets));
+        const bool dataMoved = updateRoot(gDataCache, std::move(data));
+        if (assetsMoved || dataMoved)
+            ++gRootGeneration;
+    }
+
+    /*************************************************************************************
+      \brief Snapshot the path cache counters.
+    *************************************************************************************/
+    PathCacheStats GetPathCacheStats()
+    {
+        PathCacheStats stats;
+        stats.fsCalls = gFsCalls.load();
+        stats.hits = gCacheHits.load();
+        stats.misses = gCacheMisses.load();
+
+        std::lock_guard<std::mutex> lock(gPathCacheMutex);
+        stats.cachedEntries = gAssetsCache.resolved.size() + gDataCache.resolved.size();
+        stats.rootGeneration = gRootGeneration;
+        return stats;
     }
 
       /*************************************************************************************
@@ -14,12 +14,18 @@
             These utilities allow the engine and editor to find resources reliably
             across different build configurations (Debug/Release), IDEs, and packaged
             game distributions without hardcoding absolute paths.
+
+            Roots are discovered once and resolved relative paths are memoized, so
+            per-frame callers pay a hash lookup instead of filesystem probing. Call
+            InvalidatePathCache() when the working directory or asset layout changes.
  \copyright
             All content  2025 DigiPen Institute of Technology Singapore.
             All rights reserved.
 *********************************************************************************************/
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <string_view>
 
@@ -64,6 +70,8 @@ namespace Framework
       - Simple scoring heuristics that prefer more "complete" assets roots (e.g.,
         those containing "Textures", "Fonts", etc.).
 
+      The result is cached after the first call; see InvalidatePathCache().
+
       \return Canonicalized path to the best candidate assets root, or an empty path.
     *************************************************************************************/
     std::filesystem::path FindAssetsRoot();
@@ -76,6 +84,8 @@ namespace Framework
       - Heuristics that prefer source-tree copies over build outputs (e.g., folders
         adjacent to ".git" or "Engine").
 
+      The result is cached after the first call; see InvalidatePathCache().
+
       \return Canonicalized path to the best candidate Data_Files root, or an empty path.
     *************************************************************************************/
     std::filesystem::path FindDataFilesRoot();
@@ -87,6 +97,8 @@ namespace Framework
       \c relative against that root and a few common relative layouts. The result is
       typically an absolute or canonicalized path suitable for file I/O.
 
+      Results are memoized per relative path until InvalidatePathCache() finds the root moved.
+
       \param relative Path relative to the assets hierarchy (e.g. "Textures/player.png").
       \return Resolved path to the asset, or a best-effort combination if no candidate exists.
     *************************************************************************************/
@@ -99,6 +111,8 @@ namespace Framework
       resolve \c relative against that root and a few common relative layouts. The
       result is typically an absolute or canonicalized path suitable for file I/O.
 
+      Results are memoized per relative path until InvalidatePathCache() finds the root moved.
+
       \param relative Path relative to the Data_Files hierarchy (e.g. "level1.json").
       \return Resolved path to the data file, or a best-effort combination if no candidate exists.
     *************************************************************************************/
@@ -116,4 +130,29 @@ namespace Framework
        \return Canonical path to a user-writable Documents directory.
      *************************************************************************************/
     std::filesystem::path GetUserDocumentsDir();
+
+    /*************************************************************************************
+      \brief Counters describing the path cache and the filesystem work behind it.
+    *************************************************************************************/
+    struct PathCacheStats
+    {
+        std::uint64_t fsCalls{};        //!< exists/is_directory/canonical/cwd queries issued
+        std::uint64_t hits{};           //!< Resolve*Path calls answered from the cache
+        std::uint64_t misses{};         //!< Resolve*Path calls that had to probe the disk
+        std::size_t   cachedEntries{};  //!< Memoized relative paths (assets + data)
+        unsigned      rootGeneration{}; //!< Bumped whenever a discovered root changes
+    };
+
+    /*************************************************************************************
+      \brief Rediscover the roots and drop the memoized paths of any root that changed.
+
+      Memoized paths are kept for a root that still resolves to the same directory. If
+      a root differs from the previous one, PathCacheStats::rootGeneration is incremented.
+    *************************************************************************************/
+    void InvalidatePathCache();
+
+    /*************************************************************************************
+      \brief Snapshot the path cache counters (thread-safe).
+    *************************************************************************************/
+    PathCacheStats GetPathCacheStats();
 }
\ No newline at end of file
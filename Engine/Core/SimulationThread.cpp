@@ -0,0 +1,172 @@
+/*********************************************************************************************
+ \file      SimulationThread.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements SimulationThread with one std::thread and a condition variable.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Core/SimulationThread.h"
+#include "Debug/Profiler.h"
+#include "Memory/FrameArena.h"
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        struct WorkerState
+        {
+            std::thread             thread;
+            std::mutex              mutex;
+            std::condition_variable wake;
+            std::condition_variable done;
+
+            SimulationThread::JobFn fn = nullptr;
+            void*                   data = nullptr;
+            bool                    pending = false;    // job handed over, not finished
+            bool                    inFlight = false;   // main thread: kicked, not synced
+            bool                    quit = false;
+            std::exception_ptr      error;
+
+            SimulationThread::Stats stats;
+        };
+
+        WorkerState& State()
+        {
+            static WorkerState state;
+            return state;
+        }
+
+        thread_local bool tIsSimulationThread = false;
+
+        void WorkerMain()
+        {
+            tIsSimulationThread = true;
+            Profiler::SetThreadName("simulation");
+            FrameArena arena;
+            FrameArena::ThreadScope arenaScope(arena);
+
+            WorkerState& state = State();
+            std::unique_lock<std::mutex> lock(state.mutex);
+            for (;;)
+            {
+                state.wake.wait(lock, [&state] { return state.pending || state.quit; });
+                if (state.quit)
+                    return;
+
+                SimulationThread::JobFn fn = state.fn;
+                void* data = state.data;
+                lock.unlock();
+
+                arena.BeginFrame();
+                const Clock::time_point start = Clock::now();
+                std::exception_ptr error;
+                try
+                {
+                    fn(data);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+                const double jobMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+                lock.lock();
+                state.error = error;
+                state.stats.jobMs = jobMs;
+                ++state.stats.jobs;
+                state.pending = false;
+                state.done.notify_one();
+            }
+        }
+    }
+
+    void SimulationThread::Kick(JobFn fn, void* data)
+    {
+        Sync();
+        WorkerState& state = State();
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (!state.thread.joinable())
+            {
+                state.quit = false;
+                state.thread = std::thread(WorkerMain);
+            }
+            state.fn = fn;
+            state.data = data;
+            state.pending = true;
+            state.inFlight = true;
+        }
+        state.wake.notify_one();
+    }
+
+    void SimulationThread::Sync()
+    {
+        WorkerState& state = State();
+        if (!state.inFlight)
+            return;
+
+        std::exception_ptr error;
+        {
+            const Clock::time_point start = Clock::now();
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.done.wait(lock, [&state] { return !state.pending; });
+            state.inFlight = false;
+            state.stats.waitMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            std::swap(error, state.error);
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    bool SimulationThread::InFlight()
+    {
+        return State().inFlight;
+    }
+
+    bool SimulationThread::IsSimulationThread()
+    {
+        return tIsSimulationThread;
+    }
+
+    SimulationThread::Stats SimulationThread::GetStats()
+    {
+        WorkerState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.stats;
+    }
+
+    void SimulationThread::Shutdown()
+    {
+        WorkerState& state = State();
+        try
+        {
+            Sync();
+        }
+        catch (...)
+        {
+            // Shutting down; a failed last step has nobody left to report to.
+        }
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.quit = true;
+        }
+        state.wake.notify_one();
+        if (state.thread.joinable())
+            state.thread.join();
+    }
+}
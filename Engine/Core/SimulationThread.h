@@ -0,0 +1,61 @@
+/*********************************************************************************************
+ \file      SimulationThread.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Persistent worker that runs a frame's fixed steps while the main thread renders.
+ \details   With pipelining on, Core::Run calls Kick() with the frame's simulation steps and
+            then renders the RenderSnapshot captured at the end of the previous frame's last
+            step. Sync() is the point after which the main thread may touch live game state
+            again. RenderSystem calls it once the world pass is submitted, and Core calls it
+            again after render(); the second call is a no-op.
+
+            Only one job is in flight at a time. The worker binds its own FrameArena, which it
+            rewinds once per job, and names its profiler lane "simulation". If the job throws,
+            the exception is rethrown from Sync() on the main thread.
+
+            GLFW is not called from the job. Core::Run samples the window into an InputSample
+            on the main thread right after pollEvents() and before Kick(), and InputSystem's
+            steps only consume that sample. GL work is kept off the worker too: see
+            Resource_Manager for how texture loads requested there are deferred.
+
+            Everything except IsSimulationThread() must be called from the main thread.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class SimulationThread
+      \brief Static single-job worker used by Core for pipelined frames.
+    *****************************************************************************************/
+    class SimulationThread
+    {
+    public:
+        using JobFn = void(*)(void*);
+
+        struct Stats
+        {
+            double        jobMs = 0.0;      ///< Worker time of the last job
+            double        waitMs = 0.0;     ///< Time the main thread blocked in the last Sync()
+            std::uint64_t jobs = 0;
+        };
+
+        /// Start \a fn(\a data) on the worker (created on first use). Syncs a job still in flight.
+        static void Kick(JobFn fn, void* data);
+        /// Wait for the job in flight, if any.
+        static void Sync();
+        /// True between Kick() and the Sync() that follows it.
+        static bool InFlight();
+        /// True on the worker thread.
+        static bool IsSimulationThread();
+
+        static Stats GetStats();
+        /// Join the worker (Core::Run calls this before shutdown()).
+        static void Shutdown();
+    };
+}
@@ -0,0 +1,293 @@
+/*********************************************************************************************
+ \file      TaskGraph.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements TaskGraph: dependency tracking, the worker pool, joining with
+            work-helping, and Chrome trace export of the recorded timeline.
+ \details   All scheduling state is guarded by a single mutex; task bodies run unlocked.
+            A finished task decrements the unmet-dependency count of its dependents and
+            queues any that reach zero. Waiting threads pull from the same ready queue, so
+            the owning thread contributes instead of idling at a join point.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "TaskGraph.h"
+#include "Debug/Profiler.h"
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+#include "../ThirdParty/json_dep/json.hpp"
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    TaskGraph::TaskGraph() : origin(Clock::now()) {}
+
+    /*****************************************************************************************
+      \brief Joins outstanding work so no worker outlives the tasks it references.
+    *****************************************************************************************/
+    TaskGraph::~TaskGraph()
+    {
+        if (started)
+            WaitAll();
+    }
+
+    TaskGraph::TaskId TaskGraph::Add(std::string name, std::string category,
+        std::function<void()> fn, std::vector<TaskId> deps)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (started)
+        {
+            std::cerr << "[TaskGraph] Add() after Start() is not supported: " << name << "\n";
+            return static_cast<TaskId>(-1);
+        }
+
+        const TaskId id = tasks.size();
+        Task task;
+        task.name = std::move(name);
+        task.category = std::move(category);
+        task.fn = std::move(fn);
+        for (TaskId dep : deps)
+        {
+            if (dep >= tasks.size())
+                continue;
+            tasks[dep].dependents.push_back(id);
+            ++task.unmetDeps;
+        }
+        tasks.push_back(std::move(task));
+        ++remaining;
+        return id;
+    }
+
+    void TaskGraph::Start(unsigned workerCount)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (started)
+                return;
+            started = true;
+            for (TaskId id = 0; id < tasks.size(); ++id)
+            {
+                if (tasks[id].unmetDeps == 0)
+                {
+                    tasks[id].state = State::Queued;
+                    ready.push_back(id);
+                }
+            }
+        }
+
+        if (workerCount == 0)
+        {
+            const unsigned hw = std::thread::hardware_concurrency();
+            workerCount = hw > 1 ? hw - 1 : 0;
+        }
+        workerCount = static_cast<unsigned>(std::min<std::size_t>(workerCount, tasks.size()));
+
+        workers.reserve(workerCount);
+        for (unsigned i = 0; i < workerCount; ++i)
+            workers.emplace_back(&TaskGraph::WorkerLoop, this, i + 1);
+    }
+
+    /*****************************************************************************************
+      \brief Execute one task with the lock released, then publish completion.
+      \param lock Held on entry and on return.
+    *****************************************************************************************/
+    void TaskGraph::RunTask(std::unique_lock<std::mutex>& lock, TaskId id, std::uint32_t threadIndex)
+    {
+        Task& task = tasks[id];
+        task.state = State::Running;
+        std::function<void()> fn = std::move(task.fn);
+
+        lock.unlock();
+        const Clock::time_point start = Clock::now();
+        {
+            PROFILE_SCOPE(Profiler::Intern(task.name));
+            try
+            {
+                if (fn)
+                    fn();
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "[TaskGraph] Task '" << task.name << "' threw: " << e.what() << "\n";
+            }
+            catch (...)
+            {
+                std::cerr << "[TaskGraph] Task '" << task.name << "' threw an unknown exception\n";
+            }
+        }
+        const Clock::time_point end = Clock::now();
+        lock.lock();
+
+        timeline.push_back({ task.name, task.category, threadIndex, ToUs(start), ToUs(end) });
+        task.state = State::Done;
+        --remaining;
+        for (TaskId dep : task.dependents)
+        {
+            Task& next = tasks[dep];
+            if (next.unmetDeps > 0 && --next.unmetDeps == 0 && next.state == State::Pending)
+            {
+                next.state = State::Queued;
+                ready.push_back(dep);
+            }
+        }
+        cv.notify_all();
+    }
+
+    void TaskGraph::WorkerLoop(std::uint32_t threadIndex)
+    {
+        if (Profiler::kEnabled)
+            Profiler::SetThreadName("worker " + std::to_string(threadIndex));
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;)
+        {
+            cv.wait(lock, [this] { return stopping || !ready.empty(); });
+            if (ready.empty())
+                return; // stopping and nothing left to pick up
+
+            const TaskId id = ready.front();
+            ready.pop_front();
+            RunTask(lock, id, threadIndex);
+        }
+    }
+
+    void TaskGraph::Wait(TaskId id)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (id >= tasks.size())
+            return;
+
+        while (tasks[id].state != State::Done)
+        {
+            if (!started)
+            {
+                lock.unlock();
+                Start();
+                lock.lock();
+                continue;
+            }
+
+            // Prefer the task being waited on; otherwise help with whatever is queued.
+            auto it = std::find(ready.begin(), ready.end(), id);
+            if (it == ready.end() && !ready.empty())
+                it = ready.begin();
+
+            if (it != ready.end())
+            {
+                const TaskId next = *it;
+                ready.erase(it);
+                RunTask(lock, next, 0);
+            }
+            else
+            {
+                cv.wait(lock);
+            }
+        }
+    }
+
+    void TaskGraph::WaitAll()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!started && tasks.empty())
+                return;
+        }
+
+        for (TaskId id = 0; id < tasks.size(); ++id)
+            Wait(id);
+        StopWorkers();
+    }
+
+    void TaskGraph::StopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (std::thread& t : workers)
+        {
+            if (t.joinable())
+                t.join();
+        }
+        workers.clear();
+    }
+
+    bool TaskGraph::IsDone(TaskId id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return id < tasks.size() && tasks[id].state == State::Done;
+    }
+
+    void TaskGraph::RecordSpan(std::string name, std::string category,
+        Clock::time_point start, Clock::time_point end)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        timeline.push_back({ std::move(name), std::move(category), 0u, ToUs(start), ToUs(end) });
+    }
+
+    std::vector<TaskGraph::TraceEvent> TaskGraph::Timeline() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return timeline;
+    }
+
+    double TaskGraph::ToUs(Clock::time_point t) const
+    {
+        return std::chrono::duration<double, std::micro>(t - origin).count();
+    }
+
+    /*****************************************************************************************
+      \brief Write complete ("ph":"X") events plus thread-name metadata so chrome://tracing
+             and Perfetto label the main thread and each worker.
+    *****************************************************************************************/
+    bool TaskGraph::WriteChromeTrace(const std::filesystem::path& file) const
+    {
+        const std::vector<TraceEvent> events = Timeline();
+
+        std::uint32_t maxThread = 0;
+        nlohmann::json traceEvents = nlohmann::json::array();
+        for (const TraceEvent& e : events)
+        {
+            maxThread = std::max(maxThread, e.thread);
+            traceEvents.push_back({
+                { "name", e.name },
+                { "cat", e.category },
+                { "ph", "X" },
+                { "ts", e.startUs },
+                { "dur", e.endUs - e.startUs },
+                { "pid", 1 },
+                { "tid", e.thread } });
+        }
+        for (std::uint32_t t = 0; t <= maxThread; ++t)
+        {
+            traceEvents.push_back({
+                { "name", "thread_name" },
+                { "ph", "M" },
+                { "pid", 1 },
+                { "tid", t },
+                { "args", { { "name", t == 0 ? std::string("main") : "worker " + std::to_string(t) } } } });
+        }
+
+        std::error_code ec;
+        if (file.has_parent_path())
+            std::filesystem::create_directories(file.parent_path(), ec);
+
+        std::ofstream out(file, std::ios::out | std::ios::trunc);
+        if (!out.is_open())
+        {
+            std::cerr << "[TaskGraph] Failed to open trace file: " << file.string() << "\n";
+            return false;
+        }
+        out << nlohmann::json{ { "traceEvents", traceEvents }, { "displayTimeUnit", "ms" } }.dump();
+        return static_cast<bool>(out);
+    }
+} // namespace Framework
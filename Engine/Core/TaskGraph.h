@@ -0,0 +1,147 @@
+/*********************************************************************************************
+ \file      TaskGraph.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Declares TaskGraph, a small dependency-aware worker pool used for startup loading.
+ \details   Tasks are registered up front with Add() (name, category, callable, dependencies)
+            and then executed by Start() on a fixed set of worker threads. The owning thread
+            can join a single task with Wait(id); while waiting it helps by running queued
+            tasks itself, so waiting never deadlocks even with zero workers.
+
+            Every task execution is recorded as a timeline span (thread, start, end). Owners
+            may add their own spans for work done outside the graph (e.g. GL uploads on the
+            main thread) with RecordSpan(). The timeline can be exported in the Chrome trace
+            event format (chrome://tracing, Perfetto) with WriteChromeTrace().
+
+            Threading contract:
+            - Add() must only be called before Start().
+            - Wait()/WaitAll()/RecordSpan() must be called from the thread that owns the graph.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class TaskGraph
+      \brief Runs a fixed set of tasks with dependencies on worker threads and records a
+             per-task timeline.
+    *****************************************************************************************/
+    class TaskGraph
+    {
+    public:
+        using TaskId = std::size_t;
+        using Clock = std::chrono::steady_clock;
+
+        /*************************************************************************************
+          \struct TraceEvent
+          \brief  One completed span on the timeline. Times are microseconds since the graph
+                  was constructed; thread 0 is the owning thread, 1..N are workers.
+        *************************************************************************************/
+        struct TraceEvent
+        {
+            std::string   name;
+            std::string   category;
+            std::uint32_t thread = 0;
+            double        startUs = 0.0;
+            double        endUs = 0.0;
+        };
+
+        TaskGraph();
+        ~TaskGraph();
+
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        /*************************************************************************************
+          \brief Register a task. Only valid before Start().
+          \param name     Label shown on the timeline (e.g. the asset file name).
+          \param category Group label (e.g. "texture", "sound", "prefab").
+          \param fn       Work to run; exceptions are caught and logged.
+          \param deps     Tasks that must finish before this one may start.
+          \return Id used with Wait()/IsDone().
+        *************************************************************************************/
+        TaskId Add(std::string name, std::string category, std::function<void()> fn,
+            std::vector<TaskId> deps = {});
+
+        /*************************************************************************************
+          \brief Spawn workers and begin executing ready tasks.
+          \param workerCount Number of worker threads; 0 picks hardware_concurrency() - 1.
+        *************************************************************************************/
+        void Start(unsigned workerCount = 0);
+
+        /*************************************************************************************
+          \brief Block until the given task has finished, running queued tasks meanwhile.
+        *************************************************************************************/
+        void Wait(TaskId id);
+
+        /*************************************************************************************
+          \brief Block until every task has finished, then stop the workers.
+        *************************************************************************************/
+        void WaitAll();
+
+        bool IsDone(TaskId id) const;
+        std::size_t TaskCount() const { return tasks.size(); }
+        unsigned WorkerCount() const { return static_cast<unsigned>(workers.size()); }
+
+        /*************************************************************************************
+          \brief Add a span for work the owning thread did outside the graph.
+        *************************************************************************************/
+        void RecordSpan(std::string name, std::string category,
+            Clock::time_point start, Clock::time_point end);
+
+        /*************************************************************************************
+          \brief Copy of all recorded spans, in completion order.
+        *************************************************************************************/
+        std::vector<TraceEvent> Timeline() const;
+
+        /*************************************************************************************
+          \brief Write the timeline as a Chrome trace JSON file.
+          \return True if the file was written.
+        *************************************************************************************/
+        bool WriteChromeTrace(const std::filesystem::path& file) const;
+
+    private:
+        enum class State { Pending, Queued, Running, Done };
+
+        struct Task
+        {
+            std::string           name;
+            std::string           category;
+            std::function<void()> fn;
+            std::vector<TaskId>   dependents;
+            std::size_t           unmetDeps = 0;
+            State                 state = State::Pending;
+        };
+
+        void WorkerLoop(std::uint32_t threadIndex);
+        void RunTask(std::unique_lock<std::mutex>& lock, TaskId id, std::uint32_t threadIndex);
+        void StopWorkers();
+        double ToUs(Clock::time_point t) const;
+
+        Clock::time_point        origin;
+        std::vector<Task>        tasks;
+        std::deque<TaskId>       ready;
+        std::vector<TraceEvent>  timeline;
+        std::vector<std::thread> workers;
+        std::size_t              remaining = 0;
+        bool                     started = false;
+        bool                     stopping = false;
+        mutable std::mutex       mutex;
+        std::condition_variable  cv;
+    };
+} // namespace Framework
@@ -13,6 +13,9 @@
               validate configuration without leaving the editor.
             - Triggers texture reloads when the spritesheet path is changed and supports
               seeding default animations when none exist.
+            - Edits the object's animation state machine (signals, states, transitions),
+              recompiling it on every change so instances pick it up live, and saves it back
+              to Data_Files/Animation.
  \copyright
             All content ? 2025 DigiPen Institute of Technology Singapore.
             All rights reserved.
@@ -24,9 +27,12 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cstdio>
+#include <string>
 #include <imgui.h>
 
+#include "Animation/AnimStateMachineLibrary.h"
 #include "Component/SpriteAnimationComponent.h"
 #include "Component/SpriteComponent.h"
 #include "Debug/Selection.h"
@@ -86,6 +92,250 @@ namespace
         ImGui::DragFloat("FPS", &anim.config.fps, 0.1f, 0.0f, 240.0f, "%.2f");
         ImGui::Checkbox("Looping", &anim.config.loop);
     }
+
+    //-----------------------------------------------------------------------------------------
+    /// \brief InputText over a std::string with a fixed-size scratch buffer.
+    //-----------------------------------------------------------------------------------------
+    bool InputString(const char* label, std::string& value)
+    {
+        std::array<char, 128> buffer{};
+        std::snprintf(buffer.data(), buffer.size(), "%s", value.c_str());
+        if (!ImGui::InputText(label, buffer.data(), buffer.size()))
+            return false;
+        value = buffer.data();
+        return true;
+    }
+
+    //-----------------------------------------------------------------------------------------
+    /// \brief Combo over the machine's states; \p allowAny adds "Any" (index -1) on top.
+    //-----------------------------------------------------------------------------------------
+    bool StateCombo(const char* label, const Framework::AnimStateMachineAsset& machine, int& index, bool allowAny)
+    {
+        const int count = static_cast<int>(machine.states.size());
+        const char* preview = index < 0 ? "Any" : (index < count ? machine.states[static_cast<std::size_t>(index)].name.c_str() : "?");
+        bool changed = false;
+        if (ImGui::BeginCombo(label, preview))
+        {
+            for (int i = allowAny ? -1 : 0; i < count; ++i)
+            {
+                const char* name = i < 0 ? "Any" : machine.states[static_cast<std::size_t>(i)].name.c_str();
+                if (ImGui::Selectable(name, i == index))
+                {
+                    index = i;
+                    changed = true;
+                }
+            }
+            ImGui::EndCombo();
+        }
+        return changed;
+    }
+
+    /// Remove bit \p bit from \p mask and shift the higher bits down one place.
+    std::uint32_t DropBit(std::uint32_t mask, std::size_t bit)
+    {
+        const std::uint32_t low = mask & ((1u << bit) - 1u);
+        return low | ((mask >> (bit + 1)) << bit);
+    }
+
+    //-----------------------------------------------------------------------------------------
+    /// \brief Edits the state machine named by the component. Every edit recompiles the
+    ///        shared asset, so all objects using it follow immediately.
+    //-----------------------------------------------------------------------------------------
+    void DrawStateMachine(SpriteAnimationComponent& animComponent)
+    {
+        using Framework::AnimStateMachineAsset;
+        using Framework::AnimStateMachineLibrary;
+
+        if (!ImGui::CollapsingHeader("State Machine"))
+            return;
+
+        if (InputString("Machine Id", animComponent.stateMachine))
+            animComponent.machine.Reset();
+
+        if (animComponent.stateMachine.empty())
+        {
+            ImGui::TextDisabled("No state machine; gameplay code picks the clips.");
+            return;
+        }
+
+        AnimStateMachineAsset* machine = AnimStateMachineLibrary::GetMutable(animComponent.stateMachine);
+        if (!machine)
+        {
+            ImGui::TextDisabled("Unknown machine (no file in Data_Files/Animation).");
+            return;
+        }
+
+        const auto& live = animComponent.machine;
+        if (live.Asset() == machine && live.State() >= 0 && live.State() < static_cast<int>(machine->states.size()))
+        {
+            std::string active;
+            for (std::size_t i = 0; i < machine->signals.size(); ++i)
+            {
+                if (live.LastSignals() & (1u << i))
+                    active += (active.empty() ? "" : ", ") + machine->signals[i];
+            }
+            ImGui::Text("State: %s   Signals: %s", machine->states[static_cast<std::size_t>(live.State())].name.c_str(),
+                active.empty() ? "-" : active.c_str());
+        }
+
+        bool changed = false;
+
+        // --- Signals ----------------------------------------------------------------------
+        ImGui::SeparatorText("Signals");
+        for (std::size_t i = 0; i < machine->signals.size(); ++i)
+        {
+            ImGui::PushID(static_cast<int>(i));
+            changed |= InputString("##signal", machine->signals[i]);
+            ImGui::SameLine();
+            if (ImGui::SmallButton("X"))
+            {
+                for (auto& transition : machine->transitions)
+                {
+                    transition.when = DropBit(transition.when, i);
+                    transition.unless = DropBit(transition.unless, i);
+                }
+                machine->signals.erase(machine->signals.begin() + static_cast<std::ptrdiff_t>(i));
+                changed = true;
+                ImGui::PopID();
+                break;
+            }
+            ImGui::PopID();
+        }
+        if (machine->signals.size() < AnimStateMachineAsset::kMaxSignals && ImGui::SmallButton("Add Signal"))
+        {
+            machine->signals.push_back("signal" + std::to_string(machine->signals.size()));
+            changed = true;
+        }
+
+        // --- States -----------------------------------------------------------------------
+        ImGui::SeparatorText("States");
+        const auto& clips = animComponent.animations;
+        for (std::size_t i = 0; i < machine->states.size(); ++i)
+        {
+            auto& state = machine->states[i];
+            ImGui::PushID(static_cast<int>(i) + 1000);
+            ImGui::SetNextItemWidth(120.0f);
+            changed |= InputString("##name", state.name);
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(120.0f);
+            if (ImGui::BeginCombo("##clip", state.clip.c_str()))
+            {
+                for (const auto& clip : clips)
+                {
+                    if (ImGui::Selectable(clip.name.c_str(), clip.name == state.clip))
+                    {
+                        state.clip = clip.name;
+                        changed = true;
+                    }
+                }
+                ImGui::EndCombo();
+            }
+            ImGui::SameLine();
+            if (machine->states.size() > 1 && ImGui::SmallButton("X"))
+            {
+                const int removed = static_cast<int>(i);
+                auto& transitions = machine->transitions;
+                transitions.erase(std::remove_if(transitions.begin(), transitions.end(),
+                    [removed](const AnimStateMachineAsset::Transition& t) { return t.from == removed || t.to == removed; }),
+                    transitions.end());
+                for (auto& transition : transitions)
+                {
+                    if (transition.from > removed) --transition.from;
+                    if (transition.to > removed) --transition.to;
+                }
+                if (machine->initialState >= removed && machine->initialState > 0)
+                    --machine->initialState;
+                machine->states.erase(machine->states.begin() + static_cast<std::ptrdiff_t>(i));
+                changed = true;
+                ImGui::PopID();
+                break;
+            }
+            ImGui::PopID();
+        }
+        if (machine->states.size() < AnimStateMachineAsset::kMaxStates && ImGui::SmallButton("Add State"))
+        {
+            const std::string name = "state" + std::to_string(machine->states.size());
+            machine->states.push_back({ name, clips.empty() ? name : clips.front().name, {}, {} });
+            changed = true;
+        }
+        changed |= StateCombo("Initial State", *machine, machine->initialState, false);
+
+        // --- Transitions (first match wins) ------------------------------------------------
+        ImGui::SeparatorText("Transitions (first match wins)");
+        static const char* kSignalModes[] = { "-", "on", "off" };
+        auto& transitions = machine->transitions;
+        for (std::size_t i = 0; i < transitions.size(); ++i)
+        {
+            auto& transition = transitions[i];
+            ImGui::PushID(static_cast<int>(i) + 2000);
+            ImGui::SetNextItemWidth(100.0f);
+            changed |= StateCombo("##from", *machine, transition.from, true);
+            ImGui::SameLine();
+            ImGui::TextUnformatted("->");
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(100.0f);
+            changed |= StateCombo("##to", *machine, transition.to, false);
+
+            for (std::size_t bit = 0; bit < machine->signals.size(); ++bit)
+            {
+                const std::uint32_t flag = 1u << bit;
+                int modeIndex = (transition.when & flag) ? 1 : ((transition.unless & flag) ? 2 : 0);
+                ImGui::PushID(static_cast<int>(bit));
+                ImGui::SetNextItemWidth(60.0f);
+                if (bit % 4 != 0)
+                    ImGui::SameLine();
+                if (ImGui::Combo(machine->signals[bit].c_str(), &modeIndex, kSignalModes, IM_ARRAYSIZE(kSignalModes)))
+                {
+                    transition.when = (transition.when & ~flag) | (modeIndex == 1 ? flag : 0u);
+                    transition.unless = (transition.unless & ~flag) | (modeIndex == 2 ? flag : 0u);
+                    changed = true;
+                }
+                ImGui::PopID();
+            }
+
+            if (i > 0 && ImGui::SmallButton("Up"))
+            {
+                std::swap(transitions[i], transitions[i - 1]);
+                changed = true;
+            }
+            ImGui::SameLine();
+            if (i + 1 < transitions.size() && ImGui::SmallButton("Down"))
+            {
+                std::swap(transitions[i], transitions[i + 1]);
+                changed = true;
+            }
+            ImGui::SameLine();
+            const bool remove = ImGui::SmallButton("Remove");
+            ImGui::Separator();
+            ImGui::PopID();
+            if (remove)
+            {
+                transitions.erase(transitions.begin() + static_cast<std::ptrdiff_t>(i));
+                changed = true;
+                break;
+            }
+        }
+        if (ImGui::SmallButton("Add Transition"))
+        {
+            transitions.push_back({});
+            changed = true;
+        }
+
+        if (changed)
+            machine->Compile();
+
+        if (machine->IsCompiled())
+            ImGui::TextDisabled("Compiled: %zu states x %zu signal combinations", machine->states.size(),
+                std::size_t{ 1 } << machine->signals.size());
+        else
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Does not compile (see log); instances are paused.");
+
+        if (ImGui::Button("Save Machine"))
+            AnimStateMachineLibrary::Save(*machine);
+        ImGui::SameLine();
+        if (ImGui::Button("Reload From Disk"))
+            AnimStateMachineLibrary::Reload();
+    }
 }
 
 namespace mygame
@@ -214,6 +464,9 @@ namespace mygame
             ImGui::TextDisabled("No texture loaded for this animation.");
         }
 
+        ImGui::Separator();
+        DrawStateMachine(*animComponent);
+
         ImGui::End();
     }
 }
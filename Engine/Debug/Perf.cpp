@@ -12,12 +12,34 @@
 #endif
 #include "Memory/GameObjectPool.h"
 #include "Memory/ObjectAllocator.h"
+#include "Memory/FrameArena.h"
+#include "Memory/HeapCounter.h"
+#include "Memory/AllocProfiler.h"
+#include "Debug/Profiler.h"
+#include "Core/FramePacing.h"
+#include "Core/SimulationThread.h"
+#include "Input/InputRecorder.h"
+#include "Memory/LevelArena.h"
+#include "Resource_Asset_Manager/Resource_Manager.h"
+#include "Core/PathUtils.h"
+#include "Resource_Asset_Manager/StartupPreloader.h"
+#include "Graphics/TextureCooker.h"
+#include "Graphics/GpuTimer.h"
+#include "Systems/HitBoxSystem.h"
+#include "Systems/AiSystem.h"
+#include "Systems/AnimationSystem.h"
+#include "Messaging_System/EventBus.h"
 #include <iostream>
+#include <mutex>
 #include <algorithm>   // std::max
 #include <cstddef>     // size_t
+#include <cfloat>      // FLT_MAX
+#include <cstdint>
+#include <cstdio>      // snprintf
 #include <numeric>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
@@ -44,6 +66,8 @@ namespace {
     };
     static std::vector<SystemTiming> gCurrSystemTimings;
     static std::vector<SystemTiming> gLastSystemTimings;
+    // UpdateAll runs on the simulation thread in pipelined frames while DrawAll records here.
+    static std::mutex gSystemTimingsMutex;
 
     void accumulateSystemTiming(std::vector<SystemTiming>& container, std::string_view name, double ms) {
 
@@ -74,6 +98,10 @@ namespace {
 
     static unsigned sLastAllocatorValidationIssues = 0;
 
+    // Filesystem queries issued by PathUtils, sampled at frame boundaries.
+    static std::uint64_t sFsCallsAtFrameStart = 0;
+    static std::uint64_t sLastFrameFsCalls = 0;
+
     inline float pushFpsSampleAndReturn(float dtSec) {
         sLastDtSec = dtSec;
         const float fpsNow = (dtSec > 1e-6f) ? (1.0f / dtSec) : 0.f;
@@ -100,6 +128,7 @@ namespace {
 void Framework::FlipFrame() {
     gLast = gCurr;     // promote current to last
     gCurr = Values{};  // clear current for fresh measurements
+    std::lock_guard<std::mutex> lock(gSystemTimingsMutex);
     gLastSystemTimings = gCurrSystemTimings;
     gCurrSystemTimings.clear();
 }
@@ -110,6 +139,7 @@ void Framework::setImGui(double ms) { gCurr.gImGuIMs = ms; }
 
 void Framework::RecordSystemTiming(std::string_view systemName, double milliseconds) {
     if (milliseconds < 0.0) return;
+    std::lock_guard<std::mutex> lock(gSystemTimingsMutex);
     accumulateSystemTiming(gCurrSystemTimings, systemName, milliseconds);
 }
 
@@ -140,7 +170,15 @@ void Framework::PerfFrameStart(float dt, bool toggleKeyDown) {
     sPrevToggleKey = toggleKeyDown;
 
     // Roll last/current buffers at the start of the frame
+    Framework::Profiler::BeginFrame();
     FlipFrame();
+    Framework::FrameArena::Instance().BeginFrame();
+    Framework::HeapCounter::EndFrame();
+    Framework::AllocProfiler::EndFrame();
+
+    const std::uint64_t fsCalls = Framework::GetPathCacheStats().fsCalls;
+    sLastFrameFsCalls = fsCalls - sFsCallsAtFrameStart;
+    sFsCallsAtFrameStart = fsCalls;
 
     // Store FPS sample for plot (OUR dt, not ImGui's)
     pushFpsSampleAndReturn(dt);
@@ -167,6 +205,10 @@ void Framework::DrawPerformanceWindow() {
     ImGui::Text("Engine FPS: %.1f (%.2f ms)   |   Avg: %.1f (%.2f ms over ~%d frames)",
         fpsNow, frameMs, sAvgFps, avgMs, sSamplesForAvg);
     ImGui::TextDisabled("Derived from Core dt (full frame), not ImGui.");
+
+    const auto frameStats = Framework::Profiler::GetFrameStats();
+    ImGui::Text("Frame time p50: %.2f ms | p95: %.2f ms | p99: %.2f ms | max: %.2f ms (%zu frames)",
+        frameStats.p50Ms, frameStats.p95Ms, frameStats.p99Ms, frameStats.maxMs, frameStats.frames);
     ImGui::Separator();
 
 
@@ -183,17 +225,203 @@ void Framework::DrawPerformanceWindow() {
     for (const auto& entry : gLastSystemTimings) {
         const double pctOfSystems = (totalSystemMs > 1e-9)
             ? (entry.milliseconds / totalSystemMs) * 100.0 : 0.0;
-        ImGui::Text("%s: %.3f ms (%.1f%% of systems)",
-            entry.name.c_str(), entry.milliseconds, pctOfSystems);
+        if (Framework::AllocProfiler::kEnabled) {
+            const auto allocs = Framework::AllocProfiler::LastFrame(entry.name);
+            ImGui::Text("%s: %.3f ms (%.1f%% of systems) | %llu allocs, %.1f KB",
+                entry.name.c_str(), entry.milliseconds, pctOfSystems,
+                static_cast<unsigned long long>(allocs.count), allocs.bytes / 1024.0);
+        }
+        else {
+            ImGui::Text("%s: %.3f ms (%.1f%% of systems)",
+                entry.name.c_str(), entry.milliseconds, pctOfSystems);
+        }
+    }
+
+    {
+        ImGui::SeparatorText("Frame Pacing");
+        using Framework::FramePacing;
+        const auto settings = FramePacing::GetSettings();
+
+        static const int kRates[] = { 30, 60, 120 };
+        static const char* kRateLabels[] = { "30 Hz", "60 Hz", "120 Hz" };
+        int rateIndex = settings.simulationHz == 30 ? 0 : (settings.simulationHz == 120 ? 2 : 1);
+        ImGui::SetNextItemWidth(100.0f);
+        if (ImGui::Combo("Simulation rate", &rateIndex, kRateLabels, IM_ARRAYSIZE(kRateLabels)))
+            FramePacing::SetSimulationHz(kRates[rateIndex]);
+
+        static const int kCaps[] = { 0, 30, 60, 120, 144, 240 };
+        static const char* kCapLabels[] = { "Uncapped", "30 FPS", "60 FPS", "120 FPS", "144 FPS", "240 FPS" };
+        int capIndex = 0;
+        for (int i = 0; i < IM_ARRAYSIZE(kCaps); ++i) {
+            if (kCaps[i] == settings.frameCap)
+                capIndex = i;
+        }
+        ImGui::SetNextItemWidth(100.0f);
+        if (ImGui::Combo("Frame cap", &capIndex, kCapLabels, IM_ARRAYSIZE(kCapLabels)))
+            FramePacing::SetFrameCap(kCaps[capIndex]);
+
+        bool vsync = settings.vsync;
+        if (ImGui::Checkbox("VSync", &vsync))
+            FramePacing::SetVSync(vsync);
+        ImGui::SameLine();
+        bool interpolate = settings.interpolate;
+        if (ImGui::Checkbox("Interpolate transforms", &interpolate))
+            FramePacing::SetInterpolation(interpolate);
+
+        bool pipelined = settings.pipelined;
+        if (ImGui::Checkbox("Pipelined simulation", &pipelined))
+            FramePacing::SetPipelined(pipelined);
+        if (pipelined) {
+            const auto sim = Framework::SimulationThread::GetStats();
+            ImGui::SameLine();
+            ImGui::TextDisabled("sim job: %.2f ms | main waited: %.2f ms | jobs: %llu",
+                sim.jobMs, sim.waitMs, static_cast<unsigned long long>(sim.jobs));
+        }
+
+        const auto pacing = FramePacing::GetStats();
+        ImGui::Text("Interval avg: %.2f ms | jitter: %.3f ms | worst: %.2f ms | long frames: %u / %zu",
+            pacing.avgMs, pacing.jitterMs, pacing.worstMs, pacing.longFrames, pacing.samples);
+        ImGui::TextDisabled("Steps last frame: %d | alpha: %.2f | sleep overshoot: %.0f us",
+            pacing.subSteps, pacing.alpha, pacing.sleepOvershootUs);
+
+        static float sIntervals[FramePacing::kHistory];
+        FramePacing::CopyHistory(sIntervals);
+        ImGui::PlotLines("Frame interval (ms)", sIntervals, IM_ARRAYSIZE(sIntervals),
+            0, nullptr, 0.0f, FLT_MAX, ImVec2(260, 50));
+    }
+
+    {
+        ImGui::SeparatorText("Input Record / Replay");
+        using Framework::InputRecorder;
+        const auto status = InputRecorder::GetStatus();
+        if (status.mode == InputRecorder::Mode::Off) {
+            ImGui::TextDisabled("Idle (launch with --record <file> or --replay <file>)");
+        }
+        else {
+            ImGui::Text("%s %s: %llu steps at %d Hz, level '%s'",
+                status.mode == InputRecorder::Mode::Recording ? "Recording" : "Replaying",
+                status.file.filename().string().c_str(), static_cast<unsigned long long>(status.steps),
+                status.simulationHz, status.level.c_str());
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Stop"))
+                InputRecorder::Stop();
+        }
+        const auto results = InputRecorder::LastResults();
+        if (results.valid) {
+            ImGui::Text("Last replay%s: %llu frames | avg %.2f | p95 %.2f | p99 %.2f | max %.2f ms",
+                results.completed ? "" : " (stopped)", static_cast<unsigned long long>(results.frames),
+                results.avgMs, results.p95Ms, results.p99Ms, results.maxMs);
+        }
+    }
+
+    {
+        ImGui::SeparatorText("CPU Profiler (PROFILE_SCOPE)");
+        if (!Framework::Profiler::kEnabled) {
+            ImGui::TextDisabled("Scopes compiled out (SOFASPUDS_ENABLE_PROFILER=OFF)");
+        }
+        else {
+            bool recording = Framework::Profiler::IsRecording();
+            if (ImGui::Checkbox("Record scopes", &recording))
+                Framework::Profiler::SetRecording(recording);
+
+            const auto capture = Framework::Profiler::GetCaptureStatus();
+            ImGui::SameLine();
+            if (capture.running) {
+                ImGui::Text("Capturing... %u frames left", capture.framesLeft);
+            }
+            else if (ImGui::Button("Capture 120 frames")) {
+                Framework::Profiler::BeginCapture(120, "logs/cpu_trace.json");
+            }
+            if (!capture.running && !capture.file.empty()) {
+                if (capture.written)
+                    ImGui::TextDisabled("%zu events in %s (open in chrome://tracing or Perfetto)",
+                        capture.events, capture.file.string().c_str());
+                else
+                    ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Could not write %s",
+                        capture.file.string().c_str());
+            }
+            if (const std::uint64_t dropped = Framework::Profiler::DroppedEvents())
+                ImGui::TextDisabled("Dropped events (lane full): %llu", static_cast<unsigned long long>(dropped));
+
+            const auto& events = Framework::Profiler::LastFrameEvents();
+            if (ImGui::TreeNode("lastFrameScopes", "Last frame, main thread (%zu scopes)", events.size())) {
+                constexpr std::size_t kMaxRows = 200;
+                for (std::size_t i = 0; i < events.size() && i < kMaxRows; ++i) {
+                    const auto& e = events[i];
+                    ImGui::Text("%*s%.*s: %.3f ms", static_cast<int>(e.depth * 2), "",
+                        static_cast<int>(e.name.size()), e.name.data(),
+                        static_cast<double>(e.endNs - e.startNs) / 1e6);
+                }
+                ImGui::TreePop();
+            }
+        }
+    }
+
+    {
+        ImGui::SeparatorText("GPU Passes (GL_TIME_ELAPSED)");
+        const auto gpu = gfx::GpuTimer::GetStats();
+        if (!gpu.available) {
+            ImGui::TextDisabled("Timer queries are not available on this driver.");
+        }
+        else {
+            ImGui::Text("GPU total: %.3f ms | CPU submit: render %.3f ms, ImGui %.3f ms",
+                gpu.totalMs, gLast.gRenderMs, gLast.gImGuIMs);
+            ImGui::TextDisabled("Results are %u frame(s) old | Stalls: %llu | Unbalanced frames: %llu",
+                gpu.latencyFrames, static_cast<unsigned long long>(gpu.stalls),
+                static_cast<unsigned long long>(gpu.unbalanced));
+
+            static float sGpuHistory[gfx::GpuTimer::kHistory];
+            gfx::GpuTimer::CopyTotalHistory(sGpuHistory);
+            ImGui::PlotLines("GPU total (ms)", sGpuHistory, IM_ARRAYSIZE(sGpuHistory),
+                0, nullptr, 0.0f, FLT_MAX, ImVec2(260, 50));
+            for (std::size_t p = 0; p < gfx::GpuTimer::kPassCount; ++p) {
+                const auto pass = static_cast<gfx::GpuPass>(p);
+                gfx::GpuTimer::CopyHistory(pass, sGpuHistory);
+                char label[64];
+                std::snprintf(label, sizeof(label), "%s: %.3f ms", gfx::GpuTimer::PassName(pass), gpu.passMs[p]);
+                ImGui::PlotLines(label, sGpuHistory, IM_ARRAYSIZE(sGpuHistory),
+                    0, nullptr, 0.0f, FLT_MAX, ImVec2(260, 30));
+            }
+        }
+    }
+
+    if (Framework::AllocProfiler::kEnabled) {
+        // Symbol lookups are slow; keep each stack once it has been expanded.
+        static std::unordered_map<std::uint64_t, std::vector<std::string>> sSymbolCache;
+        ImGui::SeparatorText("Allocation call sites (since reset)");
+        if (ImGui::Button("Reset call sites")) {
+            Framework::AllocProfiler::Reset();
+            sSymbolCache.clear();
+        }
+        if (const std::uint64_t dropped = Framework::AllocProfiler::DroppedSites()) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("%llu allocations missed the full site table",
+                static_cast<unsigned long long>(dropped));
+        }
+        for (const auto& site : Framework::AllocProfiler::TopCallSites(10)) {
+            ImGui::PushID(static_cast<int>(site.id ^ (site.id >> 32)));
+            const bool open = ImGui::TreeNode("site", "%s: %llu allocs, %.1f KB",
+                site.system.c_str(), static_cast<unsigned long long>(site.total.count),
+                site.total.bytes / 1024.0);
+            if (open) {
+                auto it = sSymbolCache.find(site.id);
+                if (it == sSymbolCache.end())
+                    it = sSymbolCache.emplace(site.id, Framework::AllocProfiler::Symbolize(site.id)).first;
+                for (const auto& frame : it->second)
+                    ImGui::TextUnformatted(frame.c_str());
+                ImGui::TreePop();
+            }
+            ImGui::PopID();
+        }
     }
 
     {
-        const auto& allocator = Framework::GameObjectPool::Storage().Allocator();
-        const OAStats stats = allocator.GetStats();
-        const OAConfig config = allocator.GetConfig();
+        const auto& storage = Framework::GameObjectPool::Storage();
+        const OAStats stats = storage.GetStats();
+        const OAConfig config = storage.Allocator().GetConfig();
 
         ImGui::SeparatorText("Allocator (GameObjectPool)");
-        ImGui::Text("Pages in use: %u | Objects in use: %u | Free objects: %u",
+        ImGui::Text("Pages in use: %u | Objects in use: %u | Free objects (incl. cached): %u",
             stats.PagesInUse_, stats.ObjectsInUse_, stats.FreeObjects_);
         ImGui::Text("Allocations: %u | Frees: %u | Most objects: %u",
             stats.Allocations_, stats.Deallocations_, stats.MostObjects_);
@@ -201,8 +429,24 @@ void Framework::DrawPerformanceWindow() {
             config.UseCPPMemManager_ ? "System new/delete" : "Custom pooled pages",
             config.UseCPPMemManager_ ? "true" : "false");
         ImGui::TextDisabled("Blocks are freed back to the pool; bytes remain for reuse.");
+
+        const auto goc = Framework::GameObjectPool::Storage().GetCacheStats();
+        const auto pools = Framework::ObjectAllocatorStorage::TotalCacheStats();
+        if (goc.threads == 0 && pools.threads == 0) {
+            ImGui::TextDisabled("Thread magazines: off (debug checks) or not used yet");
+        }
+        else {
+            ImGui::Text("GOC magazines: %u threads | %u blocks cached | depot %u",
+                goc.threads, goc.threadBlocks, goc.depotBlocks);
+            ImGui::Text("All pools (%u): %u thread magazines | %u blocks cached | depot %u",
+                pools.storages, pools.threads, pools.threadBlocks, pools.depotBlocks);
+            ImGui::Text("Refills: %llu from depot, %llu from pages | Batches returned: %llu",
+                static_cast<unsigned long long>(pools.depotRefills),
+                static_cast<unsigned long long>(pools.pageRefills),
+                static_cast<unsigned long long>(pools.returns));
+        }
         if (ImGui::Button("Validate Pages")) {
-            sLastAllocatorValidationIssues = allocator.ValidatePages(&allocatorValidationCallback);
+            sLastAllocatorValidationIssues = storage.ValidatePages(&allocatorValidationCallback);
         }
         if (sLastAllocatorValidationIssues > 0) {
             ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f),
@@ -211,8 +455,229 @@ void Framework::DrawPerformanceWindow() {
         else {
             ImGui::Text("Validation issues: %u", sLastAllocatorValidationIssues);
         }
+
+        static Framework::ObjectAllocatorStorage::BenchmarkResult sAllocBench{};
+        if (ImGui::Button("Run 1M alloc/free cycles"))
+            sAllocBench = Framework::ObjectAllocatorStorage::RunBenchmark(1000000, 4096, 96);
+        if (sAllocBench.cycles > 0) {
+            ImGui::Text("Release: %.2f ns/cycle (%.2f ms) | Debug checks: %.2f ns/cycle",
+                sAllocBench.releaseNsPerCycle, sAllocBench.releaseMs, sAllocBench.debugNsPerCycle);
+            ImGui::TextDisabled("%u-object bursts, shuffled frees, %u pages", sAllocBench.burst, sAllocBench.pages);
+        }
     }
 
+    {
+        const auto arena = Framework::FrameArena::Instance().GetStats();
+        const auto allocs = Framework::HeapCounter::LastFrame();
+        const auto check = Framework::HeapCounter::Check();
+        ImGui::SeparatorText("Frame / Level Arenas");
+        ImGui::Text("Arena last frame: %.1f KB of %.1f KB | High water: %.1f KB | Heap spills: %zu",
+            arena.lastFrameBytes / 1024.0, arena.capacity / 1024.0, arena.highWaterBytes / 1024.0,
+            arena.lastFrameSpills);
+#if SOFASPUDS_ENABLE_HEAP_COUNTER
+        ImGui::Text("Heap allocations last frame: %llu in UpdateAll | %llu in DrawAll",
+            static_cast<unsigned long long>(allocs.update), static_cast<unsigned long long>(allocs.draw));
+        if (ImGui::Button("Check zero allocations (300 frames)"))
+            Framework::HeapCounter::ExpectZeroAllocations(300);
+#else
+        (void)allocs;
+        ImGui::TextDisabled("Heap allocation counting is off (SOFASPUDS_ENABLE_HEAP_COUNTER)");
+#endif
+        if (check.armed) {
+            ImGui::SameLine();
+            ImGui::Text("Checking... %u frames, %u allocated", check.framesChecked, check.framesFailed);
+        }
+        else if (check.finished && check.framesFailed > 0) {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f),
+                "FAILED: %u of %u frames allocated (worst %llu, see console)", check.framesFailed,
+                check.framesChecked, static_cast<unsigned long long>(check.worstFrame));
+        }
+        else if (check.finished) {
+            ImGui::Text("Passed: %u frames without a heap allocation", check.framesChecked);
+        }
+        ImGui::TextDisabled("Hide the editor first; ImGui panels allocate while drawing.");
+
+        const auto level = Framework::LevelArena::Instance().GetStats();
+        ImGui::Text("Level arena: %.1f KB used of %.1f KB in %zu chunk(s) | Live blocks: %zu",
+            level.usedBytes / 1024.0, level.reservedBytes / 1024.0, level.chunks, level.liveBlocks);
+        ImGui::Text("Level releases: %llu | Retired (blocks outlived the level): %llu, %zu still held (%.1f KB)",
+            static_cast<unsigned long long>(level.releases),
+            static_cast<unsigned long long>(level.deferredReleases),
+            level.retiredArenas, level.retiredBytes / 1024.0);
+    }
+
+    {
+        const auto paths = Framework::GetPathCacheStats();
+        ImGui::SeparatorText("Path Cache (PathUtils)");
+        ImGui::Text("FS syscalls last frame: %llu | total: %llu",
+            static_cast<unsigned long long>(sLastFrameFsCalls),
+            static_cast<unsigned long long>(paths.fsCalls));
+        ImGui::Text("Cached paths: %zu | Hits: %llu | Misses: %llu | Root generation: %u",
+            paths.cachedEntries,
+            static_cast<unsigned long long>(paths.hits),
+            static_cast<unsigned long long>(paths.misses),
+            paths.rootGeneration);
+        if (ImGui::Button("Invalidate Path Cache"))
+            Framework::InvalidatePathCache();
+    }
+
+    {
+        Resource_Manager::RecountReferences();
+        const auto report = Resource_Manager::GetMemoryReport();
+        constexpr double kMB = 1024.0 * 1024.0;
+
+        ImGui::SeparatorText("Texture Memory (Resource_Manager)");
+        const float fill = report.budgetBytes
+            ? static_cast<float>(static_cast<double>(report.residentBytes) / static_cast<double>(report.budgetBytes))
+            : 0.0f;
+        char overlay[64];
+        std::snprintf(overlay, sizeof(overlay), "%.1f / %.1f MB",
+            report.residentBytes / kMB, report.budgetBytes / kMB);
+        ImGui::ProgressBar(std::min(fill, 1.0f), ImVec2(260, 0), overlay);
+        ImGui::Text("Resident: %u | Referenced: %u | Pinned: %u | Evicted: %u",
+            report.residentTextures, report.referencedTextures,
+            report.pinnedTextures, report.evictedTextures);
+        ImGui::Text("Peak: %.1f MB | Evictions: %llu (%.1f MB) | Reloads: %llu",
+            report.peakResidentBytes / kMB,
+            static_cast<unsigned long long>(report.evictionsTotal),
+            report.bytesEvictedTotal / kMB,
+            static_cast<unsigned long long>(report.reloadsTotal));
+
+        const std::size_t saved = report.rgba8ResidentBytes - std::min(report.rgba8ResidentBytes, report.residentBytes);
+        ImGui::Text("Compressed: %u | As RGBA8: %.1f MB | Saved: %.1f MB",
+            report.compressedTextures, report.rgba8ResidentBytes / kMB, saved / kMB);
+        if (!report.levelName.empty()) {
+            ImGui::Text("Level '%s': %.1f MB resident, %.1f MB saved by compression",
+                report.levelName.c_str(), report.levelResidentBytes / kMB, report.levelSavedBytes / kMB);
+        }
+
+        int budgetMb = static_cast<int>(Resource_Manager::GetTextureBudget() / (1024 * 1024));
+        if (ImGui::SliderInt("Budget (MB)", &budgetMb, 16, 2048))
+            Resource_Manager::SetTextureBudget(static_cast<std::size_t>(budgetMb) * 1024 * 1024);
+        if (ImGui::Button("Evict Unreferenced"))
+            Resource_Manager::EvictUnreferenced();
+    }
+
+    {
+        const auto cook = gfx::TextureCooker::lastReport();
+        constexpr double kMB = 1024.0 * 1024.0;
+        ImGui::SeparatorText("Texture Cook");
+        ImGui::Text("Encoder: %s", gfx::TextureCooker::encoderAvailable() ? "BC7 (bc7enc)" : "none, cooking RGBA8 + mips");
+        if (cook.cooked + cook.upToDate + cook.failed > 0) {
+            ImGui::Text("Last run: %zu cooked | %zu up to date | %zu failed | %.0f ms on %u workers",
+                cook.cooked, cook.upToDate, cook.failed, cook.wallMs, cook.workers);
+            ImGui::Text("Cooked size: %.1f MB (RGBA8 + mips: %.1f MB)",
+                cook.cookedBytes / kMB, cook.rgba8Bytes / kMB);
+        }
+        static bool sForceCook = false;
+        if (ImGui::Button("Cook Textures"))
+            gfx::TextureCooker::cookDirectory(Framework::ResolveAssetPath("Textures"), sForceCook);
+        ImGui::SameLine();
+        ImGui::Checkbox("Force", &sForceCook);
+        ImGui::TextDisabled("Cooked textures are used the next time a texture is loaded.");
+    }
+
+    {
+        static Framework::HitBoxSystem::StressResult sStress{};
+        ImGui::SeparatorText("Combat Stress");
+        if (ImGui::Button("Run 1000 projectiles vs 500 enemies"))
+            sStress = Framework::HitBoxSystem::RunStressBenchmark(1000, 500, 120);
+        if (sStress.updates > 0) {
+            ImGui::Text("Grid: %.3f ms/update | Linear: %.3f ms/update (%.1fx) | Hits: %zu",
+                sStress.gridMs, sStress.linearMs,
+                sStress.gridMs > 1e-9 ? sStress.linearMs / sStress.gridMs : 0.0, sStress.hits);
+        }
+    }
+
+    {
+        const auto anim = Framework::AnimationSystem::LastFrameStats();
+        ImGui::SeparatorText("Animation");
+        ImGui::Text("Animated: %zu | Sheet clips: %zu | UV table: %zu rects in %zu layouts",
+            anim.animated, anim.sheets, anim.uvRects, anim.layouts);
+        ImGui::Text("Gather: %.3f ms | Advance: %.3f ms | Publish: %.3f ms",
+            anim.gatherMs, anim.advanceMs, anim.publishMs);
+    }
+
+    {
+        static Framework::EventBus::BenchmarkResult sBusBench{};
+        const auto& flush = Framework::EventBus::Instance().LastFlush();
+        ImGui::SeparatorText("Event Bus");
+        ImGui::Text("Last flush: %zu events | %.3f ms", flush.events, flush.ms);
+        if (ImGui::Button("Run 100k events x 4 subscribers"))
+            sBusBench = Framework::EventBus::RunBenchmark(100000, 60, 4);
+        if (sBusBench.frames > 0) {
+            ImGui::Text("Publish: %.3f ms/frame | Queued: %.3f ms/frame | MessageBus: %.3f ms/frame",
+                sBusBench.publishMs, sBusBench.queuedMs, sBusBench.legacyMs);
+            ImGui::Text("Queue growth after warm-up: %zu bytes", sBusBench.steadyGrowthBytes);
+        }
+    }
+
+    {
+        const auto ai = Framework::AiSystem::LastFrameStats();
+        static Framework::AiSystem::StressResult sAiStress{};
+        ImGui::SeparatorText("AI");
+        ImGui::Text("Enemies: %zu | Walls: %zu | Batches: %zu on %u workers",
+            ai.enemies, ai.walls, ai.batches, ai.workers);
+        ImGui::Text("Blackboard: %.3f ms | Trees: %.3f ms | Attacks: %.3f ms",
+            ai.blackboardMs, ai.evaluateMs, ai.applyMs);
+        auto& lod = Framework::AiSystem::LodSettings();
+        ImGui::Checkbox("AI LOD", &lod.enabled);
+        if (lod.enabled) {
+            ImGui::Text("Near: %zu every tick | Far: %zu of %zu this tick | %.2f us/tree",
+                ai.nearCount, ai.farEvaluated, ai.farCount, ai.usPerTree);
+            float budget = static_cast<float>(lod.budgetUs);
+            if (ImGui::SliderFloat("Tree budget (us)", &budget, 50.0f, 5000.0f, "%.0f"))
+                lod.budgetUs = budget;
+            ImGui::SliderInt("Far interval (ticks)", &lod.farInterval, 1, 16);
+            ImGui::SliderFloat("Near radius", &lod.nearRadius, 0.25f, 8.0f, "%.2f");
+        }
+        if (ImGui::Button("Run 1000 enemies"))
+            sAiStress = Framework::AiSystem::RunStressBenchmark(1000, 200, 120);
+        ImGui::SameLine();
+        if (ImGui::Button("Run 8000 enemies"))
+            sAiStress = Framework::AiSystem::RunStressBenchmark(8000, 200, 60);
+        if (sAiStress.updates > 0) {
+            ImGui::Text("%zu enemies: inline %.3f ms/update | batched %.3f ms/update on %u workers",
+                sAiStress.enemies, sAiStress.serialMs, sAiStress.batchedMs, sAiStress.workers);
+            ImGui::Text("LOD floor: %.3f ms/update (%.0f trees/update)",
+                sAiStress.lodMs, sAiStress.lodEvaluated);
+        }
+
+        static std::vector<Framework::AiSystem::NavBenchResult> sNavBench;
+        ImGui::Text("Navigation: %zu cells | %zu reachable | %.3f ms%s",
+            ai.navCells, ai.navReachable, ai.navMs, ai.navFieldRebuilt ? " (field rebuilt)" : "");
+        if (ImGui::Button("Run nav benchmark (500 chasers)"))
+            sNavBench = Framework::AiSystem::RunNavBenchmark(500);
+        for (const auto& nav : sNavBench) {
+            ImGui::Text("%s: %zu cells | build %.3f ms | shared field %.3f ms + steer %.3f ms | per-chaser %.2f ms",
+                nav.level.c_str(), nav.cells, nav.buildMs, nav.fieldMs, nav.steerMs, nav.perAgentMs);
+        }
+    }
+
+    {
+        const auto startup = Framework::StartupPreloader::GetReport();
+        ImGui::SeparatorText("Startup Preload");
+        if (!startup.started) {
+            ImGui::TextDisabled("Startup preloading was not used.");
+        }
+        else {
+            ImGui::Text("Tasks: %zu textures | %zu sounds | %zu prefab files on %u workers",
+                startup.textureTasks, startup.soundTasks, startup.jsonTasks, startup.workers);
+            if (startup.finished) {
+                const double overlap = (startup.wallMs > 1e-6) ? startup.taskMs / startup.wallMs : 0.0;
+                ImGui::Text("Init wall: %.1f ms | Preload work: %.1f ms (%.2fx overlap)",
+                    startup.wallMs, startup.taskMs, overlap);
+                ImGui::Text("Unclaimed results: %zu", startup.unclaimed);
+            }
+            static bool sTraceWritten = false;
+            if (ImGui::Button("Dump Startup Trace"))
+                sTraceWritten = Framework::StartupPreloader::DumpTrace("logs/startup_trace.json");
+            if (sTraceWritten) {
+                ImGui::SameLine();
+                ImGui::TextDisabled("logs/startup_trace.json (open in chrome://tracing)");
+            }
+        }
+    }
 
     // Last ~120 FPS samples
     ImGui::Separator();
@@ -0,0 +1,362 @@
+/*********************************************************************************************
+ \file      Profiler.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements Profiler: per-thread event rings, frame draining, percentiles and the
+            Chrome trace writer.
+ \details   A lane is a single-producer/single-consumer ring. The owning thread advances
+            `head`, and BeginFrame() on the main thread advances `tail`. When a thread exits,
+            its lane is released. Once drained, the lane is handed to the next new thread,
+            so short-lived TaskGraph workers (startup loading, texture cooking) reuse lanes
+            instead of adding one per run. The registry mutex is only taken to claim a lane and to drain.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Debug/Profiler.h"
+#include "Common/StringId.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include "../ThirdParty/json_dep/json.hpp"
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        constexpr std::uint32_t kLaneCapacity = 8192;       // events per thread; power of two
+        constexpr std::size_t   kFrameHistory = 1024;
+
+        const Clock::time_point gEpoch = Clock::now();
+
+        std::int64_t NowNs()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - gEpoch).count();
+        }
+
+        struct Lane
+        {
+            std::atomic<std::uint32_t> head{ 0 };           // written by the owner
+            std::atomic<std::uint32_t> tail{ 0 };           // written by the drain
+            std::atomic<bool>          owned{ false };
+            std::atomic<std::uint64_t> dropped{ 0 };
+            std::uint32_t              index = 0;
+            std::string                name;                // guarded by Registry::mutex
+            Profiler::Event            events[kLaneCapacity];
+        };
+
+        struct Registry
+        {
+            std::mutex                         mutex;
+            std::vector<std::unique_ptr<Lane>> lanes;
+        };
+
+        Registry& GetRegistry()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        /// Releases the lane when its thread exits.
+        struct LaneHandle
+        {
+            Lane* lane = nullptr;
+            ~LaneHandle()
+            {
+                if (lane)
+                    lane->owned.store(false, std::memory_order_release);
+            }
+        };
+
+        thread_local LaneHandle    tLane;
+        thread_local std::uint32_t tDepth = 0;
+
+        std::atomic<bool> gRecording{ true };
+
+        Lane& ThisLane()
+        {
+            if (tLane.lane)
+                return *tLane.lane;
+
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (auto& lane : registry.lanes)
+            {
+                const bool drained = lane->head.load(std::memory_order_acquire) == lane->tail.load(std::memory_order_acquire);
+                if (!lane->owned.load(std::memory_order_acquire) && drained)
+                {
+                    tLane.lane = lane.get();
+                    break;
+                }
+            }
+            if (!tLane.lane)
+            {
+                registry.lanes.push_back(std::make_unique<Lane>());
+                tLane.lane = registry.lanes.back().get();
+                tLane.lane->index = static_cast<std::uint32_t>(registry.lanes.size() - 1);
+            }
+            tLane.lane->owned.store(true, std::memory_order_release);
+            tLane.lane->name = "thread " + std::to_string(tLane.lane->index);
+            return *tLane.lane;
+        }
+
+        void Push(Lane& lane, const Profiler::Event& e)
+        {
+            const std::uint32_t h = lane.head.load(std::memory_order_relaxed);
+            if (h - lane.tail.load(std::memory_order_acquire) >= kLaneCapacity)
+            {
+                lane.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            lane.events[h & (kLaneCapacity - 1)] = e;
+            lane.head.store(h + 1, std::memory_order_release);
+        }
+
+        struct FrameState
+        {
+            std::int64_t                frameStartNs = -1;
+            Lane*                       mainLane = nullptr;
+            std::vector<Profiler::Event> lastFrame;
+            double                      frameMs[kFrameHistory] = {};
+            std::size_t                 frameCount = 0;      // total frames timed
+            double                      lastMs = 0.0;
+
+            Profiler::CaptureStatus     capture;
+            std::vector<Profiler::Event> captured;
+            std::vector<std::string>    capturedLaneNames;
+        };
+
+        FrameState& State()
+        {
+            static FrameState state;
+            return state;
+        }
+
+        bool WriteTrace(const std::filesystem::path& file, const std::vector<Profiler::Event>& events,
+            const std::vector<std::string>& laneNames)
+        {
+            nlohmann::json traceEvents = nlohmann::json::array();
+            for (const Profiler::Event& e : events)
+            {
+                traceEvents.push_back({
+                    { "name", std::string(e.name) },
+                    { "cat", "cpu" },
+                    { "ph", "X" },
+                    { "ts", static_cast<double>(e.startNs) / 1000.0 },
+                    { "dur", static_cast<double>(e.endNs - e.startNs) / 1000.0 },
+                    { "pid", 1 },
+                    { "tid", e.lane } });
+            }
+            for (std::size_t lane = 0; lane < laneNames.size(); ++lane)
+            {
+                if (laneNames[lane].empty())
+                    continue;
+                traceEvents.push_back({
+                    { "name", "thread_name" },
+                    { "ph", "M" },
+                    { "pid", 1 },
+                    { "tid", lane },
+                    { "args", { { "name", laneNames[lane] } } } });
+            }
+
+            std::error_code ec;
+            if (file.has_parent_path())
+                std::filesystem::create_directories(file.parent_path(), ec);
+
+            std::ofstream out(file, std::ios::out | std::ios::trunc);
+            if (!out.is_open())
+            {
+                std::cerr << "[Profiler] Failed to open trace file: " << file.string() << "\n";
+                return false;
+            }
+            out << nlohmann::json{ { "traceEvents", traceEvents }, { "displayTimeUnit", "ms" } }.dump();
+            return static_cast<bool>(out);
+        }
+    }
+
+#if SOFASPUDS_ENABLE_PROFILER
+    Profiler::Scope::Scope(std::string_view stableName)
+        : name(stableName)
+    {
+        if (!gRecording.load(std::memory_order_relaxed))
+            return;
+        ++tDepth;
+        startNs = NowNs();
+    }
+
+    Profiler::Scope::~Scope()
+    {
+        if (startNs < 0)
+            return;
+        const std::int64_t endNs = NowNs();
+        --tDepth;
+        Lane& lane = ThisLane();
+        Push(lane, Event{ name, startNs, endNs, lane.index, tDepth });
+    }
+#endif
+
+    std::string_view Profiler::Intern(std::string_view name)
+    {
+        return StringId::Intern(name).Str();
+    }
+
+    void Profiler::SetThreadName(std::string_view name)
+    {
+        Lane& lane = ThisLane();
+        std::lock_guard<std::mutex> lock(GetRegistry().mutex);
+        lane.name.assign(name);
+    }
+
+    void Profiler::SetRecording(bool on)
+    {
+        gRecording.store(on, std::memory_order_relaxed);
+    }
+
+    bool Profiler::IsRecording()
+    {
+        return gRecording.load(std::memory_order_relaxed);
+    }
+
+    /*****************************************************************************************
+      \brief Runs on the main thread at the top of every frame. Everything drained here
+             finished during the previous frame.
+    *****************************************************************************************/
+    void Profiler::BeginFrame()
+    {
+        FrameState& state = State();
+        const std::int64_t now = NowNs();
+        if (state.frameStartNs >= 0)
+        {
+            state.lastMs = static_cast<double>(now - state.frameStartNs) / 1e6;
+            state.frameMs[state.frameCount % kFrameHistory] = state.lastMs;
+            ++state.frameCount;
+        }
+
+        if (!state.mainLane)
+        {
+            SetThreadName("main");
+            state.mainLane = &ThisLane();
+        }
+
+        const bool capturing = state.capture.running;
+        if (capturing && state.frameStartNs >= 0)
+            state.captured.push_back(Event{ "Frame", state.frameStartNs, now, state.mainLane->index, 0 });
+        state.frameStartNs = now;
+
+        state.lastFrame.clear();
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (auto& lanePtr : registry.lanes)
+            {
+                Lane& lane = *lanePtr;
+                std::uint32_t t = lane.tail.load(std::memory_order_relaxed);
+                const std::uint32_t h = lane.head.load(std::memory_order_acquire);
+                if (t == h)
+                    continue;
+
+                const bool isMain = &lane == state.mainLane;
+                for (; t != h; ++t)
+                {
+                    const Event& e = lane.events[t & (kLaneCapacity - 1)];
+                    if (isMain)
+                        state.lastFrame.push_back(e);
+                    if (capturing)
+                        state.captured.push_back(e);
+                }
+                lane.tail.store(h, std::memory_order_release);
+
+                if (capturing)
+                {
+                    if (state.capturedLaneNames.size() <= lane.index)
+                        state.capturedLaneNames.resize(lane.index + 1);
+                    state.capturedLaneNames[lane.index] = lane.name;
+                }
+            }
+        }
+
+        // Scopes are pushed when they close, so parents follow their children; order by start.
+        std::stable_sort(state.lastFrame.begin(), state.lastFrame.end(),
+            [](const Event& a, const Event& b) { return a.startNs < b.startNs; });
+
+        if (capturing && state.capture.framesLeft > 0 && --state.capture.framesLeft == 0)
+        {
+            state.capture.running = false;
+            state.capture.events = state.captured.size();
+            state.capture.written = WriteTrace(state.capture.file, state.captured, state.capturedLaneNames);
+            std::cout << "[Profiler] Captured " << state.capture.events << " events to "
+                << state.capture.file.string() << (state.capture.written ? "" : " (write failed)") << "\n";
+            state.captured.clear();
+            state.captured.shrink_to_fit();
+            state.capturedLaneNames.clear();
+        }
+    }
+
+    const std::vector<Profiler::Event>& Profiler::LastFrameEvents()
+    {
+        return State().lastFrame;
+    }
+
+    Profiler::FrameStats Profiler::GetFrameStats()
+    {
+        const FrameState& state = State();
+        FrameStats stats;
+        stats.frames = std::min(state.frameCount, kFrameHistory);
+        stats.lastMs = state.lastMs;
+        if (stats.frames == 0)
+            return stats;
+
+        std::vector<double> sorted(state.frameMs, state.frameMs + stats.frames);
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&sorted](double p) {
+            const std::size_t rank = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+            return sorted[rank];
+        };
+        stats.p50Ms = percentile(0.50);
+        stats.p95Ms = percentile(0.95);
+        stats.p99Ms = percentile(0.99);
+        stats.maxMs = sorted.back();
+        return stats;
+    }
+
+    void Profiler::BeginCapture(unsigned frames, const std::filesystem::path& file)
+    {
+        FrameState& state = State();
+        if (frames == 0)
+            return;
+        state.captured.clear();
+        state.capturedLaneNames.clear();
+        state.capture = CaptureStatus{};
+        state.capture.running = true;
+        state.capture.framesLeft = frames;
+        state.capture.file = file;
+    }
+
+    Profiler::CaptureStatus Profiler::GetCaptureStatus()
+    {
+        return State().capture;
+    }
+
+    std::uint64_t Profiler::DroppedEvents()
+    {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        std::uint64_t dropped = 0;
+        for (const auto& lane : registry.lanes)
+            dropped += lane->dropped.load(std::memory_order_relaxed);
+        return dropped;
+    }
+}
@@ -0,0 +1,143 @@
+/*********************************************************************************************
+ \file      Profiler.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Hierarchical CPU profiler: nested scoped markers on per-thread lanes, frame-time
+            percentiles, and Chrome trace capture of N frames.
+ \details   Mark a region with PROFILE_SCOPE:
+            \code
+                void HitBoxSystem::Update(float dt)
+                {
+                    PROFILE_SCOPE("HitBoxSystem::Update");
+                    ...
+                }
+            \endcode
+            The name must outlive the frame: a string literal, or a view returned by
+            Profiler::Intern() for names built at runtime.
+
+            Each thread writes finished scopes into its own fixed-size ring (one writer, one
+            reader, no locks on the write path). PerfFrameStart() calls BeginFrame(), which
+            drains every ring on the main thread. The main thread's scopes from the previous
+            frame are kept for the Performance window tree. While a capture is running, all
+            lanes are also collected and written as Chrome trace JSON (chrome://tracing,
+            Perfetto) once the requested number of frames has passed.
+
+            Frame time is measured here from BeginFrame() to BeginFrame(), without the 100 ms
+            clamp Core applies to dt, so p95/p99 show real spikes.
+
+            The CMake option SOFASPUDS_ENABLE_PROFILER (ON by default) compiles the markers
+            in. When it is OFF, PROFILE_SCOPE expands to nothing; frame percentiles remain.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef SOFASPUDS_ENABLE_PROFILER
+#define SOFASPUDS_ENABLE_PROFILER 0
+#endif
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class Profiler
+      \brief Scoped CPU markers, per-frame collection and trace capture.
+    *****************************************************************************************/
+    class Profiler
+    {
+    public:
+        static constexpr bool kEnabled = SOFASPUDS_ENABLE_PROFILER != 0;
+
+        /// Records [construction, destruction) on this thread's lane; nests.
+        class Scope
+        {
+        public:
+#if SOFASPUDS_ENABLE_PROFILER
+            explicit Scope(std::string_view stableName);
+            ~Scope();
+#else
+            explicit Scope(std::string_view) {}
+#endif
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+#if SOFASPUDS_ENABLE_PROFILER
+        private:
+            std::string_view name;
+            std::int64_t     startNs = -1;  ///< -1 when recording was off at construction
+#endif
+        };
+
+        /// One finished scope.
+        struct Event
+        {
+            std::string_view name;
+            std::int64_t     startNs = 0;   ///< Since process start
+            std::int64_t     endNs = 0;
+            std::uint32_t    lane = 0;
+            std::uint32_t    depth = 0;     ///< 0 = outermost scope on its lane
+        };
+
+        struct FrameStats
+        {
+            std::size_t frames = 0;         ///< Samples the percentiles were taken over
+            double      p50Ms = 0.0;
+            double      p95Ms = 0.0;
+            double      p99Ms = 0.0;
+            double      maxMs = 0.0;
+            double      lastMs = 0.0;
+        };
+
+        struct CaptureStatus
+        {
+            bool                  running = false;
+            unsigned              framesLeft = 0;
+            bool                  written = false;  ///< Last finished capture reached disk
+            std::size_t           events = 0;       ///< Events in the last finished capture
+            std::filesystem::path file;
+        };
+
+        /// Stable copy of \a name for scopes whose name is built at runtime.
+        static std::string_view Intern(std::string_view name);
+
+        /// Label this thread's lane in the overlay and in traces.
+        static void SetThreadName(std::string_view name);
+
+        /// Turn recording on or off at runtime (markers stay compiled in).
+        static void SetRecording(bool on);
+        static bool IsRecording();
+
+        /// Close the previous frame: time it, drain every lane, advance a capture.
+        static void BeginFrame();
+
+        /// Main-thread scopes of the previous frame, ordered by start time.
+        static const std::vector<Event>& LastFrameEvents();
+
+        /// Percentiles over the most recent frames (up to 1024).
+        static FrameStats GetFrameStats();
+
+        /// Collect all lanes for the next \a frames frames, then write \a file.
+        static void BeginCapture(unsigned frames, const std::filesystem::path& file);
+        static CaptureStatus GetCaptureStatus();
+
+        /// Events lost to full lanes since start.
+        static std::uint64_t DroppedEvents();
+    };
+}
+
+#if SOFASPUDS_ENABLE_PROFILER
+#define SOFASPUDS_PROFILE_CONCAT_INNER(a, b) a##b
+#define SOFASPUDS_PROFILE_CONCAT(a, b) SOFASPUDS_PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) \
+    ::Framework::Profiler::Scope SOFASPUDS_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) \
+    do { } while (0)
+#endif
@@ -33,6 +33,9 @@
 *********************************************************************************************/
 #include "Common/CRTDebug.h"
 #include "Factory.h"
+#include "Factory/FactoryEvents.h"
+#include "Messaging_System/EventBus.h"
+#include "Memory/LevelArena.h"
 #include <stdexcept>
 #include <filesystem>
 #include <fstream>
@@ -128,6 +131,30 @@ namespace Framework {
     {
         JsonSerializer s;
         if (!s.Open(filename) || !s.IsGood()) return nullptr;
+        return BuildTemplate(s);
+    }
+
+    /*************************************************************************************
+      \brief Creates a prefab template GOC from an already-parsed JSON document.
+      \param document Parsed prefab JSON ({ "GameObject": { ... } }).
+      \return Raw pointer to the new template; **caller takes ownership**.
+      \note   Lets the startup preloader parse prefab files on worker threads while
+              component construction stays on the main thread.
+    *************************************************************************************/
+    GOC* GameObjectFactory::CreateTemplateFromDocument(json document)
+    {
+        JsonSerializer s;
+        if (!s.OpenDocument(std::move(document)) || !s.IsGood()) return nullptr;
+        return BuildTemplate(s);
+    }
+
+    /*************************************************************************************
+      \brief Shared body of CreateTemplate*: builds an un-ID'd GOC from an opened serializer.
+      \param s Serializer positioned at the document root.
+      \return Raw pointer to the template (caller owns), or nullptr if "GameObject" is missing.
+    *************************************************************************************/
+    GOC* GameObjectFactory::BuildTemplate(JsonSerializer& s)
+    {
         if (!s.EnterObject("GameObject")) return nullptr;
 
         auto goc = GameObjectPool::Create();
@@ -250,9 +277,13 @@ namespace Framework {
       \brief Loads a level file containing an array "GameObjects" and builds each GOC.
       \param filename Path to a JSON level file.
       \return Vector of non-owning pointers to created GOCs (each ID-assigned and owned by the factory).
+      \note   The objects, their components and component lists come from the level arena
+             (see LevelArena). The previous level's arena is released or retired first,
+             so every caller (LogicSystem, the editor's level loader) goes through it.
     *************************************************************************************/
     std::vector<GOC*> GameObjectFactory::CreateLevel(const std::string& filename)
     {
+        LevelArena::Scope levelScope(LevelArena::BeginLevel());
         JsonSerializer s;
         std::vector<GOC*> out;
         LastLevelCache.clear();
@@ -339,7 +370,7 @@ namespace Framework {
                {"layer", rc.layer}
             };
             if (!rc.texture_key.empty())
-                out["texture_key"] = rc.texture_key;
+                out["texture_key"] = rc.texture_key.str();
             if (!rc.texture_path.empty())
                 out["texture_path"] = rc.texture_path;
             return out;
@@ -370,7 +401,7 @@ namespace Framework {
         case ComponentTypeId::CT_SpriteComponent: {
             auto const& sp = static_cast<SpriteComponent const&>(component);
             json out = json::object();
-            if (!sp.texture_key.empty()) out["texture_key"] = sp.texture_key;
+            if (!sp.texture_key.empty()) out["texture_key"] = sp.texture_key.str();
             if (!sp.path.empty()) out["path"] = sp.path;
             return out;
         }
@@ -407,7 +438,7 @@ namespace Framework {
                 animations.push_back(entry);
             }
 
-            return json{
+            json out = json{
                 {"fps", anim.fps},
                 {"loop", anim.loop},
                 {"play", anim.play},
@@ -415,6 +446,9 @@ namespace Framework {
                 {"animations", animations},
                 {"activeAnimation", anim.ActiveAnimationIndex()}
             };
+            if (!anim.stateMachine.empty())
+                out["stateMachine"] = anim.stateMachine;
+            return out;
         }
 
         case ComponentTypeId::CT_RigidBodyComponent: {
@@ -443,8 +477,14 @@ namespace Framework {
         case ComponentTypeId::CT_PlayerHUDComponent:
             return json::object();
         case ComponentTypeId::CT_EnemyComponent:
-        case ComponentTypeId::CT_EnemyDecisionTreeComponent:
             return json::object();
+        case ComponentTypeId::CT_EnemyDecisionTreeComponent: {
+            auto const& ai = static_cast<EnemyDecisionTreeComponent const&>(component);
+            json out = json::object();
+            if (!ai.treeId.empty())
+                out["tree"] = ai.treeId;
+            return out;
+        }
         case ComponentTypeId::CT_EnemyAttackComponent: {
             auto const& atk = static_cast<EnemyAttackComponent const&>(component);
             return json{ {"damage", atk.damage}, {"attack_speed", atk.attack_speed} };
@@ -644,6 +684,7 @@ namespace Framework {
                 if (ObjectsToBeDeleted.count(assignedId))
                 {
                     LayerData.RemoveObject(assignedId);
+                    EventBus::Instance().Publish(ObjectDestroyedEvent{ existing->second.get(), assignedId });
                     GameObjectIdMap.erase(existing);
                 }
                 else
@@ -669,6 +710,13 @@ namespace Framework {
         GOC* raw = gameObject.get();
         LayerData.AssignToLayer(raw->ObjectId, raw->GetLayerName());
         GameObjectIdMap.emplace(assignedId, std::move(gameObject));
+
+        // Components attached before registration are announced now (see FactoryEvents.h).
+        for (const auto& component : raw->Components)
+        {
+            if (component)
+                EventBus::Instance().Publish(ComponentAddedEvent{ raw, assignedId, component->GetTypeId() });
+        }
         return raw;
     }
 
@@ -721,6 +769,7 @@ namespace Framework {
             auto it = GameObjectIdMap.find(id);
             if (it != GameObjectIdMap.end()) {
                 LayerData.RemoveObject(id);
+                EventBus::Instance().Publish(ObjectDestroyedEvent{ it->second.get(), id });
                 GameObjectIdMap.erase(it); // unique_ptr destruction happens here
             }
         }
@@ -739,15 +788,16 @@ namespace Framework {
             auto it = GameObjectIdMap.find(id);
             if (it != GameObjectIdMap.end()) {
                 LayerData.RemoveObject(id);
+                EventBus::Instance().Publish(ObjectDestroyedEvent{ it->second.get(), id });
                 GameObjectIdMap.erase(it); // unique_ptr destruction happens here
             }
         }
         ObjectsToBeDeleted.clear();
         PruneLastLevelCache();
         // Destroy any remaining tracked game objects and release their components
-        for (auto const& [id, _] : GameObjectIdMap) {
-            (void)_;
+        for (auto const& [id, object] : GameObjectIdMap) {
             LayerData.RemoveObject(id);
+            EventBus::Instance().Publish(ObjectDestroyedEvent{ object.get(), id });
         }
         // Destroy any remaining tracked game objects and release their components
         GameObjectIdMap.clear();
@@ -755,6 +805,7 @@ namespace Framework {
         LayerData.Clear();
 
         // Component creators are owned by the factory; release them to avoid leak reports
+        ComponentIndex.clear();
         ComponentMap.clear();
 
         LastLevelCache.clear();
@@ -797,6 +848,7 @@ namespace Framework {
     *************************************************************************************/
     void GameObjectFactory::AddComponentCreator(const std::string& name, std::unique_ptr<ComponentCreator> creator)
     {
+        ComponentIndex[StringId::Intern(name)] = creator.get();
         ComponentMap[name] = std::move(creator);
     }
 
@@ -839,6 +891,12 @@ namespace Framework {
                 if (it != data.end() && it->is_string())
                     out = it->get<std::string>();
             };
+        auto readInterned = [&](const char* key, InternedString& out)
+            {
+                auto it = data.find(key);
+                if (it != data.end() && it->is_string())
+                    out = it->get<std::string>();
+            };
 
         switch (component.GetTypeId())
         {
@@ -860,7 +918,7 @@ namespace Framework {
             readFloat("b", rc.b);
             readFloat("a", rc.a);
             readBool("visible", rc.visible);
-            readString("texture_key", rc.texture_key);
+            readInterned("texture_key", rc.texture_key);
             readString("texture_path", rc.texture_path);
             break;
         }
@@ -905,7 +963,7 @@ namespace Framework {
         case ComponentTypeId::CT_SpriteComponent:
         {
             auto& sp = static_cast<SpriteComponent&>(component);
-            readString("texture_key", sp.texture_key);
+            readInterned("texture_key", sp.texture_key);
             readString("path", sp.path);
             break;
         }
@@ -968,6 +1026,9 @@ namespace Framework {
 
             if (auto it = data.find("activeAnimation"); it != data.end())
                 anim.activeAnimation = it->get<int>();
+            if (auto it = data.find("stateMachine"); it != data.end() && it->is_string())
+                anim.stateMachine = it->get<std::string>();
+            anim.RefreshNameIds();
 
             break;
         }
@@ -1039,9 +1100,15 @@ namespace Framework {
             readFloat("duration", hit.duration);
             break;
         }
+        case ComponentTypeId::CT_EnemyDecisionTreeComponent:
+        {
+            auto& ai = static_cast<EnemyDecisionTreeComponent&>(component);
+            readString("tree", ai.treeId);
+            ai.tree = nullptr;   // re-resolved by AiSystem
+            break;
+        }
         case ComponentTypeId::CT_EnemyComponent:
         case ComponentTypeId::CT_PlayerComponent:
-        case ComponentTypeId::CT_EnemyDecisionTreeComponent:
         case ComponentTypeId::CT_InputComponents:
         case ComponentTypeId::CT_AudioComponent:
         {
@@ -1124,11 +1191,11 @@ namespace Framework {
         {
             for (auto& [compName, compData] : compIt->items())
             {
-                auto creatorIt = ComponentMap.find(compName);
-                if (creatorIt == ComponentMap.end())
+                auto creatorIt = ComponentIndex.find(StringId(compName));
+                if (creatorIt == ComponentIndex.end())
                     continue;
 
-                ComponentCreator* creator = creatorIt->second.get();
+                ComponentCreator* creator = creatorIt->second;
                 if (!creator)
                     continue;
 
@@ -38,6 +38,7 @@
 
 
 #include <map>
+#include <unordered_map>
 #include <set>
 #include <memory>
 #include <string>
@@ -99,6 +100,10 @@ namespace Framework {
         /// Returns a raw pointer for which the **caller assumes ownership** (not ID-registered).
         GOC* CreateTemplate(const std::string& filename);
 
+        /// Same as CreateTemplate, but from a document that was already parsed (e.g. by the
+        /// startup preloader on a worker thread). Caller assumes ownership.
+        GOC* CreateTemplateFromDocument(json document);
+
         /// Build a GOC from the current JSON object stream and register it (assign ID, take ownership).
         /// Returns a **non-owning** pointer.
         GOC* BuildFromCurrentJsonObject(ISerializer& stream);
@@ -167,6 +172,7 @@ namespace Framework {
         using GameObjectIdMapType = std::map<unsigned, GameObjectHandle>;
 
         ComponentMapType     ComponentMap;     ///< Map: component name → owning ComponentCreator
+        std::unordered_map<StringId, ComponentCreator*> ComponentIndex; ///< Interned name → creator (non-owning view of ComponentMap)
         GameObjectIdMapType  GameObjectIdMap;  ///< Map: GOC ID → owning handle (GameObjectHandle)
         std::set<GOCId>      ObjectsToBeDeleted; ///< Set of GOC IDs scheduled for deferred deletion
         std::vector<GOC*>     LastLevelCache;      ///< Snapshot of last saved/loaded level objects (non-owning)
@@ -178,6 +184,7 @@ namespace Framework {
         json SerializeComponentToJson(const GameComponent& component) const;
         void DeserializeComponentFromJson(GameComponent& component, const json& data) const;
         GOC* InstantiateFromSnapshotInternal(const json& data);
+        GOC* BuildTemplate(JsonSerializer& s);
         bool SaveLevelInternal(const std::string& filename, const std::vector<GOC*>& objects,
             const std::string& levelName);
         /// Remove any cached last-level pointers that no longer refer to live objects.
@@ -0,0 +1,46 @@
+/*********************************************************************************************
+ \file      FactoryEvents.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Events published on EventBus::Instance() when registered objects gain or lose
+            components or are destroyed.
+ \details   Only objects registered with the factory (id != 0) publish. Registration
+            publishes ComponentAddedEvent for every component the object already has, so
+            a listener sees each component exactly once however the object was built.
+
+            ComponentRemovedEvent fires before the component is released, and
+            ObjectDestroyedEvent fires before the object is freed, so both pointers are
+            still valid inside the handler. Components that leave together with their
+            object are not reported one by one; listen for ObjectDestroyedEvent instead.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "Common/ComponentTypeID.h"
+
+namespace Framework
+{
+    class GameObjectComposition;
+
+    struct ComponentAddedEvent
+    {
+        GameObjectComposition* object;
+        unsigned int           id;
+        ComponentTypeId        type;
+    };
+
+    struct ComponentRemovedEvent
+    {
+        GameObjectComposition* object;
+        unsigned int           id;
+        ComponentTypeId        type;
+    };
+
+    struct ObjectDestroyedEvent
+    {
+        GameObjectComposition* object;
+        unsigned int           id;
+    };
+}
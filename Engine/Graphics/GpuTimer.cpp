@@ -0,0 +1,259 @@
+/*********************************************************************************************
+ \file      GpuTimer.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements GpuTimer: per-frame query pools, the pass stack and non-blocking
+            readback.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "GpuTimer.h"
+#include <glad/glad.h>
+#include <iostream>
+#include <vector>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace gfx {
+
+    namespace {
+        constexpr std::size_t kMaxStackDepth = 8;
+        constexpr std::size_t kMaxQueriesPerFrame = 256;   // segments; glow splits the sprite pass
+
+        /// Queries issued during one frame, in issue order.
+        struct FramePool {
+            std::vector<GLuint>  queries;   // grown on demand, reused every kFramesInFlight frames
+            std::vector<GpuPass> passes;    // pass that owns queries[i]
+            std::size_t          used = 0;
+            std::uint64_t        frame = 0;
+            bool                 pending = false;
+        };
+
+        struct TimerState {
+            bool initialized = false;
+            bool available = false;
+            bool inFrame = false;
+            bool queryOpen = false;
+            bool warmedUp = false;          // first resolved frame is dropped
+
+            std::array<FramePool, GpuTimer::kFramesInFlight> pools;
+            std::size_t   current = 0;
+            std::uint64_t frame = 0;
+
+            GpuPass     stack[kMaxStackDepth] = {};
+            std::size_t depth = 0;
+            std::size_t overflow = 0;       // Begin() calls past kMaxStackDepth, matched by End()
+
+            std::array<std::array<float, GpuTimer::kHistory>, GpuTimer::kPassCount> history{};
+            std::array<float, GpuTimer::kHistory> totalHistory{};
+            std::size_t historyHead = 0;
+
+            GpuTimer::Stats stats;
+        };
+
+        TimerState& State() {
+            static TimerState state;
+            return state;
+        }
+
+        void Initialize(TimerState& state) {
+            state.initialized = true;
+            if (!GLAD_GL_VERSION_3_3)
+                return;
+
+            GLint bits = 0;
+            glGetQueryiv(GL_TIME_ELAPSED, GL_QUERY_COUNTER_BITS, &bits);
+            state.available = bits > 0;
+            std::cout << "[GpuTimer] GL_TIME_ELAPSED " << (state.available ? "available" : "unavailable")
+                << " (" << bits << " counter bits)\n";
+        }
+
+        void OpenQuery(TimerState& state, GpuPass pass) {
+            FramePool& pool = state.pools[state.current];
+            if (pool.used == pool.queries.size()) {
+                if (pool.queries.size() >= kMaxQueriesPerFrame)
+                    return; // time lands in no pass this frame rather than growing without bound
+                GLuint query = 0;
+                glGenQueries(1, &query);
+                pool.queries.push_back(query);
+                pool.passes.push_back(pass);
+            }
+            pool.passes[pool.used] = pass;
+            glBeginQuery(GL_TIME_ELAPSED, pool.queries[pool.used]);
+            ++pool.used;
+            state.queryOpen = true;
+        }
+
+        void CloseQuery(TimerState& state) {
+            if (!state.queryOpen)
+                return;
+            glEndQuery(GL_TIME_ELAPSED);
+            state.queryOpen = false;
+        }
+
+        /// Read \a pool back if every query has finished (or always, when \a wait is set).
+        bool TryResolve(TimerState& state, FramePool& pool, bool wait) {
+            if (!wait) {
+                for (std::size_t i = 0; i < pool.used; ++i) {
+                    GLuint ready = GL_FALSE;
+                    glGetQueryObjectuiv(pool.queries[i], GL_QUERY_RESULT_AVAILABLE, &ready);
+                    if (!ready)
+                        return false;
+                }
+            }
+
+            std::array<double, GpuTimer::kPassCount> passMs{};
+            for (std::size_t i = 0; i < pool.used; ++i) {
+                GLuint64 ns = 0;
+                glGetQueryObjectui64v(pool.queries[i], GL_QUERY_RESULT, &ns);
+                passMs[static_cast<std::size_t>(pool.passes[i])] += static_cast<double>(ns) / 1e6;
+            }
+            pool.pending = false;
+
+            // llvmpipe reports the very first TIME_ELAPSED result from context creation
+            // rather than from glBeginQuery; one dropped frame keeps it out of the graph.
+            if (!state.warmedUp) {
+                state.warmedUp = true;
+                return true;
+            }
+
+            GpuTimer::Stats& stats = state.stats;
+            stats.passMs = passMs;
+            stats.totalMs = 0.0;
+            for (std::size_t p = 0; p < GpuTimer::kPassCount; ++p) {
+                stats.totalMs += passMs[p];
+                state.history[p][state.historyHead] = static_cast<float>(passMs[p]);
+            }
+            state.totalHistory[state.historyHead] = static_cast<float>(stats.totalMs);
+            state.historyHead = (state.historyHead + 1) % GpuTimer::kHistory;
+            stats.latencyFrames = static_cast<unsigned>(state.frame - pool.frame);
+            ++stats.resolvedFrames;
+            return true;
+        }
+
+        void CopyRing(const std::array<float, GpuTimer::kHistory>& ring, std::size_t head,
+            float (&out)[GpuTimer::kHistory]) {
+            for (std::size_t i = 0; i < GpuTimer::kHistory; ++i)
+                out[i] = ring[(head + i) % GpuTimer::kHistory];
+        }
+    }
+
+    /*****************************************************************************************
+      \brief Close the previous frame's pool, collect whatever has finished (oldest first, so
+             history stays in order), then take the oldest pool for the new frame.
+    *****************************************************************************************/
+    void GpuTimer::BeginFrame() {
+        TimerState& state = State();
+        if (!state.initialized)
+            Initialize(state);
+        if (!state.available)
+            return;
+
+        if (state.inFrame) {
+            if (state.depth > 0 || state.overflow > 0) {
+                // A pass threw or returned early; drop the stack so the next frame starts clean.
+                CloseQuery(state);
+                state.depth = 0;
+                state.overflow = 0;
+                ++state.stats.unbalanced;
+            }
+            state.pools[state.current].pending = state.pools[state.current].used > 0;
+            ++state.frame;
+        }
+
+        for (std::size_t i = 1; i <= kFramesInFlight; ++i) {
+            FramePool& pool = state.pools[(state.current + i) % kFramesInFlight];
+            if (pool.pending && !TryResolve(state, pool, false))
+                break;
+        }
+
+        state.current = (state.current + 1) % kFramesInFlight;
+        FramePool& pool = state.pools[state.current];
+        if (pool.pending) {
+            ++state.stats.stalls;
+            TryResolve(state, pool, true);
+        }
+        pool.used = 0;
+        pool.frame = state.frame;
+        state.inFrame = true;
+    }
+
+    void GpuTimer::Begin(GpuPass pass) {
+        TimerState& state = State();
+        if (!state.available || !state.inFrame)
+            return;
+        if (state.depth == kMaxStackDepth) {
+            ++state.overflow;
+            return;
+        }
+        CloseQuery(state);
+        state.stack[state.depth++] = pass;
+        OpenQuery(state, pass);
+    }
+
+    void GpuTimer::End(GpuPass pass) {
+        TimerState& state = State();
+        if (!state.available || !state.inFrame)
+            return;
+        if (state.overflow > 0) {
+            --state.overflow;
+            return;
+        }
+        if (state.depth == 0 || state.stack[state.depth - 1] != pass)
+            return;
+        CloseQuery(state);
+        --state.depth;
+        if (state.depth > 0)
+            OpenQuery(state, state.stack[state.depth - 1]);
+    }
+
+    bool GpuTimer::Available() {
+        return State().available;
+    }
+
+    GpuTimer::Stats GpuTimer::GetStats() {
+        Stats stats = State().stats;
+        stats.available = State().available;
+        return stats;
+    }
+
+    void GpuTimer::CopyHistory(GpuPass pass, float (&out)[kHistory]) {
+        const TimerState& state = State();
+        CopyRing(state.history[static_cast<std::size_t>(pass)], state.historyHead, out);
+    }
+
+    void GpuTimer::CopyTotalHistory(float (&out)[kHistory]) {
+        const TimerState& state = State();
+        CopyRing(state.totalHistory, state.historyHead, out);
+    }
+
+    const char* GpuTimer::PassName(GpuPass pass) {
+        switch (pass) {
+        case GpuPass::Background:  return "Background";
+        case GpuPass::Sprites:     return "Sprites";
+        case GpuPass::HitboxDebug: return "Hitbox debug";
+        case GpuPass::Glow:        return "Glow";
+        case GpuPass::Text:        return "Text";
+        case GpuPass::ImGui:       return "ImGui";
+        default:                   return "?";
+        }
+    }
+
+    void GpuTimer::Shutdown() {
+        TimerState& state = State();
+        if (state.available) {
+            CloseQuery(state);
+            for (FramePool& pool : state.pools) {
+                if (!pool.queries.empty())
+                    glDeleteQueries(static_cast<GLsizei>(pool.queries.size()), pool.queries.data());
+            }
+        }
+        state = TimerState{};
+    }
+
+} // namespace gfx
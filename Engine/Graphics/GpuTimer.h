@@ -0,0 +1,99 @@
+/*********************************************************************************************
+ \file      GpuTimer.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Declares GpuTimer, GL_TIME_ELAPSED query pools that measure how long the GPU
+            spends in each render pass.
+ \details   setRender() in Perf only measures how long the CPU takes to submit, so a
+            GPU-bound frame looks cheap there. GpuTimer wraps the passes (background,
+            sprites, debug hitboxes, glow, text, ImGui) in GL_TIME_ELAPSED queries.
+
+            Only one TIME_ELAPSED query can be active at a time, so passes behave like a
+            stack. Opening a pass while another is open (glow inside the sprite pass) ends
+            the outer query, and the outer pass resumes with a fresh query when the inner
+            one closes. Each pass therefore reports exclusive time, summed over all of its
+            segments in the frame.
+
+            Queries are kept in kFramesInFlight per-frame pools. Results are read back
+            without blocking once the driver reports them available, normally 1-3 frames
+            later. The call only blocks when a pool must be reused while still pending; those
+            cases are counted as stalls.
+
+            Requires GL 3.3 or ARB_timer_query (Mesa llvmpipe has both). If the driver
+            reports zero counter bits, every call is a no-op and Available() returns false.
+            All calls must run on the thread that owns the GL context.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace gfx {
+
+    enum class GpuPass : std::uint8_t {
+        Background,
+        Sprites,
+        HitboxDebug,
+        Glow,
+        Text,
+        ImGui,
+        Count
+    };
+
+    /*****************************************************************************************
+      \class GpuTimer
+      \brief Static per-pass GPU timing with asynchronous readback.
+    *****************************************************************************************/
+    class GpuTimer {
+    public:
+        static constexpr std::size_t kPassCount = static_cast<std::size_t>(GpuPass::Count);
+        static constexpr std::size_t kFramesInFlight = 4;
+        static constexpr std::size_t kHistory = 120;
+
+        /// Opens \a pass on construction and closes it on destruction.
+        class Scope {
+        public:
+            explicit Scope(GpuPass pass) : pass(pass) { GpuTimer::Begin(pass); }
+            ~Scope() { GpuTimer::End(pass); }
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        private:
+            GpuPass pass;
+        };
+
+        struct Stats {
+            bool          available = false;
+            std::array<double, kPassCount> passMs{};    ///< Newest resolved frame
+            double        totalMs = 0.0;
+            unsigned      latencyFrames = 0;            ///< Age of that frame when it resolved
+            std::uint64_t resolvedFrames = 0;
+            std::uint64_t stalls = 0;                   ///< Pools reused before their results arrived
+            std::uint64_t unbalanced = 0;               ///< Frames that ended with a pass still open
+        };
+
+        /// Start a new frame: read back finished pools and recycle the oldest one.
+        static void BeginFrame();
+
+        /// Open / close a pass. Calls must nest; End() of a pass that is not on top is ignored.
+        static void Begin(GpuPass pass);
+        static void End(GpuPass pass);
+
+        static bool Available();
+        static Stats GetStats();
+
+        /// Last kHistory resolved values of \a pass in ms (oldest first), for plotting.
+        static void CopyHistory(GpuPass pass, float (&out)[kHistory]);
+        /// Same for the sum over all passes.
+        static void CopyTotalHistory(float (&out)[kHistory]);
+
+        static const char* PassName(GpuPass pass);
+
+        /// Delete all query objects (call before the GL context goes away).
+        static void Shutdown();
+    };
+
+} // namespace gfx
@@ -8,7 +8,7 @@
  \details   This module encapsulates lightweight graphics helpers used by the sandbox/game:
             - Geometry: unit rect, circle (procedural), fullscreen background, sprite quad.
             - Shaders: minimal compile/link/validate with error logging.
-            - Textures: stb_image loading with GL setup.
+            - Textures: stb_image loading with GL setup, or cooked BC7/RGBA8 mip chains.
             - Transforms: GLM-based model builds (translate/rotate/scale), pivot-aware rect.
             - Sprites: whole-texture draw and sprite-sheet framed draw via uUVOffset/uUVScale.
             - Diagnostics: GL error guard and crash-test toggles for robustness testing.
@@ -27,6 +27,8 @@
 #include <cmath>
 #include <iostream>
 #include <cstddef>
+#include <mutex>
+#include <string_view>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -171,8 +173,52 @@ namespace gfx {
      \return GL texture handle.
      \throws std::runtime_error if the file cannot be loaded.
      \note   MIN_FILTER is GL_LINEAR; mipmaps are generated for future flexibility.
+     \note   If TextureCooker has an up-to-date cooked copy the driver can sample, that copy
+             (BC7 or RGBA8, mips included) is uploaded instead of decoding the source.
     ******************************************************************************************/
     unsigned int Graphics::loadTexture(const char* path) {
+        TextureCooker::CookedTexture cooked;
+        if (TextureCooker::loadCooked(path, cooked) && canUploadCooked(cooked))
+            return uploadCookedTexture(cooked, path);
+        return uploadTexture(decodeTexture(path), path);
+    }
+
+    /*****************************************************************************************
+     \brief  Release a pixel buffer allocated by stb_image.
+    ******************************************************************************************/
+    void Graphics::DecodedImage::PixelDeleter::operator()(unsigned char* p) const noexcept {
+        stbi_image_free(p);
+    }
+
+    /*****************************************************************************************
+     \brief  Decode an image with stb_image (vertically flipped for GL) without any GL calls.
+     \param  path Filesystem path to the image.
+     \return Decoded image; pixels is null when stb_image fails.
+     \note   The flip flag is process-global in stb_image, so it is set exactly once instead
+             of on every call; that keeps concurrent decodes on worker threads race-free.
+    ******************************************************************************************/
+    Graphics::DecodedImage Graphics::decodeTexture(const char* path) {
+        static std::once_flag flipOnce;
+        std::call_once(flipOnce, [] { stbi_set_flip_vertically_on_load(true); });
+
+        DecodedImage image;
+        image.pixels.reset(stbi_load(path, &image.width, &image.height, &image.channels, 0));
+        return image;
+    }
+
+    /*****************************************************************************************
+     \brief  Create a GL texture from a decoded image and configure basic filtering/wrap.
+     \param  image Decoded pixels (see decodeTexture).
+     \param  path  Source path, used in the error message.
+     \return GL texture handle.
+     \throws std::runtime_error if the image holds no pixels.
+    ******************************************************************************************/
+    unsigned int Graphics::uploadTexture(const DecodedImage& image, const char* path) {
+        if (!image.pixels) {
+            std::cerr << "Failed to load texture: " << path << std::endl;
+            throw std::runtime_error(std::string("texture_load|failed|") + path);
+        }
+
         unsigned int textureID;
         glGenTextures(1, &textureID);
         glBindTexture(GL_TEXTURE_2D, textureID);
@@ -181,28 +227,120 @@ namespace gfx {
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-        int width, height, nrChannels;
-        stbi_set_flip_vertically_on_load(true);
-        unsigned char* data = stbi_load(path, &width, &height, &nrChannels, 0);
+        GLenum format = (image.channels == 3) ? GL_RGB : GL_RGBA;
+        glTexImage2D(GL_TEXTURE_2D, 0, format, image.width, image.height, 0, format, GL_UNSIGNED_BYTE, image.pixels.get());
+        glGenerateMipmap(GL_TEXTURE_2D);
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        GL_THROW_IF_ERROR("loadTexture");
+        return textureID;
+    }
+
+    /*****************************************************************************************
+     \brief  Check whether the current context can sample a cooked texture's format.
+     \note   The BPTC query is made once; the answer cannot change for the context's lifetime.
+    ******************************************************************************************/
+    bool Graphics::canUploadCooked(const TextureCooker::CookedTexture& tex) {
+        if (tex.mips.empty())
+            return false;
+        if (tex.format != TextureCooker::Format::BC7)
+            return true;
+
+        static const bool bptc = [] {
+            if (GLAD_GL_VERSION_4_2)
+                return true;
+            GLint count = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+            for (GLint i = 0; i < count; ++i) {
+                const char* ext = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+                if (ext && std::string_view(ext) == "GL_ARB_texture_compression_bptc")
+                    return true;
+            }
+            return false;
+        }();
+        return bptc;
+    }
 
-        if (data) {
-            GLenum format = (nrChannels == 3) ? GL_RGB : GL_RGBA;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-            glGenerateMipmap(GL_TEXTURE_2D);
+    /*****************************************************************************************
+     \brief  Create a GL texture from a cooked mip chain.
+     \param  tex  Cooked texture (see TextureCooker::loadCooked).
+     \param  path Source path, used in the error message.
+     \return GL texture handle.
+     \throws std::runtime_error if the texture holds no levels or its format is unsupported.
+    ******************************************************************************************/
+    unsigned int Graphics::uploadCookedTexture(const TextureCooker::CookedTexture& tex, const char* path) {
+        if (!canUploadCooked(tex)) {
+            std::cerr << "Failed to upload cooked texture: " << path << std::endl;
+            throw std::runtime_error(std::string("texture_load|cooked|") + path);
         }
-        else {
-            std::cerr << "Failed to load texture: " << path << std::endl;
-            glBindTexture(GL_TEXTURE_2D, 0);
-            if (textureID) glDeleteTextures(1, &textureID);
-            throw std::runtime_error(std::string("texture_load|failed|") + path);
+
+        unsigned int textureID;
+        glGenTextures(1, &textureID);
+        glBindTexture(GL_TEXTURE_2D, textureID);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(tex.mips.size() - 1));
+
+        for (std::size_t level = 0; level < tex.mips.size(); ++level) {
+            const TextureCooker::MipLevel& mip = tex.mips[level];
+            if (tex.format == TextureCooker::Format::BC7) {
+                glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), GL_COMPRESSED_RGBA_BPTC_UNORM,
+                    mip.width, mip.height, 0, static_cast<GLsizei>(mip.data.size()), mip.data.data());
+            }
+            else {
+                glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), GL_RGBA8,
+                    mip.width, mip.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, mip.data.data());
+            }
         }
 
-        stbi_image_free(data);
         glBindTexture(GL_TEXTURE_2D, 0);
-        GL_THROW_IF_ERROR("loadTexture");
+        GL_THROW_IF_ERROR("uploadCookedTexture");
         return textureID;
     }
 
+    /*****************************************************************************************
+     \brief  Sum the storage of every allocated mip level of a 2D texture.
+     \param  tex GL texture handle.
+     \param  out Receives actual and RGBA8-equivalent bytes.
+     \return false if the handle is 0 or has no level 0.
+     \note   RGBA8-equivalent assumes 4 bytes per texel (drivers pad RGB8 to RGBA8).
+    ******************************************************************************************/
+    bool Graphics::getTextureFootprint(unsigned int tex, TextureFootprint& out) {
+        out = {};
+        if (!tex)
+            return false;
+
+        glBindTexture(GL_TEXTURE_2D, tex);
+        for (GLint level = 0; level < 32; ++level) {
+            GLint w = 0, h = 0, compressed = GL_FALSE;
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_WIDTH, &w);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_HEIGHT, &h);
+            if (w <= 0 || h <= 0)
+                break;
+
+            const std::size_t rgba8 = static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * 4u;
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED, &compressed);
+            if (compressed == GL_TRUE) {
+                GLint size = 0;
+                glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+                out.bytes += static_cast<std::size_t>(size);
+                if (level == 0)
+                    out.compressed = true;
+            }
+            else {
+                out.bytes += rgba8;
+            }
+            out.rgba8Bytes += rgba8;
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        GL_THROW_IF_ERROR("getTextureFootprint");
+        return out.rgba8Bytes > 0;
+    }
+
     /*****************************************************************************************
      \brief  Destroy a GL texture if non-zero.
      \param  tex GL texture handle.
@@ -17,7 +17,9 @@
 
 #include <glad/glad.h>
 #include "../Resource_Asset_Manager/Resource_Manager.h"
+#include "TextureCooker.h"
 #include <glm/mat4x4.hpp>
+#include <memory>
 #include <vector>
 namespace gfx {
 
@@ -36,6 +38,58 @@ namespace gfx {
          */
         static unsigned int loadTexture(const char* path);
 
+        /**
+         * \brief CPU-side result of decoding an image file; owns the stb_image pixel buffer.
+         */
+        struct DecodedImage {
+            struct PixelDeleter { void operator()(unsigned char* p) const noexcept; };
+            int width = 0;
+            int height = 0;
+            int channels = 0;
+            std::unique_ptr<unsigned char, PixelDeleter> pixels{};
+        };
+
+        /**
+         * \brief Decode an image file into memory without touching OpenGL.
+         * \note  Thread-safe; used by the startup preloader to decode textures on workers.
+         * \return Decoded image, or an image with null pixels if the file could not be read.
+         */
+        static DecodedImage decodeTexture(const char* path);
+
+        /**
+         * \brief Upload a decoded image as a 2D texture (main thread, GL context current).
+         * \param image Decoded image; must have non-null pixels.
+         * \param path  Source path, used only for error reporting.
+         * \return GL texture handle.
+         */
+        static unsigned int uploadTexture(const DecodedImage& image, const char* path);
+
+        /**
+         * \brief True if the driver can sample \a tex as stored (RGBA8 always; BC7 needs
+         *        GL 4.2 or GL_ARB_texture_compression_bptc). GL context must be current.
+         */
+        static bool canUploadCooked(const TextureCooker::CookedTexture& tex);
+
+        /**
+         * \brief Upload a cooked texture with its precomputed mip chain (no glGenerateMipmap).
+         * \param tex  Cooked texture; canUploadCooked(tex) must be true.
+         * \param path Source path, used only for error reporting.
+         * \return GL texture handle.
+         */
+        static unsigned int uploadCookedTexture(const TextureCooker::CookedTexture& tex, const char* path);
+
+        /**
+         * \brief GPU footprint of a texture summed over all of its mip levels.
+         */
+        struct TextureFootprint {
+            std::size_t bytes = 0;        ///< Actual storage (compressed size where applicable)
+            std::size_t rgba8Bytes = 0;   ///< What the same levels would cost as RGBA8
+            bool compressed = false;      ///< Level 0 uses a compressed internal format
+        };
+
+        /// Query the per-level storage of a 2D texture. Returns false if unavailable.
+        static bool getTextureFootprint(unsigned int tex, TextureFootprint& out);
+
         /**
          * \brief Destroy a previously created texture handle.
          */
@@ -49,6 +49,7 @@ namespace Framework
                 std::cout << "[HUD] Failed to load " << name << "\n";
                 return 0u;
             }
+            Resource_Manager::Pin(name); // HUD caches the raw handle
             return Resource_Manager::getTexture(name);
         }
     }
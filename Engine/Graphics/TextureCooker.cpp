@@ -0,0 +1,438 @@
+/*********************************************************************************************
+ \file      TextureCooker.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements TextureCooker: CPU mip generation, BC7 block encoding through bc7enc,
+            the cooked container reader/writer, and the parallel directory cook.
+ \details   Sources are decoded with Graphics::decodeTexture(), so cooked levels carry the
+            same vertical flip as the runtime upload path. Mips use an alpha-weighted 2x2 box
+            filter so fully transparent texels do not darken sprite edges. Levels whose size
+            is not a multiple of four are encoded with edge texels clamped into the partial
+            blocks, which is what GL expects for compressed sub-block sizes.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "TextureCooker.h"
+#include "Graphics.hpp"
+#include "Core/PathUtils.h"
+#include "Core/TaskGraph.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <system_error>
+
+#if SOFASPUDS_HAS_BC7ENC
+#include "bc7enc.h"
+#endif
+
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace gfx {
+
+    namespace {
+        namespace fs = std::filesystem;
+
+        constexpr char          kMagic[4] = { 'S', 'S', 'T', 'X' };
+        constexpr std::uint32_t kVersion = 1;
+        constexpr std::uint32_t kMaxMips = 16;      ///< Enough for 32k x 32k
+        constexpr std::size_t   kBc7BlockBytes = 16;
+
+        std::mutex                   gReportMutex;
+        TextureCooker::CookReport    gLastReport{};
+
+        std::size_t Bc7LevelBytes(int w, int h)
+        {
+            return static_cast<std::size_t>((w + 3) / 4) * static_cast<std::size_t>((h + 3) / 4) * kBc7BlockBytes;
+        }
+
+        std::size_t ExpectedLevelBytes(TextureCooker::Format format, int w, int h)
+        {
+            return format == TextureCooker::Format::BC7
+                ? Bc7LevelBytes(w, h)
+                : static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * 4u;
+        }
+
+        /*************************************************************************************
+          \brief Copy a decoded image (1-4 channels) into an RGBA8 level.
+        *************************************************************************************/
+        TextureCooker::MipLevel ToRgba8(const Graphics::DecodedImage& image)
+        {
+            TextureCooker::MipLevel level;
+            level.width = image.width;
+            level.height = image.height;
+            const std::size_t texels = static_cast<std::size_t>(image.width) * static_cast<std::size_t>(image.height);
+            level.data.resize(texels * 4u);
+
+            const unsigned char* src = image.pixels.get();
+            const int channels = image.channels;
+            for (std::size_t i = 0; i < texels; ++i) {
+                const unsigned char* p = src + i * static_cast<std::size_t>(channels);
+                std::uint8_t* d = level.data.data() + i * 4u;
+                switch (channels) {
+                case 1:  d[0] = d[1] = d[2] = p[0]; d[3] = 255; break;
+                case 2:  d[0] = d[1] = d[2] = p[0]; d[3] = p[1]; break;
+                case 3:  d[0] = p[0]; d[1] = p[1]; d[2] = p[2]; d[3] = 255; break;
+                default: d[0] = p[0]; d[1] = p[1]; d[2] = p[2]; d[3] = p[3]; break;
+                }
+            }
+            return level;
+        }
+
+        /*************************************************************************************
+          \brief Halve an RGBA8 level with an alpha-weighted 2x2 box filter.
+        *************************************************************************************/
+        TextureCooker::MipLevel Downsample(const TextureCooker::MipLevel& src)
+        {
+            TextureCooker::MipLevel dst;
+            dst.width = std::max(1, src.width / 2);
+            dst.height = std::max(1, src.height / 2);
+            dst.data.resize(static_cast<std::size_t>(dst.width) * static_cast<std::size_t>(dst.height) * 4u);
+
+            auto texel = [&src](int x, int y) {
+                x = std::min(x, src.width - 1);
+                y = std::min(y, src.height - 1);
+                return src.data.data() + (static_cast<std::size_t>(y) * static_cast<std::size_t>(src.width) + static_cast<std::size_t>(x)) * 4u;
+            };
+
+            for (int y = 0; y < dst.height; ++y) {
+                for (int x = 0; x < dst.width; ++x) {
+                    const std::uint8_t* taps[4] = {
+                        texel(2 * x, 2 * y), texel(2 * x + 1, 2 * y),
+                        texel(2 * x, 2 * y + 1), texel(2 * x + 1, 2 * y + 1) };
+
+                    unsigned alphaSum = 0;
+                    unsigned rgbWeighted[3] = { 0, 0, 0 };
+                    unsigned rgbPlain[3] = { 0, 0, 0 };
+                    for (const std::uint8_t* t : taps) {
+                        alphaSum += t[3];
+                        for (int c = 0; c < 3; ++c) {
+                            rgbWeighted[c] += static_cast<unsigned>(t[c]) * t[3];
+                            rgbPlain[c] += t[c];
+                        }
+                    }
+
+                    std::uint8_t* d = dst.data.data() + (static_cast<std::size_t>(y) * static_cast<std::size_t>(dst.width) + static_cast<std::size_t>(x)) * 4u;
+                    for (int c = 0; c < 3; ++c) {
+                        d[c] = static_cast<std::uint8_t>(alphaSum
+                            ? (rgbWeighted[c] + alphaSum / 2) / alphaSum
+                            : (rgbPlain[c] + 2) / 4);
+                    }
+                    d[3] = static_cast<std::uint8_t>((alphaSum + 2) / 4);
+                }
+            }
+            return dst;
+        }
+
+#if SOFASPUDS_HAS_BC7ENC
+        /*************************************************************************************
+          \brief Encode one RGBA8 level into BC7 blocks (edge texels clamp into partial blocks).
+        *************************************************************************************/
+        std::vector<std::uint8_t> EncodeBc7(const TextureCooker::MipLevel& level)
+        {
+            static std::once_flag initOnce;
+            std::call_once(initOnce, [] { bc7enc_compress_block_init(); });
+
+            bc7enc_compress_block_params params;
+            bc7enc_compress_block_params_init(&params);
+
+            const int blocksX = (level.width + 3) / 4;
+            const int blocksY = (level.height + 3) / 4;
+            std::vector<std::uint8_t> out(Bc7LevelBytes(level.width, level.height));
+
+            std::array<std::uint8_t, 16 * 4> block{};
+            for (int by = 0; by < blocksY; ++by) {
+                for (int bx = 0; bx < blocksX; ++bx) {
+                    for (int py = 0; py < 4; ++py) {
+                        const int y = std::min(by * 4 + py, level.height - 1);
+                        for (int px = 0; px < 4; ++px) {
+                            const int x = std::min(bx * 4 + px, level.width - 1);
+                            std::memcpy(block.data() + (py * 4 + px) * 4,
+                                level.data.data() + (static_cast<std::size_t>(y) * static_cast<std::size_t>(level.width) + static_cast<std::size_t>(x)) * 4u, 4);
+                        }
+                    }
+                    bc7enc_compress_block(out.data() + (static_cast<std::size_t>(by) * static_cast<std::size_t>(blocksX) + static_cast<std::size_t>(bx)) * kBc7BlockBytes,
+                        block.data(), &params);
+                }
+            }
+            return out;
+        }
+#endif
+
+        void WriteU32(std::ofstream& out, std::uint32_t v)
+        {
+            const unsigned char b[4] = {
+                static_cast<unsigned char>(v), static_cast<unsigned char>(v >> 8),
+                static_cast<unsigned char>(v >> 16), static_cast<unsigned char>(v >> 24) };
+            out.write(reinterpret_cast<const char*>(b), 4);
+        }
+
+        bool ReadU32(std::ifstream& in, std::uint32_t& v)
+        {
+            unsigned char b[4];
+            if (!in.read(reinterpret_cast<char*>(b), 4))
+                return false;
+            v = static_cast<std::uint32_t>(b[0]) | (static_cast<std::uint32_t>(b[1]) << 8)
+                | (static_cast<std::uint32_t>(b[2]) << 16) | (static_cast<std::uint32_t>(b[3]) << 24);
+            return true;
+        }
+
+        /*************************************************************************************
+          \brief Write \a tex to \a file via a temporary so a half-written file is never read.
+        *************************************************************************************/
+        bool WriteCooked(const fs::path& file, const TextureCooker::CookedTexture& tex)
+        {
+            std::error_code ec;
+            fs::create_directories(file.parent_path(), ec);
+
+            fs::path tmp = file;
+            tmp += ".tmp";
+            {
+                std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+                if (!out.is_open())
+                    return false;
+                out.write(kMagic, sizeof(kMagic));
+                WriteU32(out, kVersion);
+                WriteU32(out, static_cast<std::uint32_t>(tex.format));
+                WriteU32(out, static_cast<std::uint32_t>(tex.width()));
+                WriteU32(out, static_cast<std::uint32_t>(tex.height()));
+                WriteU32(out, static_cast<std::uint32_t>(tex.mips.size()));
+                for (const TextureCooker::MipLevel& level : tex.mips) {
+                    WriteU32(out, static_cast<std::uint32_t>(level.width));
+                    WriteU32(out, static_cast<std::uint32_t>(level.height));
+                    WriteU32(out, static_cast<std::uint32_t>(level.data.size()));
+                    out.write(reinterpret_cast<const char*>(level.data.data()), static_cast<std::streamsize>(level.data.size()));
+                }
+                if (!out)
+                    return false;
+            }
+
+            fs::rename(tmp, file, ec);
+            if (ec) {
+                fs::remove(file, ec);
+                fs::rename(tmp, file, ec);
+            }
+            return !ec;
+        }
+
+        bool IsCurrent(const fs::path& source, const fs::path& cooked)
+        {
+            std::error_code ec;
+            const auto cookedTime = fs::last_write_time(cooked, ec);
+            if (ec)
+                return false;
+            const auto sourceTime = fs::last_write_time(source, ec);
+            return !ec && cookedTime >= sourceTime;
+        }
+
+        bool IsSourceImage(const fs::path& path)
+        {
+            std::string ext = path.extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(),
+                [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return ext == ".png" || ext == ".jpg" || ext == ".jpeg";
+        }
+    } // anonymous namespace
+
+    std::size_t TextureCooker::CookedTexture::bytes() const {
+        std::size_t total = 0;
+        for (const MipLevel& level : mips)
+            total += level.data.size();
+        return total;
+    }
+
+    bool TextureCooker::encoderAvailable() {
+#if SOFASPUDS_HAS_BC7ENC
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    TextureCooker::Format TextureCooker::defaultFormat() {
+        return encoderAvailable() ? Format::BC7 : Format::RGBA8;
+    }
+
+    fs::path TextureCooker::cookedPathFor(const fs::path& source) {
+        const fs::path root = Framework::FindAssetsRoot();
+        if (root.empty())
+            return {};
+
+        std::error_code ec;
+        const fs::path absRoot = fs::absolute(root, ec).lexically_normal();
+        const fs::path absSource = fs::absolute(source, ec).lexically_normal();
+        const fs::path relative = absSource.lexically_relative(absRoot);
+        if (ec || relative.empty() || *relative.begin() == "..")
+            return {};
+
+        fs::path cooked = absRoot / "Cooked" / relative;
+        cooked += ".sstex";
+        return cooked;
+    }
+
+    /*****************************************************************************************
+     \brief  Decode \a source, build its mip chain, encode it and write the cooked file.
+     \note   Requesting BC7 without the encoder compiled in silently writes RGBA8.
+    ******************************************************************************************/
+    bool TextureCooker::cookFile(const fs::path& source, Format format,
+        std::size_t* rgba8Bytes, std::size_t* cookedBytes) {
+        const fs::path target = cookedPathFor(source);
+        if (target.empty()) {
+            std::cerr << "[TextureCooker] Not under the assets root: " << source.string() << "\n";
+            return false;
+        }
+
+        const Graphics::DecodedImage image = Graphics::decodeTexture(source.string().c_str());
+        if (!image.pixels || image.width <= 0 || image.height <= 0) {
+            std::cerr << "[TextureCooker] Failed to decode: " << source.string() << "\n";
+            return false;
+        }
+
+        std::vector<MipLevel> chain;
+        chain.push_back(ToRgba8(image));
+        while ((chain.back().width > 1 || chain.back().height > 1) && chain.size() < kMaxMips)
+            chain.push_back(Downsample(chain.back()));
+
+        std::size_t rawBytes = 0;
+        for (const MipLevel& level : chain)
+            rawBytes += level.data.size();
+
+        CookedTexture cooked;
+        cooked.format = encoderAvailable() ? format : Format::RGBA8;
+#if SOFASPUDS_HAS_BC7ENC
+        if (cooked.format == Format::BC7) {
+            for (MipLevel& level : chain)
+                level.data = EncodeBc7(level);
+        }
+#endif
+        cooked.mips = std::move(chain);
+
+        if (!WriteCooked(target, cooked)) {
+            std::cerr << "[TextureCooker] Failed to write: " << target.string() << "\n";
+            return false;
+        }
+
+        if (rgba8Bytes) *rgba8Bytes = rawBytes;
+        if (cookedBytes) *cookedBytes = cooked.bytes();
+        return true;
+    }
+
+    /*****************************************************************************************
+     \brief  Cook every stale texture under \a directory, one TaskGraph task per file.
+     \note   Blocks until all files are done; the calling thread helps run the tasks.
+    ******************************************************************************************/
+    TextureCooker::CookReport TextureCooker::cookDirectory(const fs::path& directory, bool force) {
+        struct Job {
+            fs::path    source;
+            bool        ok = false;
+            std::size_t rgba8 = 0;
+            std::size_t cooked = 0;
+        };
+
+        CookReport report;
+        const auto start = Framework::TaskGraph::Clock::now();
+
+        std::vector<Job> jobs;
+        std::error_code ec;
+        for (auto it = fs::recursive_directory_iterator(directory, ec);
+            !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+            if (!it->is_regular_file(ec) || !IsSourceImage(it->path()))
+                continue;
+            const fs::path target = cookedPathFor(it->path());
+            if (!force && !target.empty() && IsCurrent(it->path(), target)) {
+                ++report.upToDate;
+                continue;
+            }
+            jobs.push_back({ it->path() });
+        }
+
+        const Format format = defaultFormat();
+        Framework::TaskGraph graph;
+        for (Job& job : jobs) {
+            graph.Add(job.source.filename().string(), "texture_cook",
+                [&job, format] { job.ok = cookFile(job.source, format, &job.rgba8, &job.cooked); });
+        }
+        graph.Start();
+        report.workers = graph.WorkerCount();
+        graph.WaitAll();
+
+        for (const Job& job : jobs) {
+            if (!job.ok) {
+                ++report.failed;
+                continue;
+            }
+            ++report.cooked;
+            report.rgba8Bytes += job.rgba8;
+            report.cookedBytes += job.cooked;
+        }
+        report.wallMs = std::chrono::duration<double, std::milli>(Framework::TaskGraph::Clock::now() - start).count();
+
+        std::cout << "[TextureCooker] " << (format == Format::BC7 ? "BC7" : "RGBA8") << ": cooked "
+            << report.cooked << ", up to date " << report.upToDate << ", failed " << report.failed
+            << " (" << report.rgba8Bytes / (1024 * 1024) << " MB -> "
+            << report.cookedBytes / (1024 * 1024) << " MB) in " << report.wallMs << " ms\n";
+
+        std::lock_guard<std::mutex> lock(gReportMutex);
+        gLastReport = report;
+        return report;
+    }
+
+    bool TextureCooker::loadCooked(const fs::path& source, CookedTexture& out) {
+        const fs::path file = cookedPathFor(source);
+        if (file.empty() || !IsCurrent(source, file))
+            return false;
+
+        std::ifstream in(file, std::ios::binary);
+        if (!in.is_open())
+            return false;
+
+        char magic[4];
+        std::uint32_t version = 0, format = 0, width = 0, height = 0, mipCount = 0;
+        if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0
+            || !ReadU32(in, version) || version != kVersion
+            || !ReadU32(in, format) || format > static_cast<std::uint32_t>(Format::BC7)
+            || !ReadU32(in, width) || !ReadU32(in, height)
+            || !ReadU32(in, mipCount) || mipCount == 0 || mipCount > kMaxMips) {
+            std::cerr << "[TextureCooker] Ignoring invalid cooked file: " << file.string() << "\n";
+            return false;
+        }
+
+        CookedTexture tex;
+        tex.format = static_cast<Format>(format);
+        tex.mips.resize(mipCount);
+        for (MipLevel& level : tex.mips) {
+            std::uint32_t w = 0, h = 0, size = 0;
+            if (!ReadU32(in, w) || !ReadU32(in, h) || !ReadU32(in, size)
+                || w == 0 || h == 0 || size != ExpectedLevelBytes(tex.format, static_cast<int>(w), static_cast<int>(h))) {
+                std::cerr << "[TextureCooker] Ignoring truncated cooked file: " << file.string() << "\n";
+                return false;
+            }
+            level.width = static_cast<int>(w);
+            level.height = static_cast<int>(h);
+            level.data.resize(size);
+            if (!in.read(reinterpret_cast<char*>(level.data.data()), static_cast<std::streamsize>(size)))
+                return false;
+        }
+
+        if (tex.width() != static_cast<int>(width) || tex.height() != static_cast<int>(height))
+            return false;
+
+        out = std::move(tex);
+        return true;
+    }
+
+    TextureCooker::CookReport TextureCooker::lastReport() {
+        std::lock_guard<std::mutex> lock(gReportMutex);
+        return gLastReport;
+    }
+}
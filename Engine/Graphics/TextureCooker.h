@@ -0,0 +1,113 @@
+/*********************************************************************************************
+ \file      TextureCooker.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Declares TextureCooker, the offline texture stage that turns source images into
+            GPU-ready cooked files (BC7 or RGBA8) with a precomputed mip chain.
+ \details   Cooking reads a source .png/.jpg, builds the full mip chain on the CPU and, when
+            the engine is built with the bc7enc encoder (SOFASPUDS_HAS_BC7ENC), compresses
+            every level to BC7 (8 bits per texel instead of 32). Without the encoder the same
+            container is written with RGBA8 levels, so the runtime still skips decoding and
+            glGenerateMipmap. The encoder is only fetched at the commit given in the CMake
+            cache variable SOFASPUDS_BC7ENC_COMMIT, so the cooked bytes cannot change while
+            the tree stays the same.
+
+            Cooked files live in a mirror of the assets tree:
+                assets/Textures/Environment/Floor.png -> assets/Cooked/Textures/Environment/Floor.png.sstex
+            and are only used while they are newer than their source. Graphics::loadTexture()
+            picks the cooked file when the driver can sample its format, otherwise it falls
+            back to decoding the source as before.
+
+            File layout (little-endian):
+                "SSTX" | u32 version | u32 format | u32 width | u32 height | u32 mipCount
+                mipCount x { u32 width | u32 height | u32 byteSize | bytes }
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace gfx {
+
+    /*****************************************************************************************
+      \class TextureCooker
+      \brief Static cook/load helpers for the cooked texture container.
+    *****************************************************************************************/
+    class TextureCooker {
+    public:
+        enum class Format : std::uint32_t { RGBA8 = 0, BC7 = 1 };
+
+        /// One level of the mip chain, tightly packed (RGBA8 rows or 4x4 BC7 blocks).
+        struct MipLevel {
+            int width = 0;
+            int height = 0;
+            std::vector<std::uint8_t> data;
+        };
+
+        /// A cooked texture as stored on disk; level 0 is the full-size image.
+        struct CookedTexture {
+            Format format = Format::RGBA8;
+            std::vector<MipLevel> mips;
+
+            int width() const { return mips.empty() ? 0 : mips.front().width; }
+            int height() const { return mips.empty() ? 0 : mips.front().height; }
+            std::size_t bytes() const;
+        };
+
+        /// Outcome of the last CookDirectory() run, shown in the performance overlay.
+        struct CookReport {
+            std::size_t cooked = 0;       ///< Files written this run
+            std::size_t upToDate = 0;     ///< Files skipped because the cooked copy is current
+            std::size_t failed = 0;       ///< Sources that could not be decoded or written
+            std::size_t rgba8Bytes = 0;   ///< RGBA8 + mips size of the files cooked this run
+            std::size_t cookedBytes = 0;  ///< Size of their cooked levels
+            unsigned    workers = 0;
+            double      wallMs = 0.0;
+        };
+
+        /**
+         * \brief True when the BC7 encoder is compiled in; otherwise cooking writes RGBA8.
+         */
+        static bool encoderAvailable();
+
+        /**
+         * \brief Format written by default: BC7 if the encoder is available, else RGBA8.
+         */
+        static Format defaultFormat();
+
+        /**
+         * \brief Location of the cooked file for \a source (empty if it is outside assets/).
+         */
+        static std::filesystem::path cookedPathFor(const std::filesystem::path& source);
+
+        /**
+         * \brief Decode, mip and encode one source image and write its cooked file.
+         * \param rgba8Bytes  Optional; receives the RGBA8 size of the mip chain.
+         * \param cookedBytes Optional; receives the size of the cooked levels.
+         * \return True if the cooked file was written.
+         * \note  Thread-safe; CookDirectory() runs one call per file on worker threads.
+         */
+        static bool cookFile(const std::filesystem::path& source, Format format,
+            std::size_t* rgba8Bytes = nullptr, std::size_t* cookedBytes = nullptr);
+
+        /**
+         * \brief Cook every texture under \a directory in parallel.
+         * \param force Re-cook files whose cooked copy is already up to date.
+         */
+        static CookReport cookDirectory(const std::filesystem::path& directory, bool force = false);
+
+        /**
+         * \brief Read the cooked file for \a source if it exists and is newer than the source.
+         * \return True if \a out holds a complete, validated mip chain.
+         * \note  No GL calls; safe on worker threads.
+         */
+        static bool loadCooked(const std::filesystem::path& source, CookedTexture& out);
+
+        static CookReport lastReport();
+    };
+}
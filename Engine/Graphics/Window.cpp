@@ -209,6 +209,15 @@ namespace gfx {
         glfwSwapBuffers(s_window);
     }
 
+    /*************************************************************************************
+      \brief Enable or disable vsync on the window's context.
+
+      Wraps glfwSwapInterval(); Core applies FramePacing's vsync setting through this.
+    *************************************************************************************/
+    void Window::SetVSync(bool on) {
+        glfwSwapInterval(on ? 1 : 0);
+    }
+
     /*************************************************************************************
       \brief Sync internal focus/iconify flags from GLFW window attributes.
 
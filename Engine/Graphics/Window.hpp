@@ -52,6 +52,9 @@ namespace gfx {
         // Present the back buffer.
         void swapBuffers();
 
+        // Swap interval 1 (vsync) or 0 (present immediately). Requires the GL context.
+        void SetVSync(bool on);
+
         // Static GLFW error callback.
         static void error_cb(int error, const char* description);
 
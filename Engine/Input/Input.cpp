@@ -12,6 +12,7 @@
 *********************************************************************************************/
 
 #include "Input.h"
+#include "Input/InputRecorder.h"
 #if defined(APIENTRY)
 #  undef APIENTRY
 #endif
@@ -26,6 +27,13 @@
 #endif
 namespace Framework
 {
+    namespace
+    {
+        // Written by SampleWindow() before the frame's steps are kicked, read by Update();
+        // SimulationThread::Sync() ends the steps before the next frame samples again.
+        InputSample gFrameSample;
+    }
+
     /*****************************************************************************************
         \brief Constructor for the InputManager class. This is to ensure that no
                key gets stuck in the "pressed" state and no mouse button is considered
@@ -44,6 +52,10 @@ namespace Framework
     /*****************************************************************************************
     \brief Updates the inputs and ensures that any key that isn't held is cleared. Also
            updates the position of the mouse cursor.
+    \note  The held state is the frame's sample taken by SampleWindow() on the main thread,
+           or comes from InputRecorder while a replay runs; the sample is handed to the
+           recorder while recording. Pressed/released are derived the same way in all cases.
+           No GLFW call is made here, so this is safe on the simulation thread.
     *****************************************************************************************/
     void InputManager::Update()
     {
@@ -52,20 +64,20 @@ namespace Framework
         std::fill(m_mousePressed.begin(), m_mousePressed.end(), false);
         std::fill(m_mouseReleased.begin(), m_mouseReleased.end(), false);
 
-        if (!m_window)
-            return;
+        InputSample sample;
+        if (!InputRecorder::ReadStep(sample))
+        {
+            if (!m_window)
+                return;
+            sample = gFrameSample;
+            InputRecorder::WriteStep(sample);
+        }
 
         // Keyboard
         for (int key = 0; key <= GLFW_KEY_LAST; ++key)
         {
-            if (key < GLFW_KEY_SPACE) {
-                m_keyHeld[key] = false;
-                continue;
-            }
-
-            int state = glfwGetKey(m_window, key);
             bool wasHeld = m_keyHeld[key];
-            bool isHeld = (state == GLFW_PRESS) || (state == GLFW_REPEAT);
+            bool isHeld = sample.keys.test(key);
 
             if (isHeld) {
                 if (!wasHeld) m_keyPressed[key] = true;
@@ -80,9 +92,8 @@ namespace Framework
         // Mouse buttons
         for (int btn = 0; btn <= GLFW_MOUSE_BUTTON_LAST; ++btn)
         {
-            int state = glfwGetMouseButton(m_window, btn);
             bool wasHeld = m_mouseHeld[btn];
-            bool isHeld = (state == GLFW_PRESS);
+            bool isHeld = (sample.mouseButtons >> btn) & 1u;
 
             if (isHeld)
             {
@@ -98,7 +109,8 @@ namespace Framework
         }
 
         // Mouse position
-        glfwGetCursorPos(m_window, &m_mouseState.x, &m_mouseState.y);
+        m_mouseState.x = sample.mouseX;
+        m_mouseState.y = sample.mouseY;
 
         // Validate mouse button indices at compile time
         static_assert(GLFW_MOUSE_BUTTON_LEFT >= 0 && GLFW_MOUSE_BUTTON_LEFT <= GLFW_MOUSE_BUTTON_LAST,
@@ -109,6 +121,45 @@ namespace Framework
         m_mouseState.leftClick = m_mouseHeld[GLFW_MOUSE_BUTTON_LEFT];
         m_mouseState.rightClick = m_mouseHeld[GLFW_MOUSE_BUTTON_RIGHT];
     }
+
+    /*****************************************************************************************
+    \brief Samples \a window for this frame's Update() calls. Core::Run calls it right after
+           pollEvents(), before a pipelined frame hands the steps to the simulation thread,
+           since GLFW's input functions must be called from the main thread.
+    *****************************************************************************************/
+    void InputManager::SampleWindow(GLFWwindow* window)
+    {
+        if (!window)
+            return;
+        if (InputRecorder::ConsumeQuitRequest())
+            glfwSetWindowShouldClose(window, GLFW_TRUE); // a --replay run just ended
+        InputSample sample;
+        PollWindow(window, sample);
+        gFrameSample = sample;
+    }
+
+    /*****************************************************************************************
+    \brief Reads the raw held state of every key and mouse button, and the cursor, from GLFW.
+           Keys below GLFW_KEY_SPACE are never reported as held.
+    *****************************************************************************************/
+    void InputManager::PollWindow(GLFWwindow* window, InputSample& sample)
+    {
+        static_assert(InputSample::kKeyCount == GLFW_KEY_LAST + 1, "InputSample key range out of date");
+        static_assert(InputSample::kMouseButtonCount == GLFW_MOUSE_BUTTON_LAST + 1,
+            "InputSample mouse button range out of date");
+
+        for (int key = GLFW_KEY_SPACE; key <= GLFW_KEY_LAST; ++key)
+        {
+            int state = glfwGetKey(window, key);
+            sample.keys.set(key, (state == GLFW_PRESS) || (state == GLFW_REPEAT));
+        }
+        for (int btn = 0; btn <= GLFW_MOUSE_BUTTON_LAST; ++btn)
+        {
+            if (glfwGetMouseButton(window, btn) == GLFW_PRESS)
+                sample.mouseButtons |= static_cast<std::uint8_t>(1u << btn);
+        }
+        glfwGetCursorPos(window, &sample.mouseX, &sample.mouseY);
+    }
     /*****************************************************************************************
     \brief A boolean to check if the key has been pressed
     \return True if it's pressed, false if it isn't
@@ -18,6 +18,8 @@ struct GLFWwindow;
 
 namespace Framework
 {
+	struct InputSample;
+
 	/*****************************************************************************************
 	  \brief The state of the mouse that can be used if needed.
 	*****************************************************************************************/
@@ -41,6 +43,10 @@ namespace Framework
 
 		void Update();
 
+		// Main thread, once per frame after pollEvents(): read the window into the sample
+		// that this frame's Update() calls consume (they may run on the simulation thread).
+		static void SampleWindow(GLFWwindow* window);
+
 		// Keyboard queries
 		bool IsKeyPressed(int key) const;
 		bool IsKeyHeld(int key) const;
@@ -54,6 +60,8 @@ namespace Framework
 		void ClearState();
 
 	private:
+		static void PollWindow(GLFWwindow* window, InputSample& sample);
+
 		GLFWwindow* m_window;
 
 		std::vector<bool> m_keyHeld;
@@ -0,0 +1,452 @@
+/*********************************************************************************************
+ \file      InputRecorder.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements InputRecorder: delta-encoded step records, lockstep replay and the
+            frame-time results file.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Input/InputRecorder.h"
+#include "Core/FramePacing.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+#include <vector>
+#include "../ThirdParty/json_dep/json.hpp"
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        constexpr char          kMagic[4] = { 'S', 'S', 'I', 'R' };
+        constexpr std::uint16_t kVersion = 1;
+
+        enum StepFlags : std::uint8_t
+        {
+            kKeysChanged = 1,
+            kButtonsChanged = 2,
+            kCursorMoved = 4,
+        };
+
+        struct RecorderState
+        {
+            std::mutex              mutex;
+            InputRecorder::Mode     mode = InputRecorder::Mode::Off;
+            std::filesystem::path   file;
+            std::uint64_t           steps = 0;
+            int                     simulationHz = 0;
+            std::string             level;          // noted by LogicSystem / read from the file
+            InputSample             previous;       // last step written or read
+
+            // Recording
+            std::ofstream           out;
+            bool                    headerWritten = false;
+
+            // Replay
+            std::vector<std::uint8_t> data;
+            std::size_t             cursor = 0;
+            bool                    quitWhenDone = false;
+            bool                    quitRequested = false;
+            FramePacing::Settings   savedPacing;
+            Clock::time_point       lastStep{};
+            std::vector<float>      frameMs;
+
+            InputRecorder::Results  results;
+        };
+
+        RecorderState& State()
+        {
+            static RecorderState state;
+            return state;
+        }
+
+        void PutU16(std::ofstream& out, std::uint16_t v)
+        {
+            const char bytes[2] = { static_cast<char>(v & 0xFF), static_cast<char>(v >> 8) };
+            out.write(bytes, 2);
+        }
+
+        void PutF32(std::ofstream& out, float f)
+        {
+            std::uint32_t v = 0;
+            std::memcpy(&v, &f, sizeof(v));
+            const char bytes[4] = { static_cast<char>(v & 0xFF), static_cast<char>((v >> 8) & 0xFF),
+                static_cast<char>((v >> 16) & 0xFF), static_cast<char>(v >> 24) };
+            out.write(bytes, 4);
+        }
+
+        /// Bounds-checked little-endian reader over the loaded replay.
+        struct Reader
+        {
+            const std::vector<std::uint8_t>& data;
+            std::size_t&                     cursor;
+
+            bool Has(std::size_t bytes) const { return data.size() - cursor >= bytes; }
+            std::uint8_t U8() { return data[cursor++]; }
+            std::uint16_t U16()
+            {
+                const std::uint16_t v = static_cast<std::uint16_t>(data[cursor] | (data[cursor + 1] << 8));
+                cursor += 2;
+                return v;
+            }
+            float F32()
+            {
+                const std::uint32_t v = static_cast<std::uint32_t>(data[cursor]) |
+                    (static_cast<std::uint32_t>(data[cursor + 1]) << 8) |
+                    (static_cast<std::uint32_t>(data[cursor + 2]) << 16) |
+                    (static_cast<std::uint32_t>(data[cursor + 3]) << 24);
+                cursor += 4;
+                float f = 0.0f;
+                std::memcpy(&f, &v, sizeof(f));
+                return f;
+            }
+        };
+
+        void WriteHeader(RecorderState& state)
+        {
+            state.simulationHz = FramePacing::GetSettings().simulationHz;
+            const std::uint16_t levelLength = static_cast<std::uint16_t>(std::min<std::size_t>(state.level.size(), 0xFFFF));
+            state.out.write(kMagic, sizeof(kMagic));
+            PutU16(state.out, kVersion);
+            PutU16(state.out, static_cast<std::uint16_t>(state.simulationHz));
+            PutU16(state.out, levelLength);
+            state.out.write(state.level.data(), levelLength);
+            state.headerWritten = true;
+        }
+
+        /// Frame-time percentiles over the replay, written as <recording>.results.json.
+        void FinishReplay(RecorderState& state, bool completed)
+        {
+            InputRecorder::Results results;
+            results.valid = true;
+            results.completed = completed;
+            results.steps = state.steps;
+            results.frames = state.frameMs.size();
+            if (!state.frameMs.empty())
+            {
+                std::vector<float> sorted = state.frameMs;
+                std::sort(sorted.begin(), sorted.end());
+                auto percentile = [&sorted](double p) {
+                    const std::size_t rank = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+                    return static_cast<double>(sorted[rank]);
+                };
+                double sum = 0.0;
+                for (float ms : sorted)
+                    sum += ms;
+                results.seconds = sum / 1000.0;
+                results.minMs = sorted.front();
+                results.avgMs = sum / static_cast<double>(sorted.size());
+                results.p50Ms = percentile(0.50);
+                results.p95Ms = percentile(0.95);
+                results.p99Ms = percentile(0.99);
+                results.maxMs = sorted.back();
+            }
+            state.results = results;
+
+            std::filesystem::path resultsFile = state.file;
+            resultsFile.replace_extension(".results.json");
+            const nlohmann::json json = {
+                { "recording", state.file.filename().string() },
+                { "level", state.level },
+                { "simulationHz", state.simulationHz },
+                { "completed", results.completed },
+                { "steps", results.steps },
+                { "frames", results.frames },
+                { "seconds", results.seconds },
+                { "frameMs", {
+                    { "min", results.minMs }, { "avg", results.avgMs }, { "p50", results.p50Ms },
+                    { "p95", results.p95Ms }, { "p99", results.p99Ms }, { "max", results.maxMs } } } };
+            std::ofstream out(resultsFile, std::ios::out | std::ios::trunc);
+            if (out.is_open())
+                out << json.dump(2) << "\n";
+            else
+                std::cerr << "[InputRecorder] Failed to write " << resultsFile.string() << "\n";
+
+            std::cout << "[InputRecorder] Replay " << (completed ? "finished" : "stopped") << ": "
+                << results.steps << " steps, avg " << results.avgMs << " ms, p95 " << results.p95Ms
+                << " ms, p99 " << results.p99Ms << " ms, max " << results.maxMs << " ms\n";
+
+            FramePacing::SetLockstep(false);
+            FramePacing::SetVSync(state.savedPacing.vsync);
+            FramePacing::SetFrameCap(state.savedPacing.frameCap);
+            FramePacing::SetSimulationHz(state.savedPacing.simulationHz);
+
+            state.quitRequested = completed && state.quitWhenDone;
+            state.mode = InputRecorder::Mode::Off;
+            state.data.clear();
+            state.data.shrink_to_fit();
+            state.frameMs.clear();
+            state.frameMs.shrink_to_fit();
+        }
+    }
+
+    bool InputRecorder::StartRecording(const std::filesystem::path& file)
+    {
+        Stop();
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        std::error_code ec;
+        if (file.has_parent_path())
+            std::filesystem::create_directories(file.parent_path(), ec);
+        state.out.open(file, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!state.out.is_open())
+        {
+            std::cerr << "[InputRecorder] Failed to open " << file.string() << " for recording\n";
+            return false;
+        }
+        state.mode = Mode::Recording;
+        state.file = file;
+        state.steps = 0;
+        state.previous = InputSample{};
+        state.headerWritten = false;
+        std::cout << "[InputRecorder] Recording input to " << file.string() << "\n";
+        return true;
+    }
+
+    bool InputRecorder::StartReplay(const std::filesystem::path& file, bool quitWhenDone)
+    {
+        Stop();
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        std::ifstream in(file, std::ios::in | std::ios::binary);
+        if (!in.is_open())
+        {
+            std::cerr << "[InputRecorder] Failed to open " << file.string() << " for replay\n";
+            return false;
+        }
+        std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        std::size_t cursor = 0;
+        Reader reader{ data, cursor };
+        if (!reader.Has(10) || std::memcmp(data.data(), kMagic, sizeof(kMagic)) != 0)
+        {
+            std::cerr << "[InputRecorder] " << file.string() << " is not an input recording\n";
+            return false;
+        }
+        cursor += sizeof(kMagic);
+        const std::uint16_t version = reader.U16();
+        const std::uint16_t hz = reader.U16();
+        const std::uint16_t levelLength = reader.U16();
+        if (version != kVersion || !reader.Has(levelLength))
+        {
+            std::cerr << "[InputRecorder] " << file.string() << ": unsupported version " << version << "\n";
+            return false;
+        }
+
+        state.level.assign(reinterpret_cast<const char*>(data.data() + cursor), levelLength);
+        cursor += levelLength;
+        state.data = std::move(data);
+        state.cursor = cursor;
+        state.mode = Mode::Replaying;
+        state.file = file;
+        state.steps = 0;
+        state.simulationHz = hz;
+        state.previous = InputSample{};
+        state.quitWhenDone = quitWhenDone;
+        state.quitRequested = false;
+        state.frameMs.clear();
+        state.frameMs.reserve((state.data.size() - cursor) + 1);    // at most one step per byte
+
+        state.savedPacing = FramePacing::GetSettings();
+        FramePacing::SetSimulationHz(hz);
+        FramePacing::SetVSync(false);
+        FramePacing::SetFrameCap(0);
+        FramePacing::SetLockstep(true);
+
+        std::cout << "[InputRecorder] Replaying " << file.string() << " (" << hz << " Hz, level '"
+            << state.level << "')\n";
+        return true;
+    }
+
+    void InputRecorder::Stop()
+    {
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.mode == Mode::Recording)
+        {
+            if (!state.headerWritten)
+                WriteHeader(state);
+            state.out.close();
+            state.mode = Mode::Off;
+            std::cout << "[InputRecorder] Recorded " << state.steps << " steps to " << state.file.string() << "\n";
+        }
+        else if (state.mode == Mode::Replaying)
+        {
+            FinishReplay(state, false);
+        }
+    }
+
+    InputRecorder::Mode InputRecorder::GetMode()
+    {
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.mode;
+    }
+
+    InputRecorder::Status InputRecorder::GetStatus()
+    {
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return Status{ state.mode, state.file, state.steps, state.simulationHz, state.level };
+    }
+
+    InputRecorder::Results InputRecorder::LastResults()
+    {
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.results;
+    }
+
+    void InputRecorder::NoteStartLevel(const std::string& levelFile)
+    {
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.mode != Mode::Replaying)
+            state.level = levelFile;
+    }
+
+    std::string InputRecorder::ReplayStartLevel()
+    {
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.mode == Mode::Replaying ? state.level : std::string{};
+    }
+
+    /*****************************************************************************************
+      \brief Only what changed since the previous step is written: toggled key codes, the
+             button byte, and the cursor as two floats.
+    *****************************************************************************************/
+    void InputRecorder::WriteStep(const InputSample& sample)
+    {
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.mode != Mode::Recording)
+            return;
+        if (!state.headerWritten)
+            WriteHeader(state);
+
+        const std::bitset<InputSample::kKeyCount> toggled = sample.keys ^ state.previous.keys;
+        const float x = static_cast<float>(sample.mouseX);
+        const float y = static_cast<float>(sample.mouseY);
+        const bool moved = x != static_cast<float>(state.previous.mouseX) || y != static_cast<float>(state.previous.mouseY);
+
+        std::uint8_t flags = 0;
+        if (toggled.any())
+            flags |= kKeysChanged;
+        if (sample.mouseButtons != state.previous.mouseButtons)
+            flags |= kButtonsChanged;
+        if (moved || state.steps == 0)
+            flags |= kCursorMoved;
+
+        state.out.put(static_cast<char>(flags));
+        if (flags & kKeysChanged)
+        {
+            PutU16(state.out, static_cast<std::uint16_t>(toggled.count()));
+            for (int key = 0; key < InputSample::kKeyCount; ++key)
+            {
+                if (toggled.test(key))
+                    PutU16(state.out, static_cast<std::uint16_t>(key));
+            }
+        }
+        if (flags & kButtonsChanged)
+            state.out.put(static_cast<char>(sample.mouseButtons));
+        if (flags & kCursorMoved)
+        {
+            PutF32(state.out, x);
+            PutF32(state.out, y);
+        }
+
+        state.previous = sample;
+        state.previous.mouseX = x;  // compare against what the replay will reconstruct
+        state.previous.mouseY = y;
+        ++state.steps;
+    }
+
+    bool InputRecorder::ReadStep(InputSample& sample)
+    {
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.mode != Mode::Replaying)
+            return false;
+
+        const Clock::time_point now = Clock::now();
+        if (state.steps > 0)
+            state.frameMs.push_back(std::chrono::duration<float, std::milli>(now - state.lastStep).count());
+        state.lastStep = now;
+
+        Reader reader{ state.data, state.cursor };
+        if (!reader.Has(1))
+        {
+            FinishReplay(state, true);
+            return false;
+        }
+
+        InputSample next = state.previous;
+        const std::uint8_t flags = reader.U8();
+        bool truncated = false;
+        if (flags & kKeysChanged)
+        {
+            truncated = !reader.Has(2);
+            const std::uint16_t count = truncated ? 0 : reader.U16();
+            truncated = truncated || !reader.Has(std::size_t{ 2 } * count);
+            for (std::uint16_t i = 0; i < count && !truncated; ++i)
+            {
+                const std::uint16_t key = reader.U16();
+                if (key < InputSample::kKeyCount)
+                    next.keys.flip(key);
+            }
+        }
+        if ((flags & kButtonsChanged) && !truncated)
+        {
+            truncated = !reader.Has(1);
+            if (!truncated)
+                next.mouseButtons = reader.U8();
+        }
+        if ((flags & kCursorMoved) && !truncated)
+        {
+            truncated = !reader.Has(8);
+            if (!truncated)
+            {
+                next.mouseX = reader.F32();
+                next.mouseY = reader.F32();
+            }
+        }
+        if (truncated)
+        {
+            std::cerr << "[InputRecorder] " << state.file.string() << " is truncated at step " << state.steps << "\n";
+            FinishReplay(state, false);
+            return false;
+        }
+
+        state.previous = next;
+        sample = next;
+        ++state.steps;
+        return true;
+    }
+
+    bool InputRecorder::ConsumeQuitRequest()
+    {
+        RecorderState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        const bool quit = state.quitRequested;
+        state.quitRequested = false;
+        return quit;
+    }
+}
@@ -0,0 +1,119 @@
+/*********************************************************************************************
+ \file      InputRecorder.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Records the keyboard/mouse state of every fixed step to a binary file and plays
+            it back, for reproducible performance runs.
+ \details   InputManager::Update() runs once per fixed step. While recording, it passes the
+            state it polled from GLFW to WriteStep(). While replaying, ReadStep() supplies
+            that state instead of GLFW. Gameplay then sees the same input on the same step
+            it did during the recording.
+
+            A replay turns on FramePacing lockstep (one step per frame, no suspend on focus
+            loss), switches vsync and the frame cap off, and uses the recording's simulation
+            rate. The start level is stored in the file. LogicSystem loads that level instead
+            of its default, so "level file + recording" is the whole benchmark. Record from
+            launch (main.cpp: --record <file>, --replay <file>), since the replay starts from
+            a freshly started game.
+
+            When the replay ends, the frame times measured during it (min, mean, p50, p95,
+            p99, max) are written next to the recording as <name>.results.json. They are also
+            available from LastResults(). A command-line replay then closes the window.
+
+            File layout (little-endian): "SSIR", u16 version, u16 simulation Hz, u16 level
+            name length, level name bytes, then one record per step:
+              u8 flags  (1 = keys changed, 2 = mouse buttons changed, 4 = cursor moved)
+              [u16 count, count x u16 key codes that toggled]  if flags & 1
+              [u8 mouse button bits]                           if flags & 2
+              [f32 x, f32 y]                                   if flags & 4
+            A step where nothing changed costs one byte.
+
+            Gameplay randomness is already seeded per entity (enemy decision trees). AI level of
+            detail would otherwise choose enemies by measured CPU time and the camera view, so
+            under lockstep AiSystem uses the fixed far slice and the near radius only. The same
+            recording therefore simulates the same steps on a slower or faster build, which is
+            what makes replays comparable across builds. Particle and audio variation can still
+            differ between runs, but they do not feed back into the simulation.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace Framework
+{
+    /// One step's raw input, as InputManager reads it from GLFW.
+    struct InputSample
+    {
+        static constexpr int kKeyCount = 349;           ///< GLFW_KEY_LAST + 1
+        static constexpr int kMouseButtonCount = 8;     ///< GLFW_MOUSE_BUTTON_LAST + 1
+
+        std::bitset<kKeyCount> keys;
+        std::uint8_t            mouseButtons = 0;       ///< Bit i = mouse button i held
+        double                  mouseX = 0.0;
+        double                  mouseY = 0.0;
+    };
+
+    /*****************************************************************************************
+      \class InputRecorder
+      \brief Static per-step input recorder / player used by InputManager.
+    *****************************************************************************************/
+    class InputRecorder
+    {
+    public:
+        enum class Mode : std::uint8_t { Off, Recording, Replaying };
+
+        struct Results
+        {
+            bool          valid = false;
+            bool          completed = false;   ///< False if the replay was stopped early
+            std::uint64_t steps = 0;
+            std::uint64_t frames = 0;          ///< Frame intervals measured (one per replayed step)
+            double        seconds = 0.0;
+            double        minMs = 0.0;
+            double        avgMs = 0.0;
+            double        p50Ms = 0.0;
+            double        p95Ms = 0.0;
+            double        p99Ms = 0.0;
+            double        maxMs = 0.0;
+        };
+
+        struct Status
+        {
+            Mode                  mode = Mode::Off;
+            std::filesystem::path file;
+            std::uint64_t         steps = 0;   ///< Steps written or read so far
+            int                   simulationHz = 0;
+            std::string           level;
+        };
+
+        /// Start writing every step to \a file. Returns false if it cannot be opened.
+        static bool StartRecording(const std::filesystem::path& file);
+        /// Load \a file and feed it to InputManager from the next step on. With \a quitWhenDone
+        /// the window is closed once the last step has been replayed.
+        static bool StartReplay(const std::filesystem::path& file, bool quitWhenDone);
+        /// End recording (flushes the file) or replay (writes partial results).
+        static void Stop();
+
+        static Mode GetMode();
+        static Status GetStatus();
+        static Results LastResults();
+
+        /// LogicSystem: the level the game starts on, saved in the recording.
+        static void NoteStartLevel(const std::string& levelFile);
+        /// LogicSystem: level file name the replay was recorded on (empty when not replaying).
+        static std::string ReplayStartLevel();
+
+        /// InputManager: store \a sample as this step's input (no-op unless recording).
+        static void WriteStep(const InputSample& sample);
+        /// InputManager: this step's input while replaying; false otherwise or once the file ends.
+        static bool ReadStep(InputSample& sample);
+        /// InputManager: true once, after a --replay run has finished.
+        static bool ConsumeQuitRequest();
+    };
+}
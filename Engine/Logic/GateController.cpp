@@ -26,6 +26,8 @@
 #include "Component/TransformComponent.h"
 #include "Physics/Collision/Collision.h"
 #include "Physics/Dynamics/RigidBodyComponent.h"
+#include "Messaging_System/EventBus.h"
+#include "Messaging_System/GameplayEvents.h"
 
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
@@ -106,8 +108,7 @@ namespace Framework
             return;
 
         gateUnlocked = true;
-
-     
+        EventBus::Instance().Enqueue(GateOpenedEvent{ static_cast<int>(gates.size()) });
     }
 
     /*****************************************************************************************
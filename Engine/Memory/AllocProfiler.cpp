@@ -0,0 +1,347 @@
+/*********************************************************************************************
+ \file      AllocProfiler.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements AllocProfiler: system slots, the call-site table and symbolization.
+ \details   Everything OnAllocate() touches is a fixed array, so the hook cannot recurse
+            into operator new. A thread_local flag also drops allocations made by the stack
+            walker itself. Call sites are keyed by a hash of (system, return addresses) in an
+            open-addressed table. A full table only loses call-site detail; per-system counts
+            are kept regardless.
+
+            The tables are shared by every thread that allocates inside a SystemScope (the
+            main thread and the simulation thread), so one mutex guards them. The stack is
+            captured before taking it. Each locked section also sets tInHook, so an
+            allocation made while the lock is held is skipped instead of re-entering it.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Memory/AllocProfiler.h"
+
+#if SOFASPUDS_ENABLE_ALLOC_PROFILER
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#  define NOMINMAX
+#endif
+#include <Windows.h>
+#include <DbgHelp.h>
+#else
+#include <execinfo.h>
+#include <cstdlib>
+#endif
+#endif
+
+namespace Framework
+{
+#if SOFASPUDS_ENABLE_ALLOC_PROFILER
+    namespace
+    {
+        constexpr int         kMaxSystems = 64;
+        constexpr std::size_t kNameLength = 48;
+        constexpr unsigned    kStackDepth = 12;
+        constexpr unsigned    kSkipFrames = 2;       // CaptureStack, OnAllocate; operator new stays on top
+        constexpr std::size_t kSiteSlots = 4096;     // power of two
+
+        struct SystemSlot
+        {
+            char          name[kNameLength] = {};
+            std::uint64_t frameCount = 0;
+            std::uint64_t frameBytes = 0;
+            std::uint64_t lastCount = 0;
+            std::uint64_t lastBytes = 0;
+        };
+
+        struct Site
+        {
+            std::uint64_t hash = 0;                  ///< 0 = empty slot
+            int           system = -1;
+            unsigned      depth = 0;
+            std::uint64_t count = 0;
+            std::uint64_t bytes = 0;
+            void*         frames[kStackDepth] = {};
+        };
+
+        SystemSlot    gSystems[kMaxSystems];
+        int           gSystemCount = 0;
+        Site          gSites[kSiteSlots];
+        std::uint64_t gDroppedSites = 0;
+
+        std::mutex        gMutex;                    // guards gSystems, gSystemCount, gSites, gDroppedSites
+
+        thread_local int  tCurrentSystem = -1;
+        thread_local bool tInHook = false;
+
+        /// Holds gMutex with the hook disabled on this thread.
+        class TableLock
+        {
+        public:
+            TableLock() : outer(tInHook)
+            {
+                tInHook = true;
+                gMutex.lock();
+            }
+            ~TableLock()
+            {
+                gMutex.unlock();
+                tInHook = outer;
+            }
+            TableLock(const TableLock&) = delete;
+            TableLock& operator=(const TableLock&) = delete;
+
+        private:
+            bool outer;
+        };
+
+        int FindOrAddSystem(std::string_view name)
+        {
+            TableLock lock;
+            const std::size_t length = std::min(name.size(), kNameLength - 1);
+            for (int i = 0; i < gSystemCount; ++i)
+            {
+                if (std::strlen(gSystems[i].name) == length && std::memcmp(gSystems[i].name, name.data(), length) == 0)
+                    return i;
+            }
+            if (gSystemCount == kMaxSystems)
+                return -1;
+            SystemSlot& slot = gSystems[gSystemCount];
+            std::memcpy(slot.name, name.data(), length);
+            slot.name[length] = '\0';
+            return gSystemCount++;
+        }
+
+        // Kept out of line so kSkipFrames stays right whatever the optimizer does.
+#if defined(_MSC_VER)
+        __declspec(noinline)
+#else
+        __attribute__((noinline))
+#endif
+        unsigned CaptureStack(void** frames)
+        {
+#if defined(_WIN32)
+            return RtlCaptureStackBackTrace(kSkipFrames, kStackDepth, frames, nullptr);
+#else
+            void* raw[kStackDepth + kSkipFrames];
+            const int captured = backtrace(raw, static_cast<int>(kStackDepth + kSkipFrames));
+            unsigned depth = 0;
+            for (int i = static_cast<int>(kSkipFrames); i < captured; ++i)
+                frames[depth++] = raw[i];
+            return depth;
+#endif
+        }
+
+        std::uint64_t HashSite(int system, void* const* frames, unsigned depth)
+        {
+            std::uint64_t hash = 14695981039346656037ull ^ static_cast<std::uint64_t>(system + 1);
+            for (unsigned i = 0; i < depth; ++i)
+            {
+                hash ^= reinterpret_cast<std::uintptr_t>(frames[i]);
+                hash *= 1099511628211ull;
+            }
+            return hash ? hash : 1;
+        }
+
+        Site* FindSite(std::uint64_t hash)
+        {
+            for (std::size_t probe = 0, i = hash & (kSiteSlots - 1); probe < kSiteSlots; ++probe, i = (i + 1) & (kSiteSlots - 1))
+            {
+                if (gSites[i].hash == hash)
+                    return &gSites[i];
+                if (gSites[i].hash == 0)
+                    return nullptr;
+            }
+            return nullptr;
+        }
+    }
+
+    AllocProfiler::SystemScope::SystemScope(std::string_view systemName)
+        : previous(tCurrentSystem)
+    {
+        tCurrentSystem = FindOrAddSystem(systemName);
+    }
+
+    AllocProfiler::SystemScope::~SystemScope()
+    {
+        tCurrentSystem = previous;
+    }
+
+    void AllocProfiler::OnAllocate(std::size_t bytes)
+    {
+        if (tCurrentSystem < 0 || tInHook)
+            return;
+        tInHook = true;
+
+        void* frames[kStackDepth];
+        const unsigned depth = CaptureStack(frames);
+        const std::uint64_t hash = HashSite(tCurrentSystem, frames, depth);
+
+        std::lock_guard<std::mutex> lock(gMutex);
+        SystemSlot& system = gSystems[tCurrentSystem];
+        ++system.frameCount;
+        system.frameBytes += bytes;
+
+        Site* site = nullptr;
+        for (std::size_t probe = 0, i = hash & (kSiteSlots - 1); probe < kSiteSlots / 2; ++probe, i = (i + 1) & (kSiteSlots - 1))
+        {
+            if (gSites[i].hash == hash || gSites[i].hash == 0)
+            {
+                site = &gSites[i];
+                break;
+            }
+        }
+
+        if (!site)
+        {
+            ++gDroppedSites;
+        }
+        else
+        {
+            if (site->hash == 0)
+            {
+                site->hash = hash;
+                site->system = tCurrentSystem;
+                site->depth = depth;
+                std::copy(frames, frames + depth, site->frames);
+            }
+            ++site->count;
+            site->bytes += bytes;
+        }
+        tInHook = false;
+    }
+
+    void AllocProfiler::EndFrame()
+    {
+        TableLock lock;
+        for (int i = 0; i < gSystemCount; ++i)
+        {
+            SystemSlot& slot = gSystems[i];
+            slot.lastCount = slot.frameCount;
+            slot.lastBytes = slot.frameBytes;
+            slot.frameCount = 0;
+            slot.frameBytes = 0;
+        }
+    }
+
+    AllocProfiler::Counts AllocProfiler::LastFrame(std::string_view systemName)
+    {
+        Counts counts;
+        TableLock lock;
+        for (int i = 0; i < gSystemCount; ++i)
+        {
+            if (systemName == gSystems[i].name)
+            {
+                counts.count = gSystems[i].lastCount;
+                counts.bytes = gSystems[i].lastBytes;
+                break;
+            }
+        }
+        return counts;
+    }
+
+    std::vector<AllocProfiler::CallSite> AllocProfiler::TopCallSites(std::size_t maxSites)
+    {
+        TableLock lock;
+        std::vector<const Site*> used;
+        for (const Site& site : gSites)
+        {
+            if (site.hash != 0)
+                used.push_back(&site);
+        }
+        const std::size_t count = std::min(maxSites, used.size());
+        std::partial_sort(used.begin(), used.begin() + static_cast<std::ptrdiff_t>(count), used.end(),
+            [](const Site* a, const Site* b) { return a->count > b->count; });
+
+        std::vector<CallSite> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Site& site = *used[i];
+            result.push_back({ site.hash, gSystems[site.system].name, { site.count, site.bytes } });
+        }
+        return result;
+    }
+
+    std::vector<std::string> AllocProfiler::Symbolize(std::uint64_t siteId)
+    {
+        std::vector<std::string> names;
+        void* frames[kStackDepth];
+        unsigned depth = 0;
+        {
+            TableLock lock;
+            const Site* site = FindSite(siteId);
+            if (!site)
+                return names;
+            depth = site->depth;
+            std::copy(site->frames, site->frames + depth, frames);
+        }
+
+#if defined(_WIN32)
+        static std::once_flag symbolsLoaded;
+        const HANDLE process = GetCurrentProcess();
+        std::call_once(symbolsLoaded, [process] {
+            SymSetOptions(SymGetOptions() | SYMOPT_LOAD_LINES | SYMOPT_UNDNAME);
+            SymInitialize(process, nullptr, TRUE);
+        });
+
+        alignas(SYMBOL_INFO) char buffer[sizeof(SYMBOL_INFO) + 256] = {};
+        SYMBOL_INFO* symbol = reinterpret_cast<SYMBOL_INFO*>(buffer);
+        for (unsigned i = 0; i < depth; ++i)
+        {
+            const DWORD64 address = reinterpret_cast<DWORD64>(frames[i]);
+            symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+            symbol->MaxNameLen = 255;
+            std::ostringstream text;
+            DWORD64 offset = 0;
+            if (SymFromAddr(process, address, &offset, symbol))
+                text << symbol->Name;
+            else
+                text << frames[i];
+
+            IMAGEHLP_LINE64 line = {};
+            line.SizeOfStruct = sizeof(line);
+            DWORD column = 0;
+            if (SymGetLineFromAddr64(process, address, &column, &line))
+                text << " (" << line.FileName << ":" << line.LineNumber << ")";
+            names.push_back(text.str());
+        }
+#else
+        tInHook = true;   // backtrace_symbols mallocs; keep it out of the table
+        if (char** symbols = backtrace_symbols(frames, static_cast<int>(depth)))
+        {
+            for (unsigned i = 0; i < depth; ++i)
+                names.emplace_back(symbols[i]);
+            std::free(symbols);
+        }
+        tInHook = false;
+#endif
+        return names;
+    }
+
+    std::uint64_t AllocProfiler::DroppedSites()
+    {
+        TableLock lock;
+        return gDroppedSites;
+    }
+
+    void AllocProfiler::Reset()
+    {
+        TableLock lock;
+        std::fill(std::begin(gSites), std::end(gSites), Site{});
+        gDroppedSites = 0;
+    }
+#else
+    void AllocProfiler::OnAllocate(std::size_t) {}
+    void AllocProfiler::EndFrame() {}
+    AllocProfiler::Counts AllocProfiler::LastFrame(std::string_view) { return {}; }
+    std::vector<AllocProfiler::CallSite> AllocProfiler::TopCallSites(std::size_t) { return {}; }
+    std::vector<std::string> AllocProfiler::Symbolize(std::uint64_t) { return {}; }
+    std::uint64_t AllocProfiler::DroppedSites() { return 0; }
+    void AllocProfiler::Reset() {}
+#endif
+}
@@ -0,0 +1,102 @@
+/*********************************************************************************************
+ \file      AllocProfiler.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Optional heap allocation profiler that charges each allocation to the system
+            whose Update/Draw is running, with call-site stacks.
+ \details   Compiled in only with the CMake option SOFASPUDS_ENABLE_ALLOC_PROFILER (OFF by
+            default). Otherwise every function here is an empty stub and SystemScope costs
+            nothing.
+
+            SystemManager opens a SystemScope around each system's Update() and draw() (and
+            the EventBus flush). The counting operator new in HeapCounter.cpp then calls
+            OnAllocate(). That charges the count and bytes to the current system and records
+            the caller's stack in a fixed-size table. The hook itself never allocates. Stacks
+            are turned into names only when the Performance window asks (Symbolize()).
+
+            The current system is per thread, so the simulation thread's UpdateAll() and the
+            main thread's DrawAll() are charged correctly in pipelined frames; a mutex guards
+            the shared tables. Work a system hands to JobSystem or TaskGraph workers has no
+            system on that thread, so it shows up in HeapCounter's counts but not under the
+            system here.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef SOFASPUDS_ENABLE_ALLOC_PROFILER
+#define SOFASPUDS_ENABLE_ALLOC_PROFILER 0
+#endif
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class AllocProfiler
+      \brief Per-system allocation counts plus the heaviest call sites.
+    *****************************************************************************************/
+    class AllocProfiler
+    {
+    public:
+        static constexpr bool kEnabled = SOFASPUDS_ENABLE_ALLOC_PROFILER != 0;
+
+        /// Charges this thread's allocations to \a systemName until destroyed; nests.
+        class SystemScope
+        {
+        public:
+#if SOFASPUDS_ENABLE_ALLOC_PROFILER
+            explicit SystemScope(std::string_view systemName);
+            ~SystemScope();
+#else
+            explicit SystemScope(std::string_view) {}
+#endif
+            SystemScope(const SystemScope&) = delete;
+            SystemScope& operator=(const SystemScope&) = delete;
+
+#if SOFASPUDS_ENABLE_ALLOC_PROFILER
+        private:
+            int previous;
+#endif
+        };
+
+        struct Counts
+        {
+            std::uint64_t count = 0;
+            std::uint64_t bytes = 0;
+        };
+
+        struct CallSite
+        {
+            std::uint64_t id = 0;       ///< Stack hash; pass to Symbolize()
+            std::string   system;
+            Counts        total;        ///< Since start or the last Reset()
+        };
+
+        /// Called by the global operator new for every allocation.
+        static void OnAllocate(std::size_t bytes);
+
+        /// Publish this frame's per-system counts as LastFrame(). Called by PerfFrameStart().
+        static void EndFrame();
+
+        /// Allocations charged to \a systemName in the previous frame.
+        static Counts LastFrame(std::string_view systemName);
+
+        /// Call sites with the most allocations, heaviest first.
+        static std::vector<CallSite> TopCallSites(std::size_t maxSites);
+
+        /// One "function (file:line)" string per frame of call site \a siteId, innermost first.
+        static std::vector<std::string> Symbolize(std::uint64_t siteId);
+
+        /// Allocations that found the call-site table full (still counted per system).
+        static std::uint64_t DroppedSites();
+
+        /// Forget all call sites and totals.
+        static void Reset();
+    };
+}
@@ -14,9 +14,14 @@
 
             Allocation model:
             - Storage() holds a function-local static ObjectAllocatorStorage configured for T.
+              It is safe to create/destroy components from worker threads: each thread
+              allocates from its own magazine (see ObjectAllocatorStorage).
             - CreateRaw(...) allocates raw bytes from the pool and constructs T in-place.
             - Create(...) returns a generic ComponentHandle (polymorphic GameComponent*).
             - CreateTyped(...) returns a typed handle ComponentHandleT<T> for convenience.
+            - Inside a LevelArena::Scope (level loading), Create/CreateTyped take the block
+              from the level arena instead; the handle's deleter then only runs ~T() and
+              the memory goes back when the whole level is released.
 
             Destruction model:
             - ComponentDeleter stores a function pointer to Destroy plus an optional user pointer.
@@ -27,7 +32,7 @@
             - Storage() uses:
                 objectsPerPage = 64
                 maxPages        = 0 (unlimited growth)
-                debugOn         = false
+                debugOn         = kPoolDebugChecks (true in _DEBUG builds only)
               You can tweak these defaults per performance/memory needs.
 
  \copyright
@@ -39,6 +44,7 @@
 #include <new>
 #include <utility>
 #include "Memory/ObjectAllocatorStorage.h"
+#include "Memory/LevelArena.h"
 #include "Composition/Component.h"
 
 namespace Framework
@@ -85,8 +91,9 @@ namespace Framework
         template <typename... Args>
         static ComponentHandle Create(Args&&... args)
         {
-            T* instance = CreateRaw(std::forward<Args>(args)...);
-            return ComponentHandle(instance, ComponentDeleter{ &Destroy, nullptr });
+            ComponentDeleter deleter;
+            T* instance = Construct(deleter, std::forward<Args>(args)...);
+            return ComponentHandle(instance, deleter);
         }
 
         /*********************************************************************************
@@ -101,8 +108,9 @@ namespace Framework
         template <typename... Args>
         static ComponentHandleT<T> CreateTyped(Args&&... args)
         {
-            T* instance = CreateRaw(std::forward<Args>(args)...);
-            return ComponentHandleT<T>(instance, ComponentDeleter{ &Destroy, nullptr });
+            ComponentDeleter deleter;
+            T* instance = Construct(deleter, std::forward<Args>(args)...);
+            return ComponentHandleT<T>(instance, deleter);
         }
 
         /*********************************************************************************
@@ -118,6 +126,24 @@ namespace Framework
         }
 
     private:
+        /*********************************************************************************
+          \brief Construct a T from the active level arena, or from the pool otherwise,
+                 and fill in the matching deleter.
+        *********************************************************************************/
+        template <typename... Args>
+        static T* Construct(ComponentDeleter& deleter, Args&&... args)
+        {
+            LevelArena* arena = LevelArena::Active();
+            if (!arena)
+            {
+                deleter = ComponentDeleter{ &Destroy, nullptr };
+                return CreateRaw(std::forward<Args>(args)...);
+            }
+            void* storage = arena->allocate(sizeof(T), alignof(T));
+            deleter = ComponentDeleter{ &DestroyInArena, arena };
+            return new (storage) T(std::forward<Args>(args)...);
+        }
+
         /*********************************************************************************
           \brief Get the shared allocator storage for component type T.
           \return Reference to a lazily-created ObjectAllocatorStorage.
@@ -127,11 +153,11 @@ namespace Framework
                 objectSize      = sizeof(T)
                 objectsPerPage  = 64
                 maxPages        = 0 (unlimited)
-                debugOn         = false
+                debugOn         = kPoolDebugChecks
         *********************************************************************************/
         static ObjectAllocatorStorage& Storage()
         {
-            static ObjectAllocatorStorage storage(sizeof(T), 64, 0, false);
+            static ObjectAllocatorStorage storage(sizeof(T), 64, 0, kPoolDebugChecks);
             return storage;
         }
 
@@ -153,5 +179,15 @@ namespace Framework
             static_cast<T*>(component)->~T();
             Storage().Free(component);
         }
+
+        /// Destroy callback for components built inside a LevelArena::Scope.
+        static void DestroyInArena(GameComponent* component, void* arena)
+        {
+            if (!component)
+                return;
+            T* object = static_cast<T*>(component);
+            object->~T();
+            static_cast<LevelArena*>(arena)->deallocate(object, sizeof(T), alignof(T));
+        }
     };
 }
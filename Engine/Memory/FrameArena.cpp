@@ -0,0 +1,125 @@
+/*********************************************************************************************
+ \file      FrameArena.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements FrameArena: bump allocation, heap spills and per-frame rewinding.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Memory/FrameArena.h"
+#include <algorithm>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        thread_local FrameArena* tBoundArena = nullptr;
+    }
+
+    FrameArena& FrameArena::Instance()
+    {
+        if (tBoundArena)
+            return *tBoundArena;
+        static FrameArena arena;
+        return arena;
+    }
+
+    FrameArena::ThreadScope::ThreadScope(FrameArena& arena)
+        : previous(tBoundArena)
+    {
+        tBoundArena = &arena;
+    }
+
+    FrameArena::ThreadScope::~ThreadScope()
+    {
+        tBoundArena = previous;
+    }
+
+    FrameArena::FrameArena(std::size_t capacity)
+    {
+        for (Buffer& buffer : buffers_)
+        {
+            buffer.data = std::make_unique<std::byte[]>(capacity);
+            buffer.capacity = capacity;
+        }
+    }
+
+    FrameArena::~FrameArena()
+    {
+        for (Buffer& buffer : buffers_)
+            Rewind(buffer);
+    }
+
+    void* FrameArena::Allocate(std::size_t bytes, std::size_t alignment)
+    {
+        Buffer& buffer = buffers_[current_];
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(buffer.data.get());
+        const std::uintptr_t top = base + buffer.used;
+        const std::uintptr_t aligned = (top + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        const std::size_t end = static_cast<std::size_t>(aligned - base) + bytes;
+
+        buffer.requested += static_cast<std::size_t>(aligned - top) + bytes;
+        if (end <= buffer.capacity)
+        {
+            buffer.used = end;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // Out of room: take this block from the heap until the buffer grows at its next rewind.
+        void* block = ::operator new(std::max<std::size_t>(bytes, 1), std::align_val_t(alignment));
+        buffer.spills.push_back(block);
+        buffer.spillAlignments.push_back(alignment);
+        return block;
+    }
+
+    /*****************************************************************************************
+      \brief The buffer being rewound was last used two frames ago, so nothing still
+             points into it. It grows to a quarter above the high-water mark when any
+             frame so far has needed more than it holds.
+    *****************************************************************************************/
+    void FrameArena::BeginFrame()
+    {
+        const Buffer& finished = buffers_[current_];
+        lastFrameBytes_ = finished.requested;
+        lastFrameSpills_ = finished.spills.size();
+        highWaterBytes_ = std::max(highWaterBytes_, lastFrameBytes_);
+        ++frames_;
+
+        current_ ^= 1u;
+        Buffer& next = buffers_[current_];
+        Rewind(next);
+        if (highWaterBytes_ > next.capacity)
+        {
+            next.capacity = highWaterBytes_ + highWaterBytes_ / 4;
+            next.data = std::make_unique<std::byte[]>(next.capacity);
+        }
+    }
+
+    void FrameArena::Rewind(Buffer& buffer)
+    {
+        for (std::size_t i = 0; i < buffer.spills.size(); ++i)
+            ::operator delete(buffer.spills[i], std::align_val_t(buffer.spillAlignments[i]));
+        buffer.spills.clear();
+        buffer.spillAlignments.clear();
+        buffer.used = 0;
+        buffer.requested = 0;
+    }
+
+    FrameArena::Stats FrameArena::GetStats() const
+    {
+        Stats stats;
+        stats.capacity = buffers_[current_].capacity;
+        stats.lastFrameBytes = lastFrameBytes_;
+        stats.highWaterBytes = highWaterBytes_;
+        stats.lastFrameSpills = lastFrameSpills_;
+        stats.frames = frames_;
+        return stats;
+    }
+}
@@ -0,0 +1,134 @@
+/*********************************************************************************************
+ \file      FrameArena.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Double-buffered bump allocator for data that only lives for a frame, plus an
+            STL allocator adaptor (FrameAllocator / FrameVector) on top of it.
+ \details   Allocation moves a pointer forward in the current buffer; there is no per-block
+            free. PerfFrameStart() calls BeginFrame(), which swaps to the other buffer and
+            rewinds it. A block therefore stays valid for the frame it was allocated in and
+            the following one, so Update can hand scratch data to the next Draw.
+
+            If a frame needs more than a buffer holds, the extra blocks come from the heap
+            ("spills") and are freed with the buffer. The next time that buffer is rewound
+            it grows past the high-water mark, so a steady-state frame never touches the heap.
+
+            Containers using FrameAllocator never give memory back, so reserve() what you
+            can up front. They must not outlive the next frame. An arena belongs to one
+            thread: Instance() is the main thread's, and a thread that needs scratch memory
+            binds its own with ThreadScope (the pipelined simulation thread does).
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class FrameArena
+      \brief Two bump buffers that take turns, rewound once per frame.
+    *****************************************************************************************/
+    class FrameArena
+    {
+    public:
+        static constexpr std::size_t kDefaultCapacity = 256 * 1024;   ///< Bytes per buffer
+
+        struct Stats
+        {
+            std::size_t   capacity = 0;          ///< Bytes in the current buffer
+            std::size_t   lastFrameBytes = 0;    ///< Bytes the previous frame asked for
+            std::size_t   highWaterBytes = 0;    ///< Largest frame so far
+            std::size_t   lastFrameSpills = 0;   ///< Blocks the previous frame took from the heap
+            std::uint64_t frames = 0;
+        };
+
+        /// Arena bound to the calling thread; the engine-wide one rewound by PerfFrameStart()
+        /// unless a ThreadScope is active.
+        static FrameArena& Instance();
+
+        /// Makes \a arena the calling thread's Instance() for the scope's lifetime.
+        class ThreadScope
+        {
+        public:
+            explicit ThreadScope(FrameArena& arena);
+            ~ThreadScope();
+            ThreadScope(const ThreadScope&) = delete;
+            ThreadScope& operator=(const ThreadScope&) = delete;
+        private:
+            FrameArena* previous;
+        };
+
+        explicit FrameArena(std::size_t capacity = kDefaultCapacity);
+        ~FrameArena();
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /// \a bytes aligned to \a alignment; valid until the frame after next begins.
+        void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+        /// Swap buffers, free the new one's spills and grow it if the last frames overflowed.
+        void BeginFrame();
+
+        Stats GetStats() const;
+
+    private:
+        struct Buffer
+        {
+            std::unique_ptr<std::byte[]> data;
+            std::size_t                  capacity = 0;
+            std::size_t                  used = 0;
+            std::size_t                  requested = 0;   ///< Including padding and spills
+            std::vector<void*>           spills;
+            std::vector<std::size_t>     spillAlignments;
+        };
+
+        void Rewind(Buffer& buffer);
+
+        Buffer        buffers_[2];
+        unsigned      current_ = 0;
+        std::size_t   lastFrameBytes_ = 0;
+        std::size_t   highWaterBytes_ = 0;
+        std::size_t   lastFrameSpills_ = 0;
+        std::uint64_t frames_ = 0;
+    };
+
+    /*****************************************************************************************
+      \class FrameAllocator
+      \brief Stateless std allocator drawing from FrameArena::Instance(); deallocate is a no-op.
+    *****************************************************************************************/
+    template <typename T>
+    class FrameAllocator
+    {
+    public:
+        using value_type = T;
+
+        FrameAllocator() noexcept = default;
+        template <typename U>
+        FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+        T* allocate(std::size_t count)
+        {
+            if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+                throw std::bad_array_new_length();
+            return static_cast<T*>(FrameArena::Instance().Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T*, std::size_t) noexcept {}
+
+        template <typename U>
+        bool operator==(const FrameAllocator<U>&) const noexcept { return true; }
+    };
+
+    /// Per-frame scratch vector; see FrameArena for the lifetime rules.
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
@@ -9,7 +9,8 @@
             and implements allocation/deallocation helpers:
 
             - Storage(): Returns a function-local static ObjectAllocatorStorage that owns the
-              ObjectAllocator instance for all GOCs.
+              ObjectAllocator instance for all GOCs. Thread-safe, with per-thread magazines
+              in release builds.
             - CreateRaw(): Allocates raw memory from the pool and constructs a GOC using
               placement new.
             - Create(): Wraps CreateRaw() in a GameObjectHandle (std::unique_ptr with custom
@@ -17,6 +18,9 @@
             - Destroy(): Explicitly runs the GOC destructor and returns the underlying memory
               back to the pool.
             - GameObjectDeleter: Forwards deletion requests from GameObjectHandle to Destroy().
+            - Inside a LevelArena::Scope, CreateRaw() takes the block from the level arena.
+              Destroy() finds their arena by address (LevelArena::Owner() checks the
+              current level arena and any retired one).
 
             Ownership notes:
             - Memory is allocated via the custom allocator (not system new/delete).
@@ -27,13 +31,14 @@
             - Storage() uses:
                 objectsPerPage = 128
                 maxPages        = 0 (unlimited)
-                debugOn         = false
+                debugOn         = kPoolDebugChecks (true in _DEBUG builds only)
 
  \copyright
             All content  2025 DigiPen Institute of Technology Singapore.
             All rights reserved.
 *********************************************************************************************/
 #include "Memory/GameObjectPool.h"
+#include "Memory/LevelArena.h"
 
 #include <new>
 
@@ -48,12 +53,12 @@ namespace Framework
             * objectSize      = sizeof(GOC)
             * objectsPerPage  = 128
             * maxPages        = 0 (unlimited growth)
-            * debugOn         = false
+            * debugOn         = kPoolDebugChecks
         - All Create/Destroy operations route through this storage.
     *************************************************************************************/
     ObjectAllocatorStorage& GameObjectPool::Storage()
     {
-        static ObjectAllocatorStorage storage(sizeof(GOC), 128, 0, false);
+        static ObjectAllocatorStorage storage(sizeof(GOC), 128, 0, kPoolDebugChecks);
         return storage;
     }
 
@@ -69,8 +74,9 @@ namespace Framework
     *************************************************************************************/
     GOC* GameObjectPool::CreateRaw()
     {
-        // Allocate from the pool and placement-new the GOC.
-        void* storage = Storage().Allocate();
+        // Allocate from the pool (or the level being loaded) and placement-new the GOC.
+        LevelArena* arena = LevelArena::Active();
+        void* storage = arena ? arena->allocate(sizeof(GOC), alignof(GOC)) : Storage().Allocate();
         return new (storage) GOC();
     }
 
@@ -103,7 +109,10 @@ namespace Framework
             return;
         // Run destructor explicitly, then recycle the storage.
         object->~GOC();
-        Storage().Free(object);
+        if (LevelArena* arena = LevelArena::Owner(object))
+            arena->deallocate(object, sizeof(GOC), alignof(GOC));
+        else
+            Storage().Free(object);
     }
 
     /*************************************************************************************
@@ -0,0 +1,250 @@
+/*********************************************************************************************
+ \file      HeapCounter.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Counting replacements for the global operator new/delete, and the frame check.
+ \details   This file deliberately does not redefine `new` as DBG_NEW: it defines the
+            allocation functions themselves. Without SOFASPUDS_ENABLE_HEAP_COUNTER only the
+            empty stubs at the bottom are compiled.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Memory/HeapCounter.h"
+
+#if SOFASPUDS_ENABLE_HEAP_COUNTER
+#include "Memory/AllocProfiler.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <new>
+
+namespace
+{
+    // Constant-initialized, so they work for allocations made before main().
+    std::atomic<std::uint64_t> gAllocations{ 0 };
+    std::atomic<std::uint64_t> gBytes{ 0 };
+    thread_local std::uint64_t tAllocations = 0;
+
+    void* CountedMalloc(std::size_t size)
+    {
+        ++tAllocations;
+        gAllocations.fetch_add(1, std::memory_order_relaxed);
+        gBytes.fetch_add(size, std::memory_order_relaxed);
+#if SOFASPUDS_ENABLE_ALLOC_PROFILER
+        Framework::AllocProfiler::OnAllocate(size);
+#endif
+        for (;;)
+        {
+            if (void* block = std::malloc(size ? size : 1))
+                return block;
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                return nullptr;
+            handler();
+        }
+    }
+
+    void* CountedAlignedMalloc(std::size_t size, std::align_val_t alignment)
+    {
+        ++tAllocations;
+        gAllocations.fetch_add(1, std::memory_order_relaxed);
+        gBytes.fetch_add(size, std::memory_order_relaxed);
+#if SOFASPUDS_ENABLE_ALLOC_PROFILER
+        Framework::AllocProfiler::OnAllocate(size);
+#endif
+        const std::size_t align = static_cast<std::size_t>(alignment);
+        const std::size_t rounded = ((size ? size : 1) + align - 1) & ~(align - 1);
+        for (;;)
+        {
+#ifdef _WIN32
+            if (void* block = _aligned_malloc(rounded, align))
+                return block;
+#else
+            if (void* block = std::aligned_alloc(align, rounded))
+                return block;
+#endif
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                return nullptr;
+            handler();
+        }
+    }
+
+    void AlignedFree(void* block) noexcept
+    {
+#ifdef _WIN32
+        _aligned_free(block);
+#else
+        std::free(block);
+#endif
+    }
+
+    struct FrameState
+    {
+        Framework::HeapCounter::FrameCounts current;
+        Framework::HeapCounter::FrameCounts last;
+        Framework::HeapCounter::CheckState  check;
+        unsigned                            warmupLeft = 0;
+        unsigned                            framesToCheck = 0;
+    };
+
+    FrameState& State()
+    {
+        static FrameState state;
+        return state;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    if (void* block = CountedMalloc(size))
+        return block;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* block = CountedMalloc(size))
+        return block;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try { return CountedMalloc(size); }
+    catch (...) { return nullptr; }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try { return CountedMalloc(size); }
+    catch (...) { return nullptr; }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* block = CountedAlignedMalloc(size, alignment))
+        return block;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    if (void* block = CountedAlignedMalloc(size, alignment))
+        return block;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete[](void* block) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+void operator delete[](void* block, std::size_t) noexcept { std::free(block); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { std::free(block); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { std::free(block); }
+void operator delete(void* block, std::align_val_t) noexcept { AlignedFree(block); }
+void operator delete[](void* block, std::align_val_t) noexcept { AlignedFree(block); }
+void operator delete(void* block, std::size_t, std::align_val_t) noexcept { AlignedFree(block); }
+void operator delete[](void* block, std::size_t, std::align_val_t) noexcept { AlignedFree(block); }
+
+namespace Framework
+{
+    std::uint64_t HeapCounter::Allocations()
+    {
+        return gAllocations.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t HeapCounter::Bytes()
+    {
+        return gBytes.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t HeapCounter::ThreadAllocations()
+    {
+        return tAllocations;
+    }
+
+    void HeapCounter::AddThreadAllocations(std::uint64_t count)
+    {
+        tAllocations += count;
+    }
+
+    void HeapCounter::AddFrameAllocations(Phase phase, std::uint64_t count)
+    {
+        // Pipelined frames report Update from the simulation thread while Draw reports here.
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock(mutex);
+        FrameCounts& current = State().current;
+        (phase == Phase::Update ? current.update : current.draw) += count;
+    }
+
+    void HeapCounter::EndFrame()
+    {
+        FrameState& state = State();
+        state.last = state.current;
+        state.current = {};
+
+        CheckState& check = state.check;
+        if (!check.armed)
+            return;
+        if (state.warmupLeft > 0)
+        {
+            --state.warmupLeft;
+            return;
+        }
+
+        const std::uint64_t total = state.last.update + state.last.draw;
+        ++check.framesChecked;
+        if (total > 0)
+        {
+            ++check.framesFailed;
+            if (total > check.worstFrame)
+                check.worstFrame = total;
+            std::cerr << "[HeapCounter] Steady-state frame allocated: " << state.last.update
+                << " in UpdateAll, " << state.last.draw << " in DrawAll\n";
+        }
+
+        if (check.framesChecked >= state.framesToCheck)
+        {
+            check.armed = false;
+            check.finished = true;
+            std::cout << "[HeapCounter] Zero-allocation check " << (check.framesFailed ? "FAILED" : "passed")
+                << ": " << check.framesFailed << " of " << check.framesChecked << " frames allocated\n";
+        }
+    }
+
+    HeapCounter::FrameCounts HeapCounter::LastFrame()
+    {
+        return State().last;
+    }
+
+    void HeapCounter::ExpectZeroAllocations(unsigned frames, unsigned warmupFrames)
+    {
+        FrameState& state = State();
+        state.check = {};
+        state.check.armed = frames > 0;
+        state.framesToCheck = frames;
+        state.warmupLeft = warmupFrames;
+    }
+
+    HeapCounter::CheckState HeapCounter::Check()
+    {
+        return State().check;
+    }
+}
+#else
+namespace Framework
+{
+    std::uint64_t HeapCounter::Allocations() { return 0; }
+    std::uint64_t HeapCounter::Bytes() { return 0; }
+    std::uint64_t HeapCounter::ThreadAllocations() { return 0; }
+    void HeapCounter::AddThreadAllocations(std::uint64_t) {}
+    void HeapCounter::AddFrameAllocations(Phase, std::uint64_t) {}
+    void HeapCounter::EndFrame() {}
+    HeapCounter::FrameCounts HeapCounter::LastFrame() { return {}; }
+    HeapCounter::CheckState HeapCounter::Check() { return {}; }
+}
+#endif
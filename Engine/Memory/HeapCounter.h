@@ -0,0 +1,96 @@
+/*********************************************************************************************
+ \file      HeapCounter.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Counts global heap allocations and checks that steady-state frames make none.
+ \details   Compiled in only with the CMake option SOFASPUDS_ENABLE_HEAP_COUNTER (OFF by
+            default, forced ON by SOFASPUDS_ENABLE_ALLOC_PROFILER). Otherwise the global
+            operator new/delete are left alone, the counters read zero and
+            ExpectZeroAllocations() does not exist.
+
+            When on, HeapCounter.cpp replaces the global operator new/delete with versions
+            that bump two atomic counters before calling malloc/free. SystemManager samples the count
+            around UpdateAll() and DrawAll(), and PerfFrameStart() closes the frame.
+
+            The phases are measured with ThreadAllocations(), the calling thread's own count,
+            because a pipelined frame runs UpdateAll() on the simulation thread while DrawAll()
+            runs on the main thread. JobSystem credits allocations its workers make back to
+            the thread that submitted the call, so AI batches still count toward UpdateAll().
+
+            ExpectZeroAllocations() arms a check over the next N frames, after a short
+            warm-up that lets scratch buffers reach their working size. Every frame that
+            allocates is logged to std::cerr and the check ends as failed. Run it in play
+            mode with the editor hidden, because ImGui panels allocate while they draw.
+
+            In _DEBUG builds, `new T` in engine .cpp files goes through DBG_NEW, the CRT's
+            file/line overload, and is not counted. Container and string allocations are,
+            and because they then bypass the CRT's operator new, MSVC leak reports lose
+            their file/line for them. Turn the option on in Release builds for measurement.
+
+            With SOFASPUDS_ENABLE_ALLOC_PROFILER the same hook also feeds AllocProfiler,
+            which splits the counts by system and records call sites.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+#ifndef SOFASPUDS_ENABLE_HEAP_COUNTER
+#define SOFASPUDS_ENABLE_HEAP_COUNTER 0
+#endif
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class HeapCounter
+      \brief Process-wide allocation counters plus the per-frame zero-allocation check.
+    *****************************************************************************************/
+    class HeapCounter
+    {
+    public:
+        static constexpr bool kEnabled = SOFASPUDS_ENABLE_HEAP_COUNTER != 0;
+
+        enum class Phase { Update, Draw };
+
+        struct FrameCounts
+        {
+            std::uint64_t update = 0;   ///< Allocations inside SystemManager::UpdateAll()
+            std::uint64_t draw = 0;     ///< Allocations inside SystemManager::DrawAll()
+        };
+
+        struct CheckState
+        {
+            bool          armed = false;
+            bool          finished = false;
+            unsigned      framesChecked = 0;
+            unsigned      framesFailed = 0;
+            std::uint64_t worstFrame = 0;   ///< Most allocations seen in one checked frame
+        };
+
+        /// operator new calls so far (all threads, all sizes).
+        static std::uint64_t Allocations();
+        static std::uint64_t Bytes();
+
+        /// operator new calls made by the calling thread, plus any credited to it.
+        static std::uint64_t ThreadAllocations();
+        /// Credit \a count allocations made on another thread on this thread's behalf.
+        static void AddThreadAllocations(std::uint64_t count);
+
+        /// Add \a count allocations to \a phase of the current frame.
+        static void AddFrameAllocations(Phase phase, std::uint64_t count);
+
+        /// Close the current frame and advance an armed check. Called by PerfFrameStart().
+        static void EndFrame();
+
+        static FrameCounts LastFrame();
+
+#if SOFASPUDS_ENABLE_HEAP_COUNTER
+        /// Require zero allocations in \a frames frames, after \a warmupFrames unchecked ones.
+        static void ExpectZeroAllocations(unsigned frames, unsigned warmupFrames = 30);
+#endif
+
+        static CheckState Check();
+    };
+}
@@ -0,0 +1,195 @@
+/*********************************************************************************************
+ \file      LevelArena.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements LevelArena: chunk bumping, live-block tracking and one-shot release.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Memory/LevelArena.h"
+#include <algorithm>
+#include <iostream>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        thread_local LevelArena* tActiveArena = nullptr;
+
+        struct ArenaRegistry
+        {
+            std::unique_ptr<LevelArena>              current = std::make_unique<LevelArena>();
+            std::vector<std::unique_ptr<LevelArena>> retired;   // kept for blocks that outlived their level
+            std::uint64_t                            retirements = 0;
+        };
+
+        ArenaRegistry& Registry()
+        {
+            static ArenaRegistry registry;
+            return registry;
+        }
+    }
+
+    LevelArena::Scope::Scope(LevelArena& arena)
+        : previous(tActiveArena)
+    {
+        tActiveArena = &arena;
+    }
+
+    LevelArena::Scope::~Scope()
+    {
+        tActiveArena = previous;
+    }
+
+    LevelArena& LevelArena::Instance()
+    {
+        return *Registry().current;
+    }
+
+    LevelArena& LevelArena::BeginLevel()
+    {
+        ArenaRegistry& registry = Registry();
+        std::erase_if(registry.retired,
+            [](const std::unique_ptr<LevelArena>& arena) { return arena->liveBlocks == 0; });
+
+        if (!registry.current->ReleaseIfUnused())
+        {
+            std::cout << "[LevelArena] " << registry.current->liveBlocks
+                << " blocks outlived the level; retiring its arena and starting a fresh one.\n";
+            ++registry.retirements;
+            registry.retired.push_back(std::move(registry.current));
+            registry.current = std::make_unique<LevelArena>();
+        }
+        return *registry.current;
+    }
+
+    LevelArena* LevelArena::Owner(const void* block)
+    {
+        ArenaRegistry& registry = Registry();
+        if (registry.current->Owns(block))
+            return registry.current.get();
+        for (const std::unique_ptr<LevelArena>& arena : registry.retired)
+        {
+            if (arena->Owns(block))
+                return arena.get();
+        }
+        return nullptr;
+    }
+
+    LevelArena* LevelArena::Active()
+    {
+        return tActiveArena;
+    }
+
+    std::pmr::memory_resource* LevelArena::ActiveResource()
+    {
+        if (tActiveArena)
+            return tActiveArena;
+        return std::pmr::new_delete_resource();
+    }
+
+    bool LevelArena::Owns(const void* block) const
+    {
+        const std::byte* address = static_cast<const std::byte*>(block);
+        for (const Chunk& chunk : chunks)
+        {
+            if (address >= chunk.data.get() && address < chunk.data.get() + chunk.size)
+                return true;
+        }
+        return false;
+    }
+
+    /*****************************************************************************************
+      \brief Bump through the newest chunk; start a new one (at least kChunkSize, or the
+             request itself if larger) when it runs out. The rest of the old chunk is
+             left unused until the release.
+    *****************************************************************************************/
+    void* LevelArena::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        auto tryBump = [&]() -> void* {
+            if (chunks.empty())
+                return nullptr;
+            Chunk& chunk = chunks.back();
+            const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(chunk.data.get());
+            const std::uintptr_t aligned = (base + used + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+            const std::size_t end = static_cast<std::size_t>(aligned - base) + bytes;
+            if (end > chunk.size)
+                return nullptr;
+            usedTotal += end - used;
+            used = end;
+            return reinterpret_cast<void*>(aligned);
+        };
+
+        void* block = tryBump();
+        if (!block)
+        {
+            Chunk chunk;
+            chunk.size = std::max(kChunkSize, bytes + alignment);
+            chunk.data = std::make_unique<std::byte[]>(chunk.size);
+            chunks.push_back(std::move(chunk));
+            used = 0;
+            block = tryBump();
+        }
+        ++liveBlocks;
+        return block;
+    }
+
+    void LevelArena::do_deallocate(void*, std::size_t, std::size_t)
+    {
+        if (liveBlocks > 0)
+            --liveBlocks;
+    }
+
+    bool LevelArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+    bool LevelArena::ReleaseIfUnused()
+    {
+        if (liveBlocks > 0)
+            return false;
+        if (chunks.empty())
+            return true;
+
+        auto largest = std::max_element(chunks.begin(), chunks.end(),
+            [](const Chunk& a, const Chunk& b) { return a.size < b.size; });
+        Chunk keep = std::move(*largest);
+        chunks.clear();
+        chunks.push_back(std::move(keep));
+        used = 0;
+        usedTotal = 0;
+        ++releases;
+        return true;
+    }
+
+    LevelArena::Stats LevelArena::GetStats() const
+    {
+        Stats stats;
+        stats.chunks = chunks.size();
+        for (const Chunk& chunk : chunks)
+            stats.reservedBytes += chunk.size;
+        stats.usedBytes = usedTotal;
+        stats.liveBlocks = liveBlocks;
+        stats.releases = releases;
+
+        const ArenaRegistry& registry = Registry();
+        stats.deferredReleases = registry.retirements;
+        for (const std::unique_ptr<LevelArena>& arena : registry.retired)
+        {
+            if (arena->liveBlocks == 0)
+                continue;   // freed by the next BeginLevel()
+            ++stats.retiredArenas;
+            for (const Chunk& chunk : arena->chunks)
+                stats.retiredBytes += chunk.size;
+        }
+        return stats;
+    }
+}
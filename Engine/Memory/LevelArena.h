@@ -0,0 +1,123 @@
+/*********************************************************************************************
+ \file      LevelArena.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Level-lifetime memory region for the objects a level file creates.
+ \details   While a LevelArena::Scope is open on a thread (GameObjectFactory::CreateLevel
+            opens one), GameObjectPool, ComponentPool and each GOC's component list take
+            their memory from the arena instead of the per-type pools. The arena hands out
+            memory by bumping a pointer through large chunks. Freeing a block only lowers
+            the live-block count.
+
+            Every CreateLevel starts with BeginLevel(). If the current arena has no live
+            blocks, it gives every chunk back in one go (keeping the largest for the new
+            level). If blocks survived the previous level (an object kept alive past the
+            unload, or the editor's undo history), that arena is retired instead: it stays
+            alive for those blocks and is freed once they are gone, and the new level gets
+            a fresh arena. An arena therefore never grows across levels, however the level
+            is reloaded. Objects created outside a scope (prefab masters, HUD pieces,
+            mid-level spawns) never touch the arena.
+
+            It derives from std::pmr::memory_resource so containers can draw from it too.
+            It is not locked: one thread at a time. Level transitions (CreateLevel, so
+            BeginLevel()) and object destruction run on the main thread in serial frames
+            and on the SimulationThread in pipelined ones, and SimulationThread::Sync()
+            orders the two. Any other caller, including the main thread while a pipelined
+            frame's steps are running, must wait for Sync() first. The active scope is per
+            thread, so worker threads that build prefab templates keep using the pools.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class LevelArena
+      \brief Chunked bump allocator released all at once between levels.
+    *****************************************************************************************/
+    class LevelArena : public std::pmr::memory_resource
+    {
+    public:
+        static constexpr std::size_t kChunkSize = 512 * 1024;
+
+        struct Stats
+        {
+            std::size_t   chunks = 0;
+            std::size_t   reservedBytes = 0;   ///< Sum of chunk sizes
+            std::size_t   usedBytes = 0;       ///< Bumped so far this level (incl. padding)
+            std::size_t   liveBlocks = 0;      ///< Allocated and not yet freed
+            std::uint64_t releases = 0;        ///< Successful one-shot releases
+            std::uint64_t deferredReleases = 0; ///< Arenas retired because blocks were live
+            std::size_t   retiredArenas = 0;   ///< Retired arenas still holding live blocks
+            std::size_t   retiredBytes = 0;    ///< Chunk bytes those arenas keep
+        };
+
+        /// Routes the pools to the arena on this thread while alive; nests.
+        class Scope
+        {
+        public:
+            explicit Scope(LevelArena& arena);
+            ~Scope();
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            LevelArena* previous;
+        };
+
+        /// Arena of the current level.
+        static LevelArena& Instance();
+
+        /// Release the current arena, or retire it for a fresh one if blocks are live.
+        /// Also frees retired arenas whose blocks are all gone. Called by CreateLevel.
+        static LevelArena& BeginLevel();
+
+        /// The current or retired arena that holds \a block, or null.
+        static LevelArena* Owner(const void* block);
+
+        /// The arena of this thread's innermost Scope, or null.
+        static LevelArena* Active();
+
+        /// Active() as a memory resource, falling back to new/delete.
+        static std::pmr::memory_resource* ActiveResource();
+
+        LevelArena() = default;
+        ~LevelArena() override = default;
+        LevelArena(const LevelArena&) = delete;
+        LevelArena& operator=(const LevelArena&) = delete;
+
+        /// True if \a block lies in one of the arena's chunks.
+        bool Owns(const void* block) const;
+
+        /// Drop every chunk but the largest if nothing is live; returns whether it did.
+        /// Levels go through BeginLevel(), which falls back to a fresh arena.
+        bool ReleaseIfUnused();
+
+        Stats GetStats() const;
+
+    private:
+        struct Chunk
+        {
+            std::unique_ptr<std::byte[]> data;
+            std::size_t                  size = 0;
+        };
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void  do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        std::vector<Chunk> chunks;
+        std::size_t        used = 0;           ///< Offset into chunks.back()
+        std::size_t        usedTotal = 0;
+        std::size_t        liveBlocks = 0;
+        std::uint64_t      releases = 0;
+    };
+}
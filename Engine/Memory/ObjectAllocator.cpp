@@ -21,8 +21,9 @@
                 [HeaderBlocks_][LeftPad][UserBytes(ObjectSize_)][RightPad][InterAlign(optional)]
 
             Free model:
-            - Free(ptr) validates ptr belongs to a page, is block-aligned, not double-freed,
-              and (in debug mode) pad bytes are intact.
+            - Free(ptr) finds ptr's page through the page table and checks it is on a block
+              boundary, in O(1). In debug mode it also rejects double frees (free list
+              scan) and corrupted pad bytes.
             - Freed blocks are pushed back to FreeList_.
 
             Notes:
@@ -60,6 +61,17 @@ namespace
             return value;
         return value + (alignment - remainder);
     }
+
+    /*************************************************************************************
+      \brief Smallest shift s with (1 << s) >= size, so an address bucket spans a page.
+    *************************************************************************************/
+    unsigned BucketShiftFor(unsigned size)
+    {
+        unsigned shift = 0;
+        while ((std::size_t{ 1 } << shift) < size)
+            ++shift;
+        return shift;
+    }
 }
 
 //---------------------------------------------------------------------------
@@ -111,6 +123,7 @@ ObjectAllocator::ObjectAllocator(unsigned ObjectSize, const OAConfig& config) no
 
     OAStats_.PageSize_ = static_cast<unsigned>(sizeof(void*)) + Config_.LeftAlignSize_ +
         (BlockSize_ * Config_.ObjectsPerPage_);
+    PageShift_ = BucketShiftFor(OAStats_.PageSize_);
 
     AllocateNewPage();
 }
@@ -141,6 +154,9 @@ ObjectAllocator::~ObjectAllocator() noexcept
 
     PageList_ = nullptr;
     FreeList_ = nullptr;
+
+    delete[] PageTable_;
+    PageTable_ = nullptr;
 }
 
 //---------------------------------------------------------------------------
@@ -208,6 +224,30 @@ void* ObjectAllocator::Allocate() noexcept(false)
     return user;
 }
 
+//---------------------------------------------------------------------------
+/*************************************************************************************
+  \brief Verify that a user pointer is a block of this allocator (Free() steps 2-3).
+  \param Object Pointer previously returned by Allocate() (user region pointer).
+  \throws OAException
+          - E_BAD_ADDRESS    if the pointer does not belong to any allocator page.
+          - E_BAD_BOUNDARY   if the pointer is within a page but not block-aligned.
+  \details O(1): one page table lookup. ObjectAllocatorStorage runs it on blocks its
+           thread magazines return, since those never reach Free() individually.
+*************************************************************************************/
+void ObjectAllocator::CheckBlock(const void* Object) const noexcept(false)
+{
+    const unsigned char* block = reinterpret_cast<const unsigned char*>(Object) - Config_.PadBytes_ - Config_.HeaderBlocks_;
+
+    unsigned char* page = FindPage(block);
+    unsigned char* firstBlock = page ? FirstBlockOnPage(page) : nullptr;
+    if (!page || block < firstBlock)
+        throw OAException(OAException::E_BAD_ADDRESS, "block is not within any page");
+
+    unsigned ptrdiff = static_cast<unsigned>(block - firstBlock);
+    if (ptrdiff % BlockSize_ != 0)
+        throw OAException(OAException::E_BAD_BOUNDARY, "block is not aligned to boundary");
+}
+
 //---------------------------------------------------------------------------
 /*************************************************************************************
   \brief Free a previously allocated block back to the allocator.
@@ -223,8 +263,9 @@ void* ObjectAllocator::Allocate() noexcept(false)
         1) Null pointers are ignored.
         2) Convert user pointer back to block start:
              Object - PadBytes_ - HeaderBlocks_
-        3) Verify the block lies within some page and on a BlockSize_ boundary.
-        4) Detect multiple free via IsOnFreeList(block).
+        3) Verify the block lies within some page and on a BlockSize_ boundary
+           (page table lookup, O(1)).
+        4) In debug mode, detect multiple free via IsOnFreeList(block).
         5) In debug mode, validate pad bytes using PadsAreIntact(Object).
         6) In debug mode, fill user bytes with FREED_PATTERN.
         7) Push the block onto FreeList_ and update statistics.
@@ -243,33 +284,11 @@ void ObjectAllocator::Free(void* Object) noexcept(false)
     if (!Object)
         return;
 
+    CheckBlock(Object);
     unsigned char* block = reinterpret_cast<unsigned char*>(Object) - Config_.PadBytes_ - Config_.HeaderBlocks_;
 
-    bool onPage = false;
-    void* page = PageList_;
-    while (page)
-    {
-        unsigned char* pageStart = reinterpret_cast<unsigned char*>(page);
-        unsigned char* firstBlock = FirstBlockOnPage(pageStart);
-        unsigned char* pageEnd = pageStart + OAStats_.PageSize_;
-
-        if (block >= firstBlock && block < pageEnd)
-        {
-            onPage = true;
-            unsigned ptrdiff = static_cast<unsigned>(block - firstBlock);
-            if (ptrdiff % BlockSize_ != 0)
-                throw OAException(OAException::E_BAD_BOUNDARY, "block is not aligned to boundary");
-
-            break;
-        }
-
-        page = *reinterpret_cast<void**>(page);
-    }
-
-    if (!onPage)
-        throw OAException(OAException::E_BAD_ADDRESS, "block is not within any page");
-
-    if (IsOnFreeList(block))
+    // The only non-constant check; release pools skip it.
+    if (Config_.DebugOn_ && IsOnFreeList(block))
         throw OAException(OAException::E_MULTIPLE_FREE, "block already freed");
 
     if (Config_.DebugOn_ && !PadsAreIntact(reinterpret_cast<unsigned char*>(Object)))
@@ -436,6 +455,7 @@ unsigned ObjectAllocator::FreeEmptyPages(void)
             else
                 PageList_ = next;
 
+            UnregisterPage(pageBytes);
             delete[] pageBytes;
             ++released;
             --OAStats_.PagesInUse_;
@@ -547,6 +567,16 @@ void ObjectAllocator::AllocateNewPage(void)
 
     std::memset(page, 0, OAStats_.PageSize_);
 
+    try
+    {
+        RegisterPage(page);
+    }
+    catch (...)
+    {
+        delete[] page;
+        throw OAException(OAException::E_NO_MEMORY, "failed to grow page table");
+    }
+
     *reinterpret_cast<void**>(page) = PageList_;
     PageList_ = page;
 
@@ -561,10 +591,8 @@ void ObjectAllocator::AllocateNewPage(void)
 
     for (unsigned i = 0; i < Config_.ObjectsPerPage_; ++i)
     {
-        GenericObject* node = reinterpret_cast<GenericObject*>(block);
-        node->Next = FreeList_;
-        FreeList_ = node;
-
+        // Fill the patterns first: with no header or padding the user bytes start at
+        // the block, so filling afterwards would overwrite the Next link.
         unsigned char* user = block + Config_.HeaderBlocks_ + Config_.PadBytes_;
         if (Config_.DebugOn_)
         {
@@ -579,6 +607,10 @@ void ObjectAllocator::AllocateNewPage(void)
             }
         }
 
+        GenericObject* node = reinterpret_cast<GenericObject*>(block);
+        node->Next = FreeList_;
+        FreeList_ = node;
+
         block += BlockSize_;
     }
 
@@ -647,3 +679,133 @@ bool ObjectAllocator::PadsAreIntact(const unsigned char* object) const
     }
     return true;
 }
+
+//---------------------------------------------------------------------------
+/*************************************************************************************
+  \brief Add a page to the page table under the first and last bucket it overlaps.
+  \details
+    - A bucket is at least PageSize_ bytes, so a page touches one or two buckets.
+    - The table is kept at most half full, doubling (and rehashing) when needed.
+*************************************************************************************/
+void ObjectAllocator::RegisterPage(unsigned char* page)
+{
+    if ((PageTableCount_ + 2) * 2 > PageTableCapacity_)
+    {
+        const std::size_t capacity = PageTableCapacity_ ? PageTableCapacity_ * 2 : 16;
+        PageSlot* old = PageTable_;
+        const std::size_t oldCapacity = PageTableCapacity_;
+
+        PageTable_ = new PageSlot[capacity]();
+        PageTableCapacity_ = capacity;
+        PageTableCount_ = 0;
+        for (std::size_t i = 0; i < oldCapacity; ++i)
+        {
+            if (old[i].Page)
+                InsertPageSlot(old[i].Bucket, old[i].Page);
+        }
+        delete[] old;
+    }
+
+    const std::size_t address = reinterpret_cast<std::size_t>(page);
+    const std::size_t first = address >> PageShift_;
+    const std::size_t last = (address + OAStats_.PageSize_ - 1) >> PageShift_;
+    InsertPageSlot(first, page);
+    if (last != first)
+        InsertPageSlot(last, page);
+}
+
+//---------------------------------------------------------------------------
+/*************************************************************************************
+  \brief Remove both page table entries of a page that is about to be deleted.
+*************************************************************************************/
+void ObjectAllocator::UnregisterPage(unsigned char* page)
+{
+    const std::size_t address = reinterpret_cast<std::size_t>(page);
+    const std::size_t first = address >> PageShift_;
+    const std::size_t last = (address + OAStats_.PageSize_ - 1) >> PageShift_;
+    RemovePageSlot(first, page);
+    if (last != first)
+        RemovePageSlot(last, page);
+}
+
+//---------------------------------------------------------------------------
+/*************************************************************************************
+  \brief Find the page containing a block address.
+  \param block Block start (not the user pointer).
+  \return The page start, or nullptr if the address is on no page.
+  \details
+    - Probes the block's bucket; at most three pages can overlap one bucket.
+*************************************************************************************/
+unsigned char* ObjectAllocator::FindPage(const unsigned char* block) const
+{
+    if (!PageTableCapacity_)
+        return nullptr;
+
+    const std::size_t bucket = reinterpret_cast<std::size_t>(block) >> PageShift_;
+    const std::size_t mask = PageTableCapacity_ - 1;
+    for (std::size_t i = PageSlotHome(bucket); PageTable_[i].Page; i = (i + 1) & mask)
+    {
+        const PageSlot& slot = PageTable_[i];
+        if (slot.Bucket == bucket && block >= slot.Page && block < slot.Page + OAStats_.PageSize_)
+            return slot.Page;
+    }
+    return nullptr;
+}
+
+//---------------------------------------------------------------------------
+/*************************************************************************************
+  \brief Home slot of a bucket (Fibonacci hashing on the bucket number).
+*************************************************************************************/
+std::size_t ObjectAllocator::PageSlotHome(std::size_t bucket) const
+{
+    const unsigned long long hash = static_cast<unsigned long long>(bucket) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>(hash >> 32) & (PageTableCapacity_ - 1);
+}
+
+//---------------------------------------------------------------------------
+/*************************************************************************************
+  \brief Insert one (bucket, page) entry; the caller guarantees a free slot.
+*************************************************************************************/
+void ObjectAllocator::InsertPageSlot(std::size_t bucket, unsigned char* page)
+{
+    const std::size_t mask = PageTableCapacity_ - 1;
+    std::size_t i = PageSlotHome(bucket);
+    while (PageTable_[i].Page)
+        i = (i + 1) & mask;
+    PageTable_[i].Bucket = bucket;
+    PageTable_[i].Page = page;
+    ++PageTableCount_;
+}
+
+//---------------------------------------------------------------------------
+/*************************************************************************************
+  \brief Remove one (bucket, page) entry with backward-shift deletion, so lookups never
+         need tombstones.
+*************************************************************************************/
+void ObjectAllocator::RemovePageSlot(std::size_t bucket, unsigned char* page)
+{
+    if (!PageTableCapacity_)
+        return;
+
+    const std::size_t mask = PageTableCapacity_ - 1;
+    std::size_t hole = PageSlotHome(bucket);
+    while (PageTable_[hole].Page && !(PageTable_[hole].Bucket == bucket && PageTable_[hole].Page == page))
+        hole = (hole + 1) & mask;
+    if (!PageTable_[hole].Page)
+        return;
+
+    PageTable_[hole].Page = nullptr;
+    --PageTableCount_;
+
+    // Pull later entries of the probe run back into the hole when their home allows it.
+    for (std::size_t next = (hole + 1) & mask; PageTable_[next].Page; next = (next + 1) & mask)
+    {
+        const std::size_t home = PageSlotHome(PageTable_[next].Bucket);
+        const bool stays = (hole <= next) ? (hole < home && home <= next) : (hole < home || home <= next);
+        if (stays)
+            continue;
+        PageTable_[hole] = PageTable_[next];
+        PageTable_[next].Page = nullptr;
+        hole = next;
+    }
+}
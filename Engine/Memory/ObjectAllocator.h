@@ -18,12 +18,16 @@
             - Debug patterns: Optional memory signatures to help detect misuse/corruption.
             - Padding: Optional left/right guard bytes to detect buffer overruns.
             - Alignment: Optional alignment control for returned blocks.
+            - Page table: Small open-addressed hash from address buckets to pages, so Free()
+              finds a block's page in O(1) instead of walking the page list.
 
             Usage expectations:
             - Allocate() returns raw memory for one object-sized block.
             - Clients typically construct/destruct objects using placement new and explicit
               destructor calls (the allocator does not call destructors automatically).
-            - Free(ptr) returns a previously allocated block back to the allocator.
+            - Free(ptr) returns a previously allocated block back to the allocator. It is O(1)
+              when DebugOn_ is false; with DebugOn_ it also scans the free list for double
+              frees and checks pad bytes (the CS280 validation).
             - Errors are reported via OAException with codes such as E_NO_PAGES,
               E_BAD_ADDRESS, E_MULTIPLE_FREE, or E_CORRUPTED_BLOCK.
 
@@ -40,6 +44,7 @@
 #pragma warning( disable : 4290 ) // suppress warning: C++ Exception Specification ignored
 #endif
 
+#include <cstddef>
 #include <string>
 
 // If the client doesn't specify these:
@@ -162,6 +167,9 @@ public:
     // Throws an exception if the the object can't be freed. (Invalid object)
     void Free(void* Object) noexcept(false);
 
+    // Throws like Free() if the object is not a block of this allocator (page + boundary check only)
+    void CheckBlock(const void* Object) const noexcept(false);
+
     // Calls the callback fn for each block still in use
     unsigned DumpMemoryInUse(DUMPCALLBACK fn) const;
 
@@ -196,6 +204,18 @@ private:
     // Cached block size for pointer math
     unsigned BlockSize_ = 0;
 
+    // Page table: every page is registered under each (1 << PageShift_)-byte address bucket
+    // it overlaps (at most two, since a bucket is at least a page long). Linear probing.
+    struct PageSlot
+    {
+        std::size_t Bucket;
+        unsigned char* Page;      // nullptr = empty slot
+    };
+    PageSlot* PageTable_ = nullptr;
+    std::size_t PageTableCapacity_ = 0;   // power of two
+    std::size_t PageTableCount_ = 0;
+    unsigned PageShift_ = 0;
+
     // Allocate a new page and populate the free list
     void AllocateNewPage(void);
     // Helper to get the first block pointer in a page
@@ -204,6 +224,13 @@ private:
     bool IsOnFreeList(const void* object) const;
     // Helper to validate pad bytes for a block
     bool PadsAreIntact(const unsigned char* object) const;
+    // Page table maintenance and O(1) lookup of the page holding a block (nullptr if none)
+    void RegisterPage(unsigned char* page);
+    void UnregisterPage(unsigned char* page);
+    unsigned char* FindPage(const unsigned char* block) const;
+    void InsertPageSlot(std::size_t bucket, unsigned char* page);
+    void RemovePageSlot(std::size_t bucket, unsigned char* page);
+    std::size_t PageSlotHome(std::size_t bucket) const;
 };
 
 #endif
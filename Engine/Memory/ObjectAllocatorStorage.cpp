@@ -0,0 +1,424 @@
+/*********************************************************************************************
+ \file      ObjectAllocatorStorage.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Thread-safe front end of ObjectAllocatorStorage (per-thread magazines over a
+            shared depot) and the alloc/free benchmark for the pooled configuration.
+ \details   A free batch is kBatchSize blocks linked through their first word; the first
+            block's second word links the batch into the depot. The depot is only touched
+            under allocatorMutex_, once per kBatchSize magazine operations. No thread
+            reads a batch's links after it has been popped and handed out as live objects.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Memory/ObjectAllocatorStorage.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        /// Every live storage, plus the mutex for magazine registration and teardown.
+        struct StorageRegistry
+        {
+            std::mutex                           mutex;
+            std::vector<ObjectAllocatorStorage*> storages;
+            std::size_t                          nextId = 0;
+        };
+
+        StorageRegistry& Registry()
+        {
+            static StorageRegistry registry;
+            return registry;
+        }
+    }
+
+    /// How a free batch is threaded through its own blocks.
+    struct ObjectAllocatorStorage::BatchLink
+    {
+        BatchLink* nextBlock;   ///< Next block of this batch (null after kBatchSize)
+        BatchLink* nextBatch;   ///< First block only: next batch in the depot
+    };
+
+    /// One thread's free blocks for one storage. Only the owning thread writes count;
+    /// it is atomic so GetCacheStats() can read it from another thread.
+    struct ObjectAllocatorStorage::ThreadCache
+    {
+        ObjectAllocatorStorage* owner = nullptr;   ///< Null once the storage is destroyed
+        std::atomic<unsigned>   count{ 0 };
+        void*                   blocks[2 * kBatchSize];
+    };
+
+    ObjectAllocatorStorage::ObjectAllocatorStorage(unsigned objectSize, unsigned objectsPerPage,
+        unsigned maxPages, bool debugOn)
+        : allocator_(std::max<unsigned>(objectSize, sizeof(BatchLink)),
+            OAConfig(false, objectsPerPage, maxPages, debugOn, 0, 0, alignof(std::max_align_t)))
+        , cached_(!debugOn)
+    {
+        StorageRegistry& registry = Registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        id_ = registry.nextId++;
+        registry.storages.push_back(this);
+    }
+
+    ObjectAllocatorStorage::~ObjectAllocatorStorage()
+    {
+        StorageRegistry& registry = Registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (ThreadCache* cache : caches_)
+        {
+            cache->owner = nullptr;
+            cache->count.store(0, std::memory_order_relaxed);
+        }
+        caches_.clear();
+        registry.storages.erase(std::remove(registry.storages.begin(), registry.storages.end(), this),
+            registry.storages.end());
+    }
+
+    /*****************************************************************************************
+      \brief Fast path: pop from this thread's magazine, refilling a batch when it is empty.
+    *****************************************************************************************/
+    void* ObjectAllocatorStorage::Allocate()
+    {
+        ThreadCache* cache = cached_ ? LocalCache() : nullptr;
+        if (!cache)
+            return LockedAllocate();
+
+        unsigned count = cache->count.load(std::memory_order_relaxed);
+        if (count == 0)
+        {
+            Refill(*cache);
+            count = cache->count.load(std::memory_order_relaxed);
+        }
+        --count;
+        cache->count.store(count, std::memory_order_relaxed);
+        return cache->blocks[count];
+    }
+
+    /*****************************************************************************************
+      \brief Fast path: push onto this thread's magazine, returning a batch when it is full.
+    *****************************************************************************************/
+    void ObjectAllocatorStorage::Free(void* ptr)
+    {
+        ThreadCache* cache = cached_ && ptr ? LocalCache() : nullptr;
+        if (!cache)
+        {
+            LockedFree(ptr);
+            return;
+        }
+
+        if (cache->count.load(std::memory_order_relaxed) == 2 * kBatchSize)
+            ReturnBatch(*cache);
+        const unsigned count = cache->count.load(std::memory_order_relaxed);
+        cache->blocks[count] = ptr;
+        cache->count.store(count + 1, std::memory_order_relaxed);
+    }
+
+    /*****************************************************************************************
+      \brief This thread's magazine for this storage, created and registered on first use.
+      \details Magazines are indexed by storage id, which is never reused, so a magazine
+               left behind by a destroyed storage is simply never looked at again. At thread
+               exit the remaining blocks go back to their allocators; any pool use after that
+               (static destructors) takes the locked path.
+    *****************************************************************************************/
+    ObjectAllocatorStorage::ThreadCache* ObjectAllocatorStorage::LocalCache()
+    {
+        struct Magazines
+        {
+            std::vector<std::unique_ptr<ThreadCache>> byStorage;
+            bool*                                     tornDown = nullptr;
+
+            ~Magazines()
+            {
+                *tornDown = true;
+                std::lock_guard<std::mutex> lock(Registry().mutex);
+                for (auto& cache : byStorage)
+                {
+                    if (cache && cache->owner)
+                        cache->owner->ReleaseCache(*cache);
+                }
+            }
+        };
+
+        thread_local bool tornDown = false;
+        if (tornDown)
+            return nullptr;
+        thread_local Magazines magazines{ {}, &tornDown };
+
+        if (id_ >= magazines.byStorage.size())
+            magazines.byStorage.resize(id_ + 1);
+        std::unique_ptr<ThreadCache>& cache = magazines.byStorage[id_];
+        if (!cache)
+        {
+            cache = std::make_unique<ThreadCache>();
+            cache->owner = this;
+            std::lock_guard<std::mutex> lock(Registry().mutex);
+            caches_.push_back(cache.get());
+        }
+        return cache.get();
+    }
+
+    /*****************************************************************************************
+      \brief Fill an empty magazine with one batch: from the depot if it has one, otherwise
+             straight from the allocator.
+    *****************************************************************************************/
+    void ObjectAllocatorStorage::Refill(ThreadCache& cache)
+    {
+        std::lock_guard<std::mutex> lock(allocatorMutex_);
+        if (BatchLink* top = depot_)
+        {
+            depot_ = top->nextBatch;
+            unsigned count = 0;
+            for (BatchLink* block = top; block && count < kBatchSize; block = block->nextBlock)
+                cache.blocks[count++] = block;
+            cache.count.store(count, std::memory_order_relaxed);
+            depotBlocks_.fetch_sub(count, std::memory_order_relaxed);
+            depotRefills_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        unsigned count = 0;
+        try
+        {
+            for (; count < kBatchSize; ++count)
+                cache.blocks[count] = allocator_.Allocate();
+        }
+        catch (const OAException&)
+        {
+            if (count == 0)
+                throw;   // out of pages: nothing to hand out
+        }
+        cache.count.store(count, std::memory_order_relaxed);
+        pageRefills_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /*****************************************************************************************
+      \brief Link the newest kBatchSize blocks of a full magazine and push them onto the depot.
+      \details Each block first gets ObjectAllocator's release-mode address check (page
+               lookup + block boundary), so a foreign or misaligned pointer is still reported
+               with E_BAD_ADDRESS / E_BAD_BOUNDARY, one batch after the Free() that passed it.
+               The blocks that failed are dropped from the magazine before the throw.
+    *****************************************************************************************/
+    void ObjectAllocatorStorage::ReturnBatch(ThreadCache& cache)
+    {
+        const unsigned count = cache.count.load(std::memory_order_relaxed);
+        void** first = cache.blocks + (count - kBatchSize);
+
+        std::lock_guard<std::mutex> lock(allocatorMutex_);
+        for (unsigned i = 0; i < kBatchSize; ++i)
+        {
+            try
+            {
+                allocator_.CheckBlock(first[i]);
+            }
+            catch (const OAException&)
+            {
+                first[i] = first[kBatchSize - 1];
+                cache.count.store(count - 1, std::memory_order_relaxed);
+                throw;
+            }
+        }
+
+        for (unsigned i = 0; i < kBatchSize; ++i)
+        {
+            static_cast<BatchLink*>(first[i])->nextBlock =
+                i + 1 < kBatchSize ? static_cast<BatchLink*>(first[i + 1]) : nullptr;
+        }
+
+        BatchLink* batch = static_cast<BatchLink*>(first[0]);
+        batch->nextBatch = depot_;
+        depot_ = batch;
+
+        cache.count.store(count - kBatchSize, std::memory_order_relaxed);
+        depotBlocks_.fetch_add(kBatchSize, std::memory_order_relaxed);
+        returns_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void ObjectAllocatorStorage::ReleaseCache(ThreadCache& cache)
+    {
+        {
+            std::lock_guard<std::mutex> lock(allocatorMutex_);
+            const unsigned count = cache.count.load(std::memory_order_relaxed);
+            for (unsigned i = 0; i < count; ++i)
+                allocator_.Free(cache.blocks[i]);
+        }
+        cache.count.store(0, std::memory_order_relaxed);
+        cache.owner = nullptr;
+        caches_.erase(std::remove(caches_.begin(), caches_.end(), &cache), caches_.end());
+    }
+
+    /*****************************************************************************************
+      \brief Give every block cached by the depot and by the calling thread's magazine back
+             to the allocator, then free the pages that are now empty.
+      \details Other threads' magazines (at most 2 * kBatchSize blocks each) are left alone;
+               only their owner may touch them, so pages holding those blocks stay.
+    *****************************************************************************************/
+    unsigned ObjectAllocatorStorage::TrimEmptyPages()
+    {
+        ThreadCache* cache = cached_ ? LocalCache() : nullptr;
+
+        std::lock_guard<std::mutex> lock(allocatorMutex_);
+        if (cache)
+        {
+            const unsigned count = cache->count.load(std::memory_order_relaxed);
+            for (unsigned i = 0; i < count; ++i)
+                allocator_.Free(cache->blocks[i]);
+            cache->count.store(0, std::memory_order_relaxed);
+        }
+
+        while (BatchLink* batch = depot_)
+        {
+            depot_ = batch->nextBatch;
+            for (BatchLink* block = batch; block;)
+            {
+                BatchLink* next = block->nextBlock;   // Free() overwrites the first word
+                allocator_.Free(block);
+                block = next;
+            }
+        }
+        depotBlocks_.store(0, std::memory_order_relaxed);
+        return allocator_.FreeEmptyPages();
+    }
+
+    /*****************************************************************************************
+      \brief Allocator statistics with blocks parked in magazines and the depot counted as
+             free rather than in use.
+    *****************************************************************************************/
+    OAStats ObjectAllocatorStorage::GetStats() const
+    {
+        unsigned cachedBlocks = depotBlocks_.load(std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(Registry().mutex);
+            for (const ThreadCache* cache : caches_)
+                cachedBlocks += cache->count.load(std::memory_order_relaxed);
+        }
+
+        std::lock_guard<std::mutex> lock(allocatorMutex_);
+        OAStats stats = allocator_.GetStats();
+        cachedBlocks = std::min(cachedBlocks, stats.ObjectsInUse_);
+        stats.ObjectsInUse_ -= cachedBlocks;
+        stats.FreeObjects_ += cachedBlocks;
+        return stats;
+    }
+
+    unsigned ObjectAllocatorStorage::ValidatePages(ObjectAllocator::VALIDATECALLBACK fn) const
+    {
+        std::lock_guard<std::mutex> lock(allocatorMutex_);
+        return allocator_.ValidatePages(fn);
+    }
+
+    void* ObjectAllocatorStorage::LockedAllocate()
+    {
+        std::lock_guard<std::mutex> lock(allocatorMutex_);
+        return allocator_.Allocate();
+    }
+
+    void ObjectAllocatorStorage::LockedFree(void* ptr)
+    {
+        std::lock_guard<std::mutex> lock(allocatorMutex_);
+        allocator_.Free(ptr);
+    }
+
+    void ObjectAllocatorStorage::AddCacheStats(CacheStats& out) const
+    {
+        ++out.storages;
+        out.threads += static_cast<unsigned>(caches_.size());
+        for (const ThreadCache* cache : caches_)
+            out.threadBlocks += cache->count.load(std::memory_order_relaxed);
+        out.depotBlocks += depotBlocks_.load(std::memory_order_relaxed);
+        out.depotRefills += depotRefills_.load(std::memory_order_relaxed);
+        out.pageRefills += pageRefills_.load(std::memory_order_relaxed);
+        out.returns += returns_.load(std::memory_order_relaxed);
+    }
+
+    ObjectAllocatorStorage::CacheStats ObjectAllocatorStorage::GetCacheStats() const
+    {
+        CacheStats stats;
+        std::lock_guard<std::mutex> lock(Registry().mutex);
+        AddCacheStats(stats);
+        return stats;
+    }
+
+    ObjectAllocatorStorage::CacheStats ObjectAllocatorStorage::TotalCacheStats()
+    {
+        CacheStats stats;
+        StorageRegistry& registry = Registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (const ObjectAllocatorStorage* storage : registry.storages)
+            storage->AddCacheStats(stats);
+        return stats;
+    }
+
+    namespace
+    {
+        /// Run \a cycles alloc/free pairs in bursts; returns milliseconds.
+        double TimeBursts(ObjectAllocator& allocator, unsigned cycles, const std::vector<unsigned>& freeOrder)
+        {
+            const unsigned burst = static_cast<unsigned>(freeOrder.size());
+            std::vector<void*> live(burst, nullptr);
+
+            const auto start = std::chrono::steady_clock::now();
+            for (unsigned done = 0; done < cycles; done += burst)
+            {
+                const unsigned count = std::min(burst, cycles - done);
+                for (unsigned i = 0; i < count; ++i)
+                    live[i] = allocator.Allocate();
+                for (unsigned i = 0; i < burst; ++i)
+                {
+                    const unsigned slot = freeOrder[i];
+                    if (slot < count)
+                        allocator.Free(live[slot]);
+                }
+            }
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+
+    ObjectAllocatorStorage::BenchmarkResult ObjectAllocatorStorage::RunBenchmark(unsigned cycles, unsigned burst, unsigned objectSize)
+    {
+        BenchmarkResult result;
+        burst = std::max(1u, burst);
+        result.cycles = cycles;
+        result.burst = burst;
+
+        std::vector<unsigned> freeOrder(burst);
+        std::iota(freeOrder.begin(), freeOrder.end(), 0u);
+        std::shuffle(freeOrder.begin(), freeOrder.end(), std::mt19937(1234u));
+
+        const OAConfig config(false, 64, 0, false, 0, 0, alignof(std::max_align_t));
+        {
+            ObjectAllocator allocator(objectSize, config);
+            TimeBursts(allocator, burst, freeOrder);   // grow the pages outside the timing
+            result.releaseMs = TimeBursts(allocator, cycles, freeOrder);
+            result.pages = allocator.GetStats().PagesInUse_;
+        }
+        {
+            ObjectAllocator allocator(objectSize, config);
+            allocator.SetDebugState(true);
+            TimeBursts(allocator, burst, freeOrder);
+            result.debugCycles = std::max(burst, cycles / 16);
+            result.debugMs = TimeBursts(allocator, result.debugCycles, freeOrder);
+        }
+
+        result.releaseNsPerCycle = cycles ? result.releaseMs * 1e6 / cycles : 0.0;
+        result.debugNsPerCycle = result.debugCycles ? result.debugMs * 1e6 / result.debugCycles : 0.0;
+
+        std::cout << "[Allocator] " << cycles << " alloc/free cycles (bursts of " << burst << ", "
+            << objectSize << " B, " << result.pages << " pages): release " << result.releaseMs << " ms ("
+            << result.releaseNsPerCycle << " ns/cycle), debug " << result.debugNsPerCycle << " ns/cycle\n";
+        return result;
+    }
+}
@@ -18,6 +18,24 @@
             - Alignment defaults to alignof(std::max_align_t) to support allocating most
               standard types safely (unless a type requires stricter alignment).
             - Debug mode can be enabled at construction to activate patterns/pad checks.
+              The engine pools pass kPoolDebugChecks: CS280 validation in _DEBUG builds,
+              the O(1) Free() path in release.
+
+            Threading:
+            - Allocate()/Free() may be called from any thread. With debug checks off each
+              thread keeps a small magazine of free blocks per storage, so the common case
+              touches no shared state. An empty magazine refills with a whole batch of
+              kBatchSize blocks, and a full one returns a batch. Batches go through a
+              shared depot that, like the allocator behind it, is guarded by one mutex,
+              so a thread takes that lock once per kBatchSize calls.
+            - Returned batches get the allocator's release-mode address check
+              (E_BAD_ADDRESS / E_BAD_BOUNDARY), reported one batch late. Double frees are
+              not detected on this path.
+            - With debug checks on, every call goes straight to the allocator under the
+              mutex, so double frees and corruption are still caught exactly.
+            - Blocks cached by a thread go back to the allocator when that thread exits.
+            - Allocator() is not synchronized; only use it while no other thread touches
+              the pool. GetStats(), ValidatePages() and TrimEmptyPages() lock.
 
  \copyright
             All content  2025 DigiPen Institute of Technology Singapore.
@@ -25,11 +43,22 @@
 *********************************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
 #include "Memory/ObjectAllocator.h"
 
 namespace Framework
 {
+    /// DebugOn_ for ComponentPool / GameObjectPool storage.
+#ifdef _DEBUG
+    inline constexpr bool kPoolDebugChecks = true;
+#else
+    inline constexpr bool kPoolDebugChecks = false;
+#endif
+
     /*************************************************************************************
       \brief Small helper that owns an ObjectAllocator and provides a simplified API.
       \details
@@ -42,6 +71,9 @@ namespace Framework
     class ObjectAllocatorStorage
     {
     public:
+        /// Blocks moved between a thread's magazine and the shared depot in one go.
+        static constexpr unsigned kBatchSize = 32;
+
         /*********************************************************************************
           \brief Construct storage with an ObjectAllocator configured for a fixed object size.
           \param objectSize      Size in bytes for each allocatable block.
@@ -55,19 +87,26 @@ namespace Framework
                 HeaderBlocks     = 0
                 Alignment        = alignof(std::max_align_t)
             - alignof(std::max_align_t) is a safe default for general-purpose allocations.
+            - Blocks are at least two pointers wide so a free batch can be linked
+              through the blocks themselves.
         *********************************************************************************/
         explicit ObjectAllocatorStorage(unsigned objectSize,
             unsigned objectsPerPage = DEFAULT_OBJECTS_PER_PAGE,
             unsigned maxPages = DEFAULT_MAX_PAGES,
-            bool debugOn = false)
-            : allocator_(objectSize, OAConfig(false, objectsPerPage, maxPages, debugOn, 0, 0, alignof(std::max_align_t)))
-        {
-        }
+            bool debugOn = false);
+
+        /// Detaches every thread's magazine; blocks they still hold die with the pages.
+        ~ObjectAllocatorStorage();
+
+        ObjectAllocatorStorage(const ObjectAllocatorStorage&) = delete;
+        ObjectAllocatorStorage& operator=(const ObjectAllocatorStorage&) = delete;
 
         /*********************************************************************************
           \brief Get a mutable reference to the underlying ObjectAllocator.
           \return Reference to the owned allocator instance.
-          \note  Useful for querying stats, enabling/disabling debug state, etc.
+          \note  Useful for querying stats, enabling/disabling debug state, etc. Not
+                 synchronized: blocks parked in magazines count as in use there (GetStats()
+                 corrects for that).
         *********************************************************************************/
         ObjectAllocator& Allocator() { return allocator_; }
 
@@ -78,20 +117,83 @@ namespace Framework
         const ObjectAllocator& Allocator() const { return allocator_; }
 
         /*********************************************************************************
-          \brief Allocate one block from the underlying allocator.
+          \brief Allocate one block, from this thread's magazine when possible.
           \return Pointer to a raw memory block sized to objectSize (user region).
           \throws OAException on allocation failure (e.g., out of pages/memory).
         *********************************************************************************/
-        void* Allocate() { return allocator_.Allocate(); }
+        void* Allocate();
 
         /*********************************************************************************
-          \brief Return a block to the underlying allocator.
-          \param ptr Pointer previously returned by Allocate().
-          \throws OAException on invalid frees (bad address/boundary/double free/corruption).
+          \brief Return a block to this thread's magazine (or the allocator in debug).
+          \param ptr Pointer previously returned by Allocate(), from any thread.
+          \throws OAException on invalid frees when debug checks are on (bad
+                  address/boundary/double free/corruption).
         *********************************************************************************/
-        void Free(void* ptr) { allocator_.Free(ptr); }
+        void Free(void* ptr);
+
+        /// Allocator stats with blocks cached in magazines/the depot counted as free.
+        OAStats GetStats() const;
+
+        /// ObjectAllocator::ValidatePages() under the storage mutex.
+        unsigned ValidatePages(ObjectAllocator::VALIDATECALLBACK fn) const;
+
+        /*********************************************************************************
+          \brief Return the depot and the calling thread's magazine to the allocator, then
+                 free the pages left empty (ObjectAllocator::FreeEmptyPages()).
+          \return Pages freed. Blocks cached by other threads keep their pages alive.
+        *********************************************************************************/
+        unsigned TrimEmptyPages();
+
+        /// Magazine/depot counters, summed over every thread that used the storage.
+        struct CacheStats
+        {
+            unsigned      storages = 0;       ///< Storages summed (1 unless from TotalCacheStats)
+            unsigned      threads = 0;        ///< Threads holding a magazine right now
+            unsigned      threadBlocks = 0;   ///< Free blocks sitting in those magazines
+            unsigned      depotBlocks = 0;    ///< Free blocks in the shared depot
+            std::uint64_t depotRefills = 0;   ///< Magazine refills served by the depot
+            std::uint64_t pageRefills = 0;    ///< Refills that had to lock the allocator
+            std::uint64_t returns = 0;        ///< Batches handed back to the depot
+        };
+
+        /// Counters for this storage; all zero when debug checks bypass the magazines.
+        CacheStats GetCacheStats() const;
+
+        /// The same counters summed over every live storage (all component pools + GOCs).
+        static CacheStats TotalCacheStats();
+
+        /// Result of RunBenchmark(); "release" has DebugOn_ off, "debug" has it on.
+        struct BenchmarkResult
+        {
+            unsigned cycles = 0;          ///< Alloc/free pairs timed with DebugOn_ off
+            unsigned burst = 0;           ///< Objects alive at the peak of each round
+            unsigned pages = 0;           ///< Pages the allocator grew to
+            double   releaseMs = 0.0;
+            double   releaseNsPerCycle = 0.0;
+            unsigned debugCycles = 0;     ///< Fewer: debug Free() is O(free blocks)
+            double   debugMs = 0.0;
+            double   debugNsPerCycle = 0.0;
+        };
+
+        /*********************************************************************************
+          \brief Time \p cycles alloc/free pairs of \p objectSize-byte blocks, in rounds
+                 that allocate \p burst objects and free them in shuffled order (like a
+                 particle burst), with 64 objects per page as in ComponentPool.
+        *********************************************************************************/
+        static BenchmarkResult RunBenchmark(unsigned cycles, unsigned burst, unsigned objectSize);
 
     private:
+        struct ThreadCache;
+        friend struct ThreadCache;
+
+        ThreadCache* LocalCache();                     ///< Null once this thread's magazines are torn down
+        void Refill(ThreadCache& cache);
+        void ReturnBatch(ThreadCache& cache);
+        void ReleaseCache(ThreadCache& cache);         ///< Registry mutex held
+        void AddCacheStats(CacheStats& out) const;     ///< Registry mutex held
+        void* LockedAllocate();
+        void LockedFree(void* ptr);
+
         /*********************************************************************************
           \brief Owned allocator instance (RAII).
           \details
@@ -99,5 +201,16 @@ namespace Framework
               ObjectAllocatorStorage goes out of scope.
         *********************************************************************************/
         ObjectAllocator allocator_;
+        mutable std::mutex allocatorMutex_;            ///< Guards allocator_ and depot_
+        std::size_t     id_ = 0;                       ///< Index of this storage in each thread's magazines
+        bool            cached_ = false;               ///< Magazines on (debug checks off)
+
+        struct BatchLink;
+        BatchLink*                  depot_ = nullptr;  ///< Full-batch stack; allocatorMutex_
+        std::atomic<unsigned>       depotBlocks_{ 0 };
+        std::atomic<std::uint64_t>  depotRefills_{ 0 };
+        std::atomic<std::uint64_t>  pageRefills_{ 0 };
+        std::atomic<std::uint64_t>  returns_{ 0 };
+        std::vector<ThreadCache*>   caches_;           ///< Live magazines; guarded by the registry mutex
     };
 }
@@ -0,0 +1,233 @@
+/*********************************************************************************************
+ \file      EventBus.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements EventBus: subscriber bookkeeping, dispatch, the deferred queue flush
+            and the throughput benchmark.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Messaging_System/EventBus.h"
+#include "Messaging_System/Messager_Bus.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    EventBus& EventBus::Instance()
+    {
+        static EventBus bus;
+        return bus;
+    }
+
+    std::size_t EventBus::NextTypeIndex()
+    {
+        static std::size_t next = 0;
+        return next++;
+    }
+
+    EventBus::Channel& EventBus::ChannelFor(std::size_t type)
+    {
+        if (type >= channels.size())
+            channels.resize(type + 1);
+        return channels[type];
+    }
+
+    EventBus::SubscriptionId EventBus::Add(std::size_t type, void* context, Thunk invoke)
+    {
+        Channel& channel = ChannelFor(type);
+        const SubscriptionId id = nextId++;
+        channel.subscribers.push_back(Subscriber{ id, context, invoke });
+        ++channel.live;
+        return id;
+    }
+
+    /*****************************************************************************************
+      \brief Clear the slot now; the vector is only compacted outside of dispatch so that
+             an in-progress Publish() keeps valid indices.
+    *****************************************************************************************/
+    void EventBus::Unsubscribe(SubscriptionId id)
+    {
+        if (id == 0)
+            return;
+
+        for (Channel& channel : channels)
+        {
+            for (Subscriber& subscriber : channel.subscribers)
+            {
+                if (subscriber.id != id)
+                    continue;
+                subscriber = Subscriber{};
+                --channel.live;
+                channel.hasGaps = true;
+                compactPending = true;
+                if (dispatchDepth == 0)
+                    Compact();
+                return;
+            }
+        }
+    }
+
+    /*****************************************************************************************
+      \brief Index-based walk: handlers may subscribe (growing the vector) mid-dispatch.
+             Only subscribers present when the event started are called.
+    *****************************************************************************************/
+    void EventBus::Dispatch(std::size_t type, const void* event)
+    {
+        ++dispatchDepth;
+        const std::size_t count = channels[type].subscribers.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Subscriber subscriber = channels[type].subscribers[i];
+            if (subscriber.id != 0)
+                subscriber.invoke(subscriber.context, event);
+        }
+        if (--dispatchDepth == 0 && compactPending)
+            Compact();
+    }
+
+    /*****************************************************************************************
+      \brief Swap every queue pair first, so anything a handler enqueues waits for the next
+             frame whatever its type, then deliver the read sides. Channels are looked up
+             by index for every event because a handler may add a new event type, which
+             can move the channel array.
+    *****************************************************************************************/
+    void EventBus::Flush()
+    {
+        const auto start = std::chrono::steady_clock::now();
+        std::size_t delivered = 0;
+
+        const std::size_t channelCount = channels.size();
+        for (Channel& channel : channels)
+            channel.writeQueue ^= 1;
+
+        for (std::size_t type = 0; type < channelCount; ++type)
+        {
+            const int read = channels[type].writeQueue ^ 1;
+            const std::size_t used = channels[type].queued[read];
+            if (used == 0)
+                continue;
+
+            const std::size_t size = channels[type].eventSize;
+            for (std::size_t offset = 0; offset < used; offset += size)
+                Dispatch(type, channels[type].queues[read].data() + offset);
+            channels[type].queued[read] = 0;
+            delivered += used / size;
+        }
+
+        lastFlush.events = delivered;
+        lastFlush.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    namespace
+    {
+        struct BenchmarkEvent
+        {
+            std::uint32_t id;
+            float x;
+            float y;
+            float value;
+        };
+
+        struct BenchmarkSink
+        {
+            double sum = 0.0;
+            void OnEvent(const BenchmarkEvent& event) { sum += event.value; }
+        };
+    }
+
+    /*****************************************************************************************
+      \brief The queued run does one warm-up frame first, so steadyGrowthBytes shows whether
+             later frames still grow (allocate) the queues.
+    *****************************************************************************************/
+    EventBus::BenchmarkResult EventBus::RunBenchmark(std::size_t eventsPerFrame, int frames, std::size_t subscribers)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto elapsedMs = [](Clock::time_point from) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - from).count();
+        };
+
+        BenchmarkResult result;
+        result.eventsPerFrame = eventsPerFrame;
+        result.subscribers = std::max<std::size_t>(subscribers, 1);
+        result.frames = std::max(frames, 1);
+
+        EventBus bus;
+        std::vector<BenchmarkSink> sinks(result.subscribers);
+        for (BenchmarkSink& sink : sinks)
+            bus.Subscribe<BenchmarkEvent, &BenchmarkSink::OnEvent>(&sink);
+
+        auto makeEvent = [](std::size_t i) {
+            return BenchmarkEvent{ static_cast<std::uint32_t>(i), 0.0f, 0.0f, static_cast<float>(i & 7u) };
+        };
+
+        Clock::time_point start = Clock::now();
+        for (int f = 0; f < result.frames; ++f)
+            for (std::size_t i = 0; i < eventsPerFrame; ++i)
+                bus.Publish(makeEvent(i));
+        result.publishMs = elapsedMs(start) / result.frames;
+
+        for (int warmUp = 0; warmUp < 2; ++warmUp)   // one frame per buffer
+        {
+            for (std::size_t i = 0; i < eventsPerFrame; ++i)
+                bus.Enqueue(makeEvent(i));
+            bus.Flush();
+        }
+        auto queueCapacity = [&bus]() {
+            std::size_t bytes = 0;
+            for (const Channel& channel : bus.channels)
+                bytes += channel.queues[0].size() + channel.queues[1].size();
+            return bytes;
+        };
+        const std::size_t warmCapacity = queueCapacity();
+
+        start = Clock::now();
+        for (int f = 0; f < result.frames; ++f)
+        {
+            for (std::size_t i = 0; i < eventsPerFrame; ++i)
+                bus.Enqueue(makeEvent(i));
+            bus.Flush();
+        }
+        result.queuedMs = elapsedMs(start) / result.frames;
+        result.steadyGrowthBytes = queueCapacity() - warmCapacity;
+
+        MessageBus legacy;
+        std::vector<double> legacySums(result.subscribers, 0.0);
+        for (double& sum : legacySums)
+            legacy.subscribe(KEY_1, [&sum]() { sum += 1.0; });
+        const Message legacyMessage(KEY_1);
+        start = Clock::now();
+        for (int f = 0; f < result.frames; ++f)
+            for (std::size_t i = 0; i < eventsPerFrame; ++i)
+                legacy.publish(legacyMessage);
+        result.legacyMs = elapsedMs(start) / result.frames;
+
+        std::cout << "[EventBus] " << eventsPerFrame << " events/frame x " << result.subscribers
+            << " subscribers: publish " << result.publishMs << " ms, queued " << result.queuedMs
+            << " ms, MessageBus " << result.legacyMs << " ms, queue growth after warm-up "
+            << result.steadyGrowthBytes << " bytes\n";
+        return result;
+    }
+
+    void EventBus::Compact()
+    {
+        for (Channel& channel : channels)
+        {
+            if (!channel.hasGaps)
+                continue;
+            auto& subs = channel.subscribers;
+            subs.erase(std::remove_if(subs.begin(), subs.end(),
+                [](const Subscriber& s) { return s.id == 0; }), subs.end());
+            channel.hasGaps = false;
+        }
+        compactPending = false;
+    }
+}
@@ -0,0 +1,184 @@
+/*********************************************************************************************
+ \file      EventBus.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Typed publish/subscribe bus. Each event is a plain struct, and each event type
+            has its own array of subscribers and its own deferred queue.
+ \details   Subscribers are bound at compile time, either to a member function
+            (Subscribe<E, &T::OnEvent>(this)) or to a free function (Subscribe<E, &OnEvent>()).
+            A subscriber is a context pointer plus a small thunk, so publishing walks one
+            flat array and never allocates.
+
+            Publish() calls the subscribers immediately. Enqueue() copies the event into
+            the type's write queue instead, and Flush() (once per frame, after the systems
+            update) swaps each queue pair and delivers the read side in order. Events
+            enqueued by a handler during Flush() land in the other buffer and go out on
+            the next frame. Queues are byte arrays that keep their capacity, so once they
+            have grown to a frame's worth of events, enqueueing no longer allocates.
+
+            The bus is not locked, so only one thread may use it at a time. That is the
+            thread running SystemManager::UpdateAll(): the main thread in serial frames, the
+            SimulationThread in pipelined ones (Publish, Enqueue and Flush all run there).
+            Any other caller, including the main thread during a pipelined frame's world
+            pass, must wait for SimulationThread::Sync() first.
+
+            Handlers may subscribe or unsubscribe while an event is being published: removed
+            handlers are skipped at once and their slots are compacted after the outermost
+            Publish() returns, and new handlers first run on the next event.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class EventBus
+      \brief Per-event-type subscriber arrays with immediate and queued dispatch.
+    *****************************************************************************************/
+    class EventBus
+    {
+    public:
+        /// Handle returned by Subscribe(); 0 is never issued.
+        using SubscriptionId = std::uint32_t;
+
+        /// Engine-wide bus used by the factory and gameplay systems.
+        static EventBus& Instance();
+
+        /// Bind \a Method of \a owner to events of type E.
+        template <typename E, auto Method, typename T>
+        SubscriptionId Subscribe(T* owner)
+        {
+            static_assert(std::is_trivially_copyable_v<E>, "Events must be plain structs");
+            return Add(TypeIndex<E>(), owner, [](void* context, const void* event)
+                {
+                    (static_cast<T*>(context)->*Method)(*static_cast<const E*>(event));
+                });
+        }
+
+        /// Bind the free function \a Function to events of type E.
+        template <typename E, auto Function>
+        SubscriptionId Subscribe()
+        {
+            static_assert(std::is_trivially_copyable_v<E>, "Events must be plain structs");
+            return Add(TypeIndex<E>(), nullptr, [](void*, const void* event)
+                {
+                    Function(*static_cast<const E*>(event));
+                });
+        }
+
+        /// Remove a subscription. Unknown or already removed ids are ignored.
+        void Unsubscribe(SubscriptionId id);
+
+        /// Call every subscriber of E, in subscription order.
+        template <typename E>
+        void Publish(const E& event)
+        {
+            const std::size_t type = TypeIndex<E>();
+            if (type < channels.size())
+                Dispatch(type, &event);
+        }
+
+        /// Queue \a event for the next Flush().
+        template <typename E>
+        void Enqueue(const E& event)
+        {
+            static_assert(std::is_trivially_copyable_v<E>, "Events must be plain structs");
+            static_assert(alignof(E) <= alignof(std::max_align_t), "Over-aligned events cannot be queued");
+            Channel& channel = ChannelFor(TypeIndex<E>());
+            channel.eventSize = sizeof(E);
+            std::size_t& used = channel.queued[channel.writeQueue];
+            std::vector<std::byte>& queue = channel.queues[channel.writeQueue];
+            if (used + sizeof(E) > queue.size())
+                queue.resize(std::max(queue.size() * 2, used + sizeof(E) * 64));
+            std::memcpy(queue.data() + used, &event, sizeof(E));
+            used += sizeof(E);
+        }
+
+        /// Deliver everything queued since the last Flush(). Called once per frame by SystemManager.
+        void Flush();
+
+        struct FlushStats
+        {
+            std::size_t events = 0;
+            double      ms = 0.0;
+        };
+        const FlushStats& LastFlush() const { return lastFlush; }
+
+        /// Result of RunBenchmark(); times are per frame.
+        struct BenchmarkResult
+        {
+            std::size_t eventsPerFrame = 0;
+            std::size_t subscribers = 0;
+            int         frames = 0;
+            double      publishMs = 0.0;        ///< Immediate Publish()
+            double      queuedMs = 0.0;         ///< Enqueue() + Flush()
+            double      legacyMs = 0.0;         ///< MessageBus (std::function, no payload)
+            std::size_t steadyGrowthBytes = 0;  ///< Queue growth after warm-up; 0 = no allocation
+        };
+
+        /*************************************************************************************
+          \brief Time \a eventsPerFrame events per frame on a private bus with \a subscribers
+                 handlers, delivered immediately, through the queues, and through the old
+                 MessageBus for comparison.
+        *************************************************************************************/
+        static BenchmarkResult RunBenchmark(std::size_t eventsPerFrame, int frames, std::size_t subscribers);
+
+        /// Number of live subscribers for E.
+        template <typename E>
+        std::size_t SubscriberCount() const
+        {
+            const std::size_t type = TypeIndex<E>();
+            return type < channels.size() ? channels[type].live : 0;
+        }
+
+    private:
+        using Thunk = void (*)(void* context, const void* event);
+
+        struct Subscriber
+        {
+            SubscriptionId id = 0;      ///< 0 once unsubscribed
+            void*          context = nullptr;
+            Thunk          invoke = nullptr;
+        };
+
+        struct Channel
+        {
+            std::vector<Subscriber> subscribers;
+            std::size_t live = 0;
+            bool        hasGaps = false;
+            std::size_t eventSize = 0;               ///< sizeof(E), set by Enqueue
+            std::vector<std::byte> queues[2];        ///< Packed events, double-buffered; only grow
+            std::size_t queued[2] = {};              ///< Bytes in use in each queue
+            int         writeQueue = 0;
+        };
+
+        /// Dense index per event type, assigned on first use.
+        template <typename E>
+        static std::size_t TypeIndex()
+        {
+            static const std::size_t index = NextTypeIndex();
+            return index;
+        }
+        static std::size_t NextTypeIndex();
+
+        Channel& ChannelFor(std::size_t type);
+        SubscriptionId Add(std::size_t type, void* context, Thunk invoke);
+        void Dispatch(std::size_t type, const void* event);
+        void Compact();
+
+        std::vector<Channel> channels;
+        SubscriptionId       nextId = 1;
+        int                  dispatchDepth = 0;
+        bool                 compactPending = false;   ///< Some channel has gaps
+        FlushStats           lastFlush;
+    };
+}
@@ -0,0 +1,69 @@
+/*********************************************************************************************
+ \file      GameplayEvents.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Gameplay events queued on EventBus::Instance() by the combat, health, gate,
+            physics and animation code, and consumed by audio, VFX and the camera.
+ \details   Publishers call EventBus::Instance().Enqueue(), so handlers run in the flush at
+            the end of SystemManager::UpdateAll() rather than in the middle of a system's
+            update. Objects are referred to by id because an object can be destroyed
+            between the enqueue and the flush; handlers look it up with
+            FACTORY->GetObjectWithId() and skip the event if it is gone. Positions are
+            copied into the event for the same reason.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+namespace Framework
+{
+    /// A hitbox connected. \a lethal is true when the hit took the target's health to 0.
+    struct HitLandedEvent
+    {
+        enum class Target { Player, Enemy };
+
+        unsigned int attacker;
+        unsigned int target;
+        Target       kind;
+        bool         lethal;
+        float        x;          ///< Target position at the time of the hit
+        float        y;
+        float        damage;
+    };
+
+    /// First frame of an enemy's death.
+    struct EnemyDiedEvent
+    {
+        unsigned int id;
+        bool         hasPosition;
+        float        x;
+        float        y;
+    };
+
+    /// First frame of the player's death, raised when the death was not caused by a hit.
+    struct PlayerDiedEvent
+    {
+        unsigned int id;
+    };
+
+    /// The level's gates unlocked because every enemy is dead.
+    struct GateOpenedEvent
+    {
+        int gateCount;
+    };
+
+    /// A non-looping sprite-sheet clip reached its last frame (sent once per play).
+    struct AnimationFinishedEvent
+    {
+        unsigned int id;
+        int          animation;   ///< Index into SpriteAnimationComponent::animations
+    };
+
+    /// The player entered a camera zoom trigger.
+    struct ZoomTriggeredEvent
+    {
+        unsigned int trigger;
+        float        viewHeight;
+    };
+}
@@ -1,4 +1,5 @@
 #include "Asset_Manager.h"
+#include "Core/PathUtils.h"
 /*********************************************************************************
 *\file    Asset_Manager.cpp
  \par       SofaSpuds
@@ -31,6 +32,7 @@ std::filesystem::path AssetManager::ProjectRoot()
 		{
 			// Found the root - change working directory to it
 			std::filesystem::current_path(path);
+			Framework::InvalidatePathCache(); // cwd moved; rediscover asset roots
 			cachedRoot = path;
 			initialized = true;
 			return path;
@@ -13,11 +13,104 @@
 *********************************************************************************************/
 
 #include "Resource_Manager.h"
+#include "StartupPreloader.h"
+#include "Component/SpriteComponent.h"
+#include "Component/RenderComponent.h"
+#include "Component/SpriteAnimationComponent.h"
+#include "Core/SimulationThread.h"
+#include <mutex>
+#include <stdexcept>
+#include <vector>
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
 #ifdef _DEBUG
 #define new DBG_NEW       // <- redefine new AFTER all includes
 #endif
+
+namespace
+{
+    /// Textures touched within this many frames are skipped by budget trimming so that
+    /// ambient lookups (backgrounds, particles) do not thrash between evict and reload.
+    constexpr std::uint64_t kMinIdleFramesBeforeEvict = 2;
+
+    std::size_t textureBudgetBytes = 256ull * 1024ull * 1024ull;
+    std::uint64_t frameCounter = 0;
+    std::size_t lastTrimAttemptBytes = 0;   ///< residentBytes after the last trim attempt
+    Resource_Manager::MemoryReport stats{};
+
+    /// Texture work requested from the simulation thread, replayed by BeginFrame().
+    struct DeferredLoad
+    {
+        std::string id;
+        std::string path;
+    };
+    std::vector<DeferredLoad> deferredLoads;
+    bool deferredEvict = false;
+    std::string deferredLevelReport;
+
+    std::recursive_mutex& ManagerMutex()
+    {
+        static std::recursive_mutex mutex;
+        return mutex;
+    }
+
+    /// GL calls must stay on the thread that owns the context.
+    bool OffGlThread()
+    {
+        return Framework::SimulationThread::IsSimulationThread();
+    }
+
+    /*************************************************************************************
+      \brief Measure the GPU footprint of a texture entry from its live GL handle.
+      \param res Texture entry; bytes, rgba8Bytes and compressed are overwritten.
+      \note  Covers the base level plus the mip chain. Uncompressed levels count 4 bytes
+             per texel (drivers pad RGB8 to RGBA8 in practice).
+    *************************************************************************************/
+    void MeasureTexture(Resource_Manager::Resources& res)
+    {
+        gfx::Graphics::TextureFootprint footprint;
+        gfx::Graphics::getTextureFootprint(res.handle, footprint);
+        res.bytes = footprint.bytes;
+        res.rgba8Bytes = footprint.rgba8Bytes;
+        res.compressed = footprint.compressed;
+    }
+
+    /*************************************************************************************
+      \brief Add one reference to a texture key if it is known to the manager.
+    *************************************************************************************/
+    void AddTextureRef(std::unordered_map<std::string, Resource_Manager::Resources>& map,
+        const std::string& key)
+    {
+        if (key.empty())
+            return;
+        auto it = map.find(key);
+        if (it != map.end() && it->second.type == Resource_Manager::Graphics)
+            ++it->second.refCount;
+    }
+
+    /*************************************************************************************
+      \brief Add the texture references held by one object's sprite components.
+    *************************************************************************************/
+    void AddObjectTextureRefs(std::unordered_map<std::string, Resource_Manager::Resources>& map,
+        Framework::GOC& obj)
+    {
+        using namespace Framework;
+        if (auto* sprite = obj.GetComponentType<SpriteComponent>(ComponentTypeId::CT_SpriteComponent))
+            AddTextureRef(map, sprite->texture_key);
+
+        if (auto* rc = obj.GetComponentType<RenderComponent>(ComponentTypeId::CT_RenderComponent))
+            AddTextureRef(map, rc->texture_key);
+
+        if (auto* anim = obj.GetComponentType<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent))
+        {
+            for (const auto& sheet : anim->animations)
+                AddTextureRef(map, sheet.textureKey.empty() ? sheet.name : sheet.textureKey);
+            for (const auto& frame : anim->frames)
+                AddTextureRef(map, frame.texture_key);
+        }
+    }
+}
+
 /*****************************************************************************************
  \brief Load a resource into memory using an asset file path.
  \param assetPath  Filesystem path to the asset to be loaded.
@@ -60,14 +153,58 @@ bool Resource_Manager::isSound(const std::string& ext)
      \brief Retrieve the handle of a texture resource by its unique key.
     \param key  Resource identifier.
     \return Handle of the texture, or 0 if not found.
+    \note  Marks the texture as used this frame. If the texture was evicted it is
+           reloaded from its recorded path before returning.
 *****************************************************************************************/
 unsigned int Resource_Manager::getTexture(const std::string& key)
 {
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
     auto it = resources_map.find(key);
-    if (it != resources_map.end() && it->second.type == Resource_Type::Graphics) {
-        return it->second.handle;
+    if (it == resources_map.end() || it->second.type != Resource_Type::Graphics)
+        return 0; // Not found
+    return TouchTexture(it->second);
+}
+
+/*****************************************************************************************
+     \brief Retrieve a texture handle by interned key (see InternedString::id()).
+    \param key  Interned resource identifier.
+    \return Handle of the texture, or 0 if not found.
+*****************************************************************************************/
+unsigned int Resource_Manager::getTexture(Framework::StringId key)
+{
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
+    auto it = resources_by_id.find(key);
+    if (it == resources_by_id.end() || it->second->type != Resource_Type::Graphics)
+        return 0;
+    return TouchTexture(*it->second);
+}
+
+/*****************************************************************************************
+     \brief Mark a texture as used this frame, reloading it first if it was evicted.
+    \param res  Texture entry.
+    \return GL handle, or 0 if the reload failed or has to wait for the main thread.
+*****************************************************************************************/
+unsigned int Resource_Manager::TouchTexture(Resources& res)
+{
+    res.lastUsedFrame = frameCounter;
+    if (res.handle == 0 && !res.path.empty() && !OffGlThread())
+    {
+        try
+        {
+            res.handle = gfx::Graphics::loadTexture(res.path.c_str());
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "[Resource_Manager] Reload failed for " << res.id << ": " << e.what() << std::endl;
+            res.path.clear(); // do not retry every frame
+            return 0;
+        }
+        MeasureTexture(res);
+        stats.residentBytes += res.bytes;
+        stats.peakResidentBytes = std::max(stats.peakResidentBytes, stats.residentBytes);
+        ++stats.reloadsTotal;
     }
-    return 0; // Not found
+    return res.handle;
 }
 
 
@@ -81,9 +218,17 @@ namespace fs = std::filesystem;
 *****************************************************************************************/
 bool Resource_Manager::load(const std::string& id, const std::string& path)
 {
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
     auto existing = resources_map.find(id);
     if (existing != resources_map.end())
     {
+        // Evicted textures come back through getTexture(), which reloads on demand.
+        if (existing->second.type == Resource_Type::Graphics && existing->second.handle == 0)
+        {
+            if (existing->second.path.empty())
+                existing->second.path = path;
+            return getTexture(id) != 0;
+        }
         return true;
     }
 
@@ -91,22 +236,43 @@ bool Resource_Manager::load(const std::string& id, const std::string& path)
     if (!fs::exists(filePath) || !fs::is_regular_file(filePath))
     {std::cerr << "[Resource_Manager] File not found: " << path << std::endl; return false;}
     std::string ext = GetExtension(path);
+    if (isTexture(ext) && OffGlThread())
+    {
+        // Uploaded by the next BeginFrame(); report "not loaded yet" like a failed lookup.
+        const bool queued = std::any_of(deferredLoads.begin(), deferredLoads.end(),
+            [&id](const DeferredLoad& pending) { return pending.id == id; });
+        if (!queued)
+            deferredLoads.push_back(DeferredLoad{ id, path });
+        return false;
+    }
     if (isTexture(ext))
     {
-        unsigned int texID = gfx::Graphics::loadTexture(path.c_str());
+        // During startup the pixels may already be decoded on a worker; only the upload is left.
+        unsigned int texID = Framework::StartupPreloader::UploadPreloadedTexture(path);
+        if (texID == 0)
+            texID = gfx::Graphics::loadTexture(path.c_str());
         if (texID != 0)
         {
-            resources_map[id] = { id, Resource_Type::Graphics, texID };
+            Resources res{ id, Resource_Type::Graphics, texID };
+            res.path = path;
+            MeasureTexture(res);
+            res.lastUsedFrame = frameCounter;
+            stats.residentBytes += res.bytes;
+            stats.peakResidentBytes = std::max(stats.peakResidentBytes, stats.residentBytes);
+            Resources& stored = resources_map[id] = std::move(res);
+            resources_by_id[Framework::StringId::Intern(id)] = &stored;
             return true;
         }
         return false;
     }
     else if (isSound(ext))
     {
+        Framework::StartupPreloader::WaitForSound(path);
         bool success = SoundManager::getInstance().loadSound(id, path);
         if (success)
         {
-            resources_map[id] = { id, Resource_Type::Sound ,0 };
+            Resources& stored = resources_map[id] = { id, Resource_Type::Sound ,0 };
+            resources_by_id[Framework::StringId::Intern(id)] = &stored;
             return true;
         }
         else
@@ -133,6 +299,7 @@ bool Resource_Manager::load(const std::string& id, const std::string& path)
 *****************************************************************************************/
 void Resource_Manager::loadAll(const std::string& directory)
 {
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
     for (auto& entry : fs::recursive_directory_iterator(directory))
     {
         if (!entry.is_regular_file()) continue;
@@ -152,15 +319,24 @@ void Resource_Manager::loadAll(const std::string& directory)
 }
 
 
+/*****************************************************************************************
+     \brief Unload a single resource and forget it entirely (no reload on next lookup).
+    \param id  Resource identifier.
+*****************************************************************************************/
 void Resource_Manager::Unload(const std::string& id)
 {
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
     auto it = resources_map.find(id);
     if (it == resources_map.end())return;
     Resources& res = it->second;
     if (res.type == Resource_Type::Graphics && res.handle != 0)
-    {gfx::Graphics::destroyTexture(res.handle);}
+    {
+        gfx::Graphics::destroyTexture(res.handle);
+        stats.residentBytes -= std::min(stats.residentBytes, res.bytes);
+    }
     else if (res.type == Resource_Type::Sound)
     {SoundManager::getInstance().unloadSound(id);}
+    resources_by_id.erase(Framework::StringId(id));
     resources_map.erase(it);
 }
 
@@ -170,6 +346,7 @@ void Resource_Manager::Unload(const std::string& id)
 *****************************************************************************************/
 void Resource_Manager::unloadAll(Resource_Type type)
 {
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
     std::cout << "[Resource_Manager] Unloading resources of type: "
         << (type == Resource_Type::All ? "All"
             : (type == Resource_Type::Sound ? "Sound" : "Graphics"))
@@ -202,9 +379,285 @@ void Resource_Manager::unloadAll(Resource_Type type)
                 gfx::Graphics::destroyTexture(res.handle);
             }
             std::cout << "[Resource_Manager] Removing resource: " << it->first << std::endl;
+            resources_by_id.erase(Framework::StringId(it->first));
             it = resources_map.erase(it); // erase and move forward
         }
         else {++it;}
     }
+
+    stats.residentBytes = 0;
+    for (const auto& [key, res] : resources_map)
+    {
+        (void)key;
+        if (res.type == Resource_Type::Graphics && res.handle != 0)
+            stats.residentBytes += res.bytes;
+    }
     std::cout << "[Resource_Manager] UnloadAll finished." << std::endl;
+}
+
+/*****************************************************************************************
+     \brief Advance the LRU frame clock and trim textures if the budget is exceeded.
+    \note  Called once per frame by the RenderSystem before any texture lookups (after the
+           simulation thread has synced, in pipelined frames). A trim that cannot free
+           anything is not retried until the resident size changes. Texture work the
+           simulation thread deferred is done here first.
+*****************************************************************************************/
+void Resource_Manager::BeginFrame()
+{
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
+    ++frameCounter;
+
+    if (!deferredLoads.empty())
+    {
+        std::vector<DeferredLoad> pending;
+        pending.swap(deferredLoads);
+        for (const DeferredLoad& request : pending)
+            load(request.id, request.path);
+    }
+    if (deferredEvict)
+    {
+        deferredEvict = false;
+        EvictUnreferenced();
+    }
+    if (!deferredLevelReport.empty())
+    {
+        const std::string levelName = std::move(deferredLevelReport);
+        deferredLevelReport.clear();
+        ReportLevelTextures(levelName);
+    }
+
+    if (stats.residentBytes > textureBudgetBytes && stats.residentBytes != lastTrimAttemptBytes)
+    {
+        TrimToBudget();
+        lastTrimAttemptBytes = stats.residentBytes;
+    }
+}
+
+/*****************************************************************************************
+     \brief Set the texture memory budget in bytes (0 disables budget trimming).
+*****************************************************************************************/
+void Resource_Manager::SetTextureBudget(std::size_t bytes)
+{
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
+    textureBudgetBytes = bytes ? bytes : static_cast<std::size_t>(-1);
+    lastTrimAttemptBytes = 0;
+}
+
+/*****************************************************************************************
+     \brief Get the texture memory budget in bytes.
+*****************************************************************************************/
+std::size_t Resource_Manager::GetTextureBudget()
+{
+    return textureBudgetBytes;
+}
+
+/*****************************************************************************************
+     \brief Mark a texture as pinned so it is never evicted.
+    \param id      Resource identifier.
+    \param pinned  true to pin, false to make it evictable again.
+    \note  Systems that cache a raw GL handle outside of components must pin it, since
+           an evicted handle may later be reused by the driver for another texture.
+*****************************************************************************************/
+void Resource_Manager::Pin(const std::string& id, bool pinned)
+{
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
+    auto it = resources_map.find(id);
+    if (it != resources_map.end())
+        it->second.pinned = pinned;
+}
+
+/*****************************************************************************************
+     \brief Rebuild texture reference counts from live components.
+    \details Counts Sprite/Render texture_key plus every sprite-sheet and legacy frame key
+             of SpriteAnimation components owned by the factory. Prefab templates are not
+             counted: clones re-resolve their textures by key (see the components' Clone()),
+             so a template's textures can be evicted with the level that used them.
+*****************************************************************************************/
+void Resource_Manager::RecountReferences()
+{
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
+    for (auto& [key, res] : resources_map)
+    {
+        (void)key;
+        res.refCount = 0;
+    }
+
+    using namespace Framework;
+    if (!FACTORY)
+        return;
+
+    for (auto& [id, objPtr] : FACTORY->Objects())
+    {
+        (void)id;
+        if (GOC* obj = objPtr.get())
+            AddObjectTextureRefs(resources_map, *obj);
+    }
+}
+
+/*****************************************************************************************
+     \brief Release one texture's GL handle if it is resident, unpinned and unreferenced.
+    \param res  Entry to evict; it stays in the map so it can be reloaded later.
+    \return true if the texture was evicted.
+*****************************************************************************************/
+bool Resource_Manager::EvictTexture(Resources& res)
+{
+    if (res.type != Resource_Type::Graphics || res.handle == 0 || res.pinned || res.refCount > 0)
+        return false;
+    if (res.path.empty())
+        return false; // cannot be reloaded, keep it
+
+    gfx::Graphics::destroyTexture(res.handle);
+    res.handle = 0;
+    stats.residentBytes -= std::min(stats.residentBytes, res.bytes);
+    stats.bytesEvictedTotal += res.bytes;
+    ++stats.evictionsTotal;
+    return true;
+}
+
+/*****************************************************************************************
+     \brief Evict idle, unreferenced textures oldest-first until residency <= targetBytes.
+    \return Number of textures evicted.
+*****************************************************************************************/
+unsigned Resource_Manager::EvictLeastRecentlyUsed(std::size_t targetBytes)
+{
+    std::vector<Resources*> candidates;
+    for (auto& [key, res] : resources_map)
+    {
+        (void)key;
+        if (res.type != Resource_Type::Graphics || res.handle == 0 || res.pinned || res.refCount > 0)
+            continue;
+        if (res.lastUsedFrame + kMinIdleFramesBeforeEvict > frameCounter)
+            continue;
+        candidates.push_back(&res);
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+        [](const Resources* a, const Resources* b) { return a->lastUsedFrame < b->lastUsedFrame; });
+
+    unsigned evicted = 0;
+    for (Resources* res : candidates)
+    {
+        if (stats.residentBytes <= targetBytes)
+            break;
+        if (EvictTexture(*res))
+            ++evicted;
+    }
+    return evicted;
+}
+
+/*****************************************************************************************
+     \brief Evict every unreferenced, unpinned texture regardless of budget.
+    \return Number of textures evicted.
+    \note  Intended for level transitions, after the new level has been created so its
+           components already hold references to the textures they need. Called on the
+           simulation thread, it only schedules the eviction for BeginFrame() and returns 0.
+*****************************************************************************************/
+unsigned Resource_Manager::EvictUnreferenced()
+{
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
+    if (OffGlThread())
+    {
+        deferredEvict = true;
+        return 0;
+    }
+    RecountReferences();
+
+    const std::size_t before = stats.residentBytes;
+    unsigned evicted = 0;
+    for (auto& [key, res] : resources_map)
+    {
+        (void)key;
+        if (EvictTexture(res))
+            ++evicted;
+    }
+
+    if (evicted > 0)
+    {
+        std::cout << "[Resource_Manager] Evicted " << evicted << " unreferenced textures ("
+            << (before - stats.residentBytes) / (1024 * 1024) << " MB)" << std::endl;
+    }
+    return evicted;
+}
+
+/*****************************************************************************************
+     \brief Evict least-recently-used textures until the resident size fits the budget.
+    \return Number of textures evicted.
+*****************************************************************************************/
+unsigned Resource_Manager::TrimToBudget()
+{
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
+    if (OffGlThread())
+        return 0;   // BeginFrame() trims on the main thread
+    if (stats.residentBytes <= textureBudgetBytes)
+        return 0;
+
+    RecountReferences();
+    const unsigned evicted = EvictLeastRecentlyUsed(textureBudgetBytes);
+    if (stats.residentBytes > textureBudgetBytes)
+    {
+        std::cerr << "[Resource_Manager] Texture budget exceeded: "
+            << stats.residentBytes / (1024 * 1024) << " MB resident, "
+            << textureBudgetBytes / (1024 * 1024) << " MB budget (remaining textures are in use)"
+            << std::endl;
+    }
+    return evicted;
+}
+
+/*****************************************************************************************
+     \brief Build a snapshot of texture residency for the performance overlay.
+*****************************************************************************************/
+Resource_Manager::MemoryReport Resource_Manager::GetMemoryReport()
+{
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
+    MemoryReport report = stats;
+    report.budgetBytes = textureBudgetBytes;
+    report.residentTextures = 0;
+    report.evictedTextures = 0;
+    report.referencedTextures = 0;
+    report.pinnedTextures = 0;
+    report.rgba8ResidentBytes = 0;
+    report.compressedTextures = 0;
+
+    for (const auto& [key, res] : resources_map)
+    {
+        (void)key;
+        if (res.type != Resource_Type::Graphics)
+            continue;
+        if (res.handle == 0)
+        {
+            ++report.evictedTextures;
+            continue;
+        }
+        ++report.residentTextures;
+        if (res.refCount > 0) ++report.referencedTextures;
+        if (res.pinned) ++report.pinnedTextures;
+        if (res.compressed) ++report.compressedTextures;
+        report.rgba8ResidentBytes += res.rgba8Bytes;
+    }
+    return report;
+}
+
+/*****************************************************************************************
+     \brief Record and log the resident texture footprint of a freshly loaded level.
+    \param levelName  Display name of the level.
+    \note  Call after EvictUnreferenced() so only the level's own and pinned textures count.
+*****************************************************************************************/
+void Resource_Manager::ReportLevelTextures(const std::string& levelName)
+{
+    std::lock_guard<std::recursive_mutex> lock(ManagerMutex());
+    if (OffGlThread())
+    {
+        deferredLevelReport = levelName;    // after the deferred eviction it follows
+        return;
+    }
+    const MemoryReport report = GetMemoryReport();
+    const std::size_t saved = report.rgba8ResidentBytes - std::min(report.rgba8ResidentBytes, report.residentBytes);
+    stats.levelName = levelName;
+    stats.levelResidentBytes = report.residentBytes;
+    stats.levelSavedBytes = saved;
+
+    std::cout << "[Resource_Manager] Level '" << levelName << "' textures: "
+        << report.residentTextures << " resident (" << report.compressedTextures << " compressed), "
+        << report.residentBytes / (1024 * 1024) << " MB VRAM, "
+        << saved / (1024 * 1024) << " MB saved vs RGBA8" << std::endl;
 }
\ No newline at end of file
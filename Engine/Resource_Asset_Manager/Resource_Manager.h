@@ -8,6 +8,24 @@
             graphics, and sounds. Also includes utility functions for file extension checks 
             and type validation.
 
+ \details   Textures are budgeted: every texture records its estimated GPU footprint, the
+            last frame it was looked up, and how many live Sprite/Render/SpriteAnimation
+            components reference its key. When the resident total exceeds the configured
+            budget (or on level transitions) unreferenced, unpinned textures are evicted in
+            least-recently-used order. Evicted entries keep their source path, so a later
+            getTexture() on the same key transparently reloads them.
+
+            Footprints are measured from the GL texture itself, so textures uploaded from
+            cooked BC7 files (see gfx::TextureCooker) count at their compressed size and the
+            report shows how much VRAM compression saved for the current level.
+
+            The manager may be called from the pipelined simulation thread (see
+            Framework::SimulationThread). A recursive mutex guards the maps. GL work asked for
+            on that thread is deferred to the next BeginFrame() on the main thread. That
+            covers new texture loads, reloads of evicted textures, and level-transition
+            eviction and reporting. Until then getTexture() returns 0, which callers already
+            treat as "not loaded yet".
+
  \copyright
             All content © 2025 DigiPen Institute of Technology Singapore.
             All rights reserved.
@@ -20,10 +38,14 @@
 #include "Common/System.h"
 #include "Factory/Factory.h"
 #include "Component/AudioComponent.h"
+#include "Common/StringId.h"
 #include <string>
 #include <filesystem>
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <unordered_map>
 /*****************************************************************************************
   \class Resource_Manager
   \brief Provides centralized management of game resources such as textures, fonts, 
@@ -56,13 +78,47 @@ public:
   - type   : The type of resource (Texture, Font, Graphics, or Sound).  
   - handle : A numeric handle or pointer referring to the actual loaded resource 
              in memory or the graphics/audio system.
+
+  Texture entries additionally carry budget bookkeeping (path, bytes, refCount,
+  lastUsedFrame, pinned). An evicted texture keeps its entry with handle == 0.
   *****************************************************************************************/
     struct Resources 
     { 
         std::string id{}; ///Unique identifier for the resource
         Resource_Type type{ Resource_Type::All }; /// Type of the resource
         unsigned int handle{};  ///Handle or pointer to the actual resource
+        std::string path{};                ///Source file, used to reload after eviction
+        std::size_t bytes{};               ///GPU bytes (base level + mip chain, compressed size if cooked)
+        std::size_t rgba8Bytes{};          ///What the same levels would cost uncompressed
+        bool compressed{ false };          ///Uploaded from a BC7 cooked file
+        unsigned refCount{};               ///Live components referencing this key
+        std::uint64_t lastUsedFrame{};     ///Frame of the most recent lookup (LRU key)
+        bool pinned{ false };              ///Never evicted (handle cached outside components)
+    };
+
+  /*****************************************************************************************
+  \struct MemoryReport
+  \brief Snapshot of texture residency used by the performance overlay.
+  *****************************************************************************************/
+    struct MemoryReport
+    {
+        std::size_t residentBytes{};       ///Bytes of textures currently on the GPU
+        std::size_t budgetBytes{};         ///Configured texture budget
+        std::size_t peakResidentBytes{};   ///High-water mark of residentBytes
+        unsigned residentTextures{};       ///Textures with a live GL handle
+        unsigned evictedTextures{};        ///Known textures that are currently evicted
+        unsigned referencedTextures{};     ///Resident textures with refCount > 0
+        unsigned pinnedTextures{};         ///Resident textures that cannot be evicted
+        std::uint64_t evictionsTotal{};    ///Evictions since startup
+        std::uint64_t reloadsTotal{};      ///Transparent reloads of evicted textures
+        std::size_t bytesEvictedTotal{};   ///Bytes released by eviction since startup
+        std::size_t rgba8ResidentBytes{};  ///RGBA8 cost of the resident set (saved = this - residentBytes)
+        unsigned compressedTextures{};     ///Resident textures stored compressed
+        std::string levelName{};           ///Level recorded by the last ReportLevelTextures()
+        std::size_t levelResidentBytes{};  ///Resident bytes right after that level loaded
+        std::size_t levelSavedBytes{};     ///VRAM that level saved through compression
     };
+
     static bool load(const std::string& name, const std::string& path);
     static void loadAll(const std::string& directory);
     static void unloadAll(Resource_Type type); 
@@ -74,4 +130,25 @@ public:
     static bool isTexture(const std::string& ext);
     static bool isSound(const std::string& ext);
     static unsigned int getTexture(const std::string& key);
+    /// Same as getTexture(key) but keyed by the interned id (no string hashing per call).
+    static unsigned int getTexture(Framework::StringId key);
+
+    // Texture budget / LRU eviction
+    static void BeginFrame();
+    static void SetTextureBudget(std::size_t bytes);
+    static std::size_t GetTextureBudget();
+    static void Pin(const std::string& id, bool pinned = true);
+    static void RecountReferences();
+    static unsigned EvictUnreferenced();
+    static unsigned TrimToBudget();
+    static MemoryReport GetMemoryReport();
+    static void ReportLevelTextures(const std::string& levelName);
+
+private:
+    /// Secondary index of resources_map by interned key; nodes are stable until erased.
+    static inline std::unordered_map<Framework::StringId, Resources*> resources_by_id;
+
+    static unsigned int TouchTexture(Resources& res);
+    static bool EvictTexture(Resources& res);
+    static unsigned EvictLeastRecentlyUsed(std::size_t targetBytes);
 };
@@ -0,0 +1,323 @@
+/*********************************************************************************************
+ \file      StartupPreloader.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements StartupPreloader: builds the startup TaskGraph from the asset folders
+            and hands finished results to the main-thread loaders.
+ \details   Each preloaded file owns one slot. The slot tables are fully built before the
+            graph starts and never change shape afterwards; a slot is written only by its
+            own task and read only after TaskGraph::Wait() on that task, so the tables need
+            no lock of their own.
+
+            Ids follow Resource_Manager::loadAll (file stem up to the first '-', '_' or '.'),
+            and only the first file per id is preloaded, matching loadAll's "first one wins"
+            behaviour so parallel loading cannot change which sound ends up under an id.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "StartupPreloader.h"
+#include "Resource_Manager.h"
+#include "Core/PathUtils.h"
+#include "Core/TaskGraph.h"
+#include "Audio/SoundManager.h"
+#include "Graphics/Graphics.hpp"
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <system_error>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        namespace fs = std::filesystem;
+        using Clock = TaskGraph::Clock;
+
+        struct TextureSlot
+        {
+            TaskGraph::TaskId                 task = 0;
+            gfx::Graphics::DecodedImage       image{};
+            gfx::TextureCooker::CookedTexture cooked{};   ///< Used instead of image when cooked
+            bool                              taken = false;
+        };
+
+        struct SoundSlot
+        {
+            TaskGraph::TaskId task = 0;
+        };
+
+        struct JsonSlot
+        {
+            TaskGraph::TaskId task = 0;
+            nlohmann::json    document{};
+            bool              taken = false;
+        };
+
+        std::unique_ptr<TaskGraph> gGraph;
+        bool gActive = false;   ///< Between Begin() and Finish()
+        Clock::time_point gBeginTime{};
+        StartupPreloader::Report gReport{};
+
+        std::unordered_map<std::string, TextureSlot> gTextures;
+        std::unordered_map<std::string, SoundSlot>   gSounds;
+        std::unordered_map<std::string, JsonSlot>    gJson;
+
+        /*************************************************************************************
+          \brief Key used to match a loader's path with the path the preloader scanned.
+        *************************************************************************************/
+        std::string SlotKey(const fs::path& path)
+        {
+            return path.lexically_normal().generic_string();
+        }
+
+        std::string LowerExtension(const fs::path& path)
+        {
+            std::string ext = path.extension().string();
+            if (!ext.empty() && ext[0] == '.')
+                ext.erase(0, 1);
+            for (char& c : ext)
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            return ext;
+        }
+
+        /// Same id rule as Resource_Manager::loadAll.
+        std::string ResourceIdFromPath(const fs::path& path)
+        {
+            const std::string stem = path.stem().string();
+            const std::size_t pos = stem.find_first_of("-_.");
+            return (pos == std::string::npos) ? stem : stem.substr(0, pos);
+        }
+
+        /*************************************************************************************
+          \brief Collect regular files under \a directory in iteration order.
+        *************************************************************************************/
+        std::vector<fs::path> ListFiles(const fs::path& directory)
+        {
+            std::vector<fs::path> files;
+            std::error_code ec;
+            if (!fs::exists(directory, ec))
+                return files;
+            for (auto it = fs::recursive_directory_iterator(directory, ec);
+                !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+            {
+                if (it->is_regular_file(ec))
+                    files.push_back(it->path());
+            }
+            return files;
+        }
+
+        void ScheduleTextures(TaskGraph& graph)
+        {
+            std::unordered_set<std::string> ids;
+            for (const fs::path& file : ListFiles(ResolveAssetPath("Textures")))
+            {
+                if (!Resource_Manager::isTexture(LowerExtension(file)))
+                    continue;
+                if (!ids.insert(ResourceIdFromPath(file)).second)
+                    continue;
+
+                const std::string key = SlotKey(file);
+                if (gTextures.count(key))
+                    continue;
+
+                TextureSlot& slot = gTextures[key];
+                const std::string path = file.string();
+                slot.task = graph.Add(file.filename().string(), "texture_decode",
+                    [&slot, path]
+                    {
+                        if (!gfx::TextureCooker::loadCooked(path, slot.cooked))
+                            slot.image = gfx::Graphics::decodeTexture(path.c_str());
+                    });
+            }
+        }
+
+        void ScheduleSounds(TaskGraph& graph)
+        {
+            std::unordered_set<std::string> ids;
+            for (const fs::path& file : ListFiles(ResolveAssetPath("Audio")))
+            {
+                if (!Resource_Manager::isSound(LowerExtension(file)))
+                    continue;
+                std::string id = ResourceIdFromPath(file);
+                if (!ids.insert(id).second)
+                    continue;
+
+                const std::string key = SlotKey(file);
+                if (gSounds.count(key))
+                    continue;
+
+                const std::string path = file.string();
+                gSounds[key].task = graph.Add(file.filename().string(), "sound_open",
+                    [id = std::move(id), path] { SoundManager::getInstance().loadSound(id, path); });
+            }
+        }
+
+        void ScheduleJson(TaskGraph& graph)
+        {
+            for (const fs::path& file : ListFiles(ResolveDataPath("Prefabs")))
+            {
+                if (file.extension() != ".json")
+                    continue;
+
+                const std::string key = SlotKey(file);
+                if (gJson.count(key))
+                    continue;
+
+                JsonSlot& slot = gJson[key];
+                const std::string path = file.string();
+                slot.task = graph.Add(file.filename().string(), "prefab_parse",
+                    [&slot, path]
+                    {
+                        std::ifstream in(path);
+                        if (!in.is_open())
+                            return;
+                        // Leave the document null on malformed input; PrefabManager skips it.
+                        slot.document = nlohmann::json::parse(in, nullptr, false);
+                        if (slot.document.is_discarded())
+                            slot.document = nullptr;
+                    });
+            }
+        }
+    } // anonymous namespace
+
+    void StartupPreloader::Begin()
+    {
+        if (gGraph)
+            return;
+
+        gBeginTime = Clock::now();
+        gGraph = std::make_unique<TaskGraph>();
+        gReport = {};
+
+        // Sounds can only be opened once FMOD is up; AudioSystem::Initialize() later finds
+        // the manager already running and keeps it.
+        const bool audioReady = SoundManager::getInstance().initialize();
+
+        ScheduleTextures(*gGraph);
+        if (audioReady)
+            ScheduleSounds(*gGraph);
+        ScheduleJson(*gGraph);
+
+        gReport.started = true;
+        gReport.textureTasks = gTextures.size();
+        gReport.soundTasks = gSounds.size();
+        gReport.jsonTasks = gJson.size();
+
+        gGraph->Start();
+        gReport.workers = gGraph->WorkerCount();
+        gActive = true;
+
+        std::cout << "[StartupPreloader] " << gGraph->TaskCount() << " tasks on "
+            << gReport.workers << " workers (" << gReport.textureTasks << " textures, "
+            << gReport.soundTasks << " sounds, " << gReport.jsonTasks << " prefab files)\n";
+    }
+
+    void StartupPreloader::Finish()
+    {
+        if (!gActive)
+            return;
+
+        gGraph->WaitAll();
+        gActive = false;
+
+        for (const auto& kv : gTextures)
+            gReport.unclaimed += kv.second.taken ? 0u : 1u;
+        for (const auto& kv : gJson)
+            gReport.unclaimed += kv.second.taken ? 0u : 1u;
+        gTextures.clear();
+        gSounds.clear();
+        gJson.clear();
+
+        gReport.finished = true;
+        gReport.wallMs = std::chrono::duration<double, std::milli>(Clock::now() - gBeginTime).count();
+        gReport.taskMs = 0.0;
+        for (const TaskGraph::TraceEvent& e : gGraph->Timeline())
+        {
+            if (e.category != "gl_upload")
+                gReport.taskMs += (e.endUs - e.startUs) / 1000.0;
+        }
+
+        std::cout << "[StartupPreloader] Done in " << gReport.wallMs << " ms wall, "
+            << gReport.taskMs << " ms of preload work, " << gReport.unclaimed
+            << " unclaimed results\n";
+    }
+
+    unsigned int StartupPreloader::UploadPreloadedTexture(const std::string& path)
+    {
+        if (!gActive)
+            return 0;
+
+        auto it = gTextures.find(SlotKey(path));
+        if (it == gTextures.end() || it->second.taken)
+            return 0;
+
+        TextureSlot& slot = it->second;
+        gGraph->Wait(slot.task);
+        slot.taken = true;
+
+        // Cooked in a format this driver cannot sample: the caller decodes the source instead.
+        if (!slot.cooked.mips.empty() && !gfx::Graphics::canUploadCooked(slot.cooked))
+        {
+            slot.cooked = {};
+            return 0;
+        }
+        // Decode failed: let the caller's synchronous path report it as before.
+        if (slot.cooked.mips.empty() && !slot.image.pixels)
+            return 0;
+
+        const Clock::time_point start = Clock::now();
+        const unsigned int handle = slot.cooked.mips.empty()
+            ? gfx::Graphics::uploadTexture(slot.image, path.c_str())
+            : gfx::Graphics::uploadCookedTexture(slot.cooked, path.c_str());
+        gGraph->RecordSpan(fs::path(path).filename().string(), "gl_upload", start, Clock::now());
+        slot.image = {};
+        slot.cooked = {};
+        return handle;
+    }
+
+    void StartupPreloader::WaitForSound(const std::string& path)
+    {
+        if (!gActive)
+            return;
+
+        auto it = gSounds.find(SlotKey(path));
+        if (it != gSounds.end())
+            gGraph->Wait(it->second.task);
+    }
+
+    std::optional<nlohmann::json> StartupPreloader::TakeJsonDocument(const std::filesystem::path& path)
+    {
+        if (!gActive)
+            return std::nullopt;
+
+        auto it = gJson.find(SlotKey(path));
+        if (it == gJson.end() || it->second.taken)
+            return std::nullopt;
+
+        gGraph->Wait(it->second.task);
+        it->second.taken = true;
+        return std::move(it->second.document);
+    }
+
+    StartupPreloader::Report StartupPreloader::GetReport()
+    {
+        return gReport;
+    }
+
+    bool StartupPreloader::DumpTrace(const std::filesystem::path& file)
+    {
+        if (!gGraph)
+            return false;
+        return gGraph->WriteChromeTrace(file);
+    }
+} // namespace Framework
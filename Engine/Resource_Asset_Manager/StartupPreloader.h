@@ -0,0 +1,96 @@
+/*********************************************************************************************
+ \file      StartupPreloader.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Declares StartupPreloader, which overlaps the CPU side of startup asset loading
+            (texture decode, sound opening, prefab JSON parsing) on worker threads.
+ \details   Begin() is called once before the systems initialize. It schedules one TaskGraph
+            task per asset file and returns immediately; the systems then initialize as
+            before. The existing load paths join only the asset they need, at the point they
+            need it:
+            - Resource_Manager::load() uploads a pre-decoded (or pre-read cooked) texture
+              (GL stays on the main thread) via UploadPreloadedTexture(), and waits for a
+              sound via WaitForSound().
+            - PrefabManager builds templates from TakeJsonDocument() instead of re-reading
+              and re-parsing each file.
+            Finish() joins whatever is left, drops unclaimed results and freezes the timeline,
+            which can be exported as a Chrome trace with DumpTrace().
+
+            Every entry point falls back to "not preloaded" when Begin() was never called,
+            so callers keep their synchronous path unchanged.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include "../ThirdParty/json_dep/json.hpp"
+
+namespace Framework
+{
+    /*****************************************************************************************
+      \class StartupPreloader
+      \brief Static facade over the startup TaskGraph; all functions are main-thread only.
+    *****************************************************************************************/
+    class StartupPreloader
+    {
+    public:
+        /*************************************************************************************
+          \struct Report
+          \brief  Summary shown in the performance overlay.
+        *************************************************************************************/
+        struct Report
+        {
+            bool        started = false;      ///< Begin() has run
+            bool        finished = false;     ///< Finish() has run
+            unsigned    workers = 0;          ///< Worker threads used
+            std::size_t textureTasks = 0;
+            std::size_t soundTasks = 0;
+            std::size_t jsonTasks = 0;
+            std::size_t unclaimed = 0;        ///< Preloaded results nobody asked for
+            double      wallMs = 0.0;         ///< Begin() -> Finish()
+            double      taskMs = 0.0;         ///< Sum of task durations (serial cost)
+        };
+
+        /*************************************************************************************
+          \brief Scan the asset folders, initialize audio, and start the worker tasks.
+        *************************************************************************************/
+        static void Begin();
+
+        /*************************************************************************************
+          \brief Join all remaining tasks and release unclaimed results.
+        *************************************************************************************/
+        static void Finish();
+
+        /*************************************************************************************
+          \brief Upload the texture decoded for \a path, waiting for its decode if needed.
+          \return GL handle, or 0 if \a path was not preloaded (caller loads it itself).
+          \throws std::runtime_error from the upload, like Graphics::loadTexture.
+        *************************************************************************************/
+        static unsigned int UploadPreloadedTexture(const std::string& path);
+
+        /*************************************************************************************
+          \brief Wait until the sound at \a path has been opened, if it was preloaded.
+        *************************************************************************************/
+        static void WaitForSound(const std::string& path);
+
+        /*************************************************************************************
+          \brief Take the parsed JSON for \a path, waiting for its parse if needed.
+          \return The document (null json if the file did not parse), or std::nullopt if the
+                  file was not preloaded.
+        *************************************************************************************/
+        static std::optional<nlohmann::json> TakeJsonDocument(const std::filesystem::path& path);
+
+        static Report GetReport();
+
+        /*************************************************************************************
+          \brief Write the startup timeline in Chrome trace format.
+          \return True if a timeline exists and the file was written.
+        *************************************************************************************/
+        static bool DumpTrace(const std::filesystem::path& file);
+    };
+} // namespace Framework
@@ -52,6 +52,20 @@ namespace Framework
         return true;
     }
 
+    /***************************************************************************************
+      \brief Takes ownership of a parsed document instead of reading it from disk.
+      \param document Parsed JSON; must be an object.
+      \return true if the document was adopted.
+    ***************************************************************************************/
+    bool JsonSerializer::OpenDocument(json document)
+    {
+        objectStack = {};
+        if (!document.is_object()) return false;
+        root = std::move(document);
+        objectStack.push(&root);
+        return true;
+    }
+
     /***************************************************************************************
       \brief Checks if the serializer is in a valid state.
       \return true if there is at least one object in the stack.
@@ -54,6 +54,13 @@ namespace Framework
         **************************************************************************************/
         bool Open(const std::string& file) override;
 
+        /*************************************************************************************
+          \brief  Adopts an already-parsed JSON document and initializes traversal state.
+          \param  document  Parsed document (moved in); lets callers parse off-thread.
+          \return True if the document is an object and can be navigated; false otherwise.
+        **************************************************************************************/
+        bool OpenDocument(json document);
+
         /*************************************************************************************
           \brief  Reports whether the serializer currently holds a parsed, navigable JSON.
           \return True if ready for use; false otherwise.
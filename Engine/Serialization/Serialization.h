@@ -18,6 +18,7 @@
 *********************************************************************************************/
 #pragma once
 #include <string>
+#include "Common/StringId.h"
 
 namespace Framework
 {
@@ -164,4 +165,13 @@ namespace Framework
     inline void StreamRead(ISerializer& stream, const std::string& key, bool& out) {
         stream.ReadBool(key, out);
     }
+
+    /*****************************************************************************************
+      \brief Helper to read an interned string by key; the id is refreshed on assignment.
+    *****************************************************************************************/
+    inline void StreamRead(ISerializer& stream, const std::string& key, InternedString& out) {
+        std::string value = out.str();
+        stream.ReadString(key, value);
+        out = std::move(value);
+    }
 }
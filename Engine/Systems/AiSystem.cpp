@@ -10,6 +10,13 @@
             decision trees. It interacts with the Factory to access all game objects,
             and with EnemyDecisionTreeComponent to run per-enemy AI logic.
 
+            The objects are scanned once per update into an AiBlackboard. AiLodScheduler
+            then picks the enemies due this tick: those near the player or on screen every
+            tick, the rest in budgeted round-robin slices. Chasers steer along a NavGrid
+            flow field that is shared by all of them. Due trees are run in fixed-size
+            batches, on JobSystem workers for large enemy counts, and the
+            attacks they request are spawned afterwards on the main thread.
+
             The system also provides initialization, optional debug drawing, and shutdown
             functionality.
 
@@ -19,7 +26,30 @@
 *********************************************************************************************/
 
 #include "AiSystem.h"
+#include "Core/FramePacing.h"
+#include "Core/JobSystem.h"
+#include "Debug/Profiler.h"
+#include "AI/DecisionTreeDefault.h"
+#include "AI/DecisionTreeLibrary.h"
+#include "Component/EnemyAttackComponent.h"
+#include "Component/EnemyTypeComponent.h"
+#include "Component/PlayerComponent.h"
+#include "Component/TransformComponent.h"
+#include "Systems/RenderSystem.h"
+#include "Core/PathUtils.h"
+#include "Common/StringId.h"
+#include "../ThirdParty/json_dep/json.hpp"
+#include "Physics/Dynamics/RigidBodyComponent.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
 #ifdef _DEBUG
@@ -27,6 +57,92 @@
 #endif
 namespace Framework 
 {
+    using namespace Framework::literals;
+
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        AiSystem::FrameStats gLastFrame{};
+        AiLodScheduler::Settings gLodSettings{};
+        volatile float gNavSink = 0.0f;
+
+        double ElapsedMs(Clock::time_point from, Clock::time_point to)
+        {
+            return std::chrono::duration<double, std::milli>(to - from).count();
+        }
+
+        /*************************************************************************************
+          \brief Point the enemy at its shared tree and seed its state. The tree id comes
+                 from the component, or from the enemy type when the component has none.
+        *************************************************************************************/
+        void ResolveTree(const AiAgent& agent)
+        {
+            std::string_view id = agent.ai->treeId;
+            if (id.empty())
+            {
+                const bool ranged = agent.type && agent.type->Etype == EnemyTypeComponent::EnemyType::ranged;
+                id = ranged ? DecisionTreeLibrary::kRangedTree : DecisionTreeLibrary::kMeleeTree;
+            }
+            agent.ai->tree = DecisionTreeLibrary::Get(id);
+            SeedEnemyAiState(agent.ai->state, static_cast<std::uint32_t>(agent.object->GetId()));
+        }
+
+        /// FNV-1a over the wall boxes, so a changed level (or edited wall) rebuilds the grid.
+        std::uint64_t WallSignature(const std::vector<AABB>& walls)
+        {
+            std::uint64_t hash = 14695981039346656037ull;
+            auto mix = [&hash](float value)
+            {
+                hash ^= std::bit_cast<std::uint32_t>(value);
+                hash *= 1099511628211ull;
+            };
+            for (const AABB& wall : walls)
+            {
+                mix(wall.min.getX());
+                mix(wall.min.getY());
+                mix(wall.max.getX());
+                mix(wall.max.getY());
+            }
+            return hash ^ walls.size();
+        }
+
+        /*************************************************************************************
+          \brief Read the walls of a level file the way AiBlackboard classifies them: objects
+                 named "rect" with a transform and rigid body. Returns false for files that
+                 are not levels.
+        *************************************************************************************/
+        bool LoadLevelWalls(const std::filesystem::path& file, std::vector<AABB>& walls)
+        {
+            walls.clear();
+            std::ifstream in(file);
+            if (!in.is_open())
+                return false;
+
+            const nlohmann::json j = nlohmann::json::parse(in, nullptr, false);
+            if (j.is_discarded() || !j.is_object() || !j.contains("Level"))
+                return false;
+            const nlohmann::json& level = j["Level"];
+            if (!level.is_object() || !level.contains("GameObjects") || !level["GameObjects"].is_array())
+                return false;
+
+            for (const auto& object : level["GameObjects"])
+            {
+                if (!object.is_object() || StringId::Folded(object.value("name", std::string())) != "rect"_sid)
+                    continue;
+                const auto components = object.find("Components");
+                if (components == object.end() || !components->contains("TransformComponent") ||
+                    !components->contains("RigidBodyComponent"))
+                    continue;
+                const nlohmann::json& tr = (*components)["TransformComponent"];
+                const nlohmann::json& rb = (*components)["RigidBodyComponent"];
+                walls.emplace_back(tr.value("x", 0.0f), tr.value("y", 0.0f),
+                    rb.value("width", 1.0f), rb.value("height", 1.0f));
+            }
+            return true;
+        }
+    }
+
     /*****************************************************************************************
      \brief
         Constructs the AiSystem with a reference to the main window.
@@ -60,28 +176,382 @@ namespace Framework
         Delta time (time elapsed since the last frame), used for time-based updates.
 
      \details
-        Iterates through all game objects retrieved from the Factory. For each object,
-        it attempts to run the default enemy decision tree safely using the provided delta time.
+        Builds the blackboard, resolves missing trees, schedules the enemies due this tick,
+        evaluates them in batches and finally spawns the attacks the trees requested.
+        Trees are resolved here rather than inside the batch because the first lookup
+        loads a file.
     *****************************************************************************************/
-void AiSystem::Update(float dt)
-{
-    for (auto& [id, gocPtr] : FACTORY->Objects())
+    void AiSystem::Update(float dt)
     {
-        if (!gocPtr) continue;
-        GOC* goc = gocPtr.get();
-        auto* ai = goc->GetComponentType<EnemyDecisionTreeComponent>(
-            ComponentTypeId::CT_EnemyDecisionTreeComponent);
-        if (!ai) continue;
-        // Lazy initialize decision tree
-        if (!ai->tree)
-        {
-            ai->tree = CreateDefaultEnemyTree(goc, logic); // Pass LogicSystem pointer from AiSystem
-            std::cout << "[AiSystem] Initialized decision tree for enemy ID: " << id << "\n";
+        FrameStats stats;
+        const Clock::time_point buildStart = Clock::now();
+        blackboard.Build();
+
+        // Dead enemies are not evaluated; keep them still so death animations are not overridden.
+        for (const AiAgent& agent : blackboard.DeadEnemies())
+        {
+            if (auto* rb = agent.object->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent))
+            {
+                rb->velX = 0.0f;
+                rb->velY = 0.0f;
+            }
+        }
+
+        const Clock::time_point navStart = Clock::now();
+        const std::uint64_t wallSignature = WallSignature(blackboard.Walls());
+        if (wallSignature != navWallSignature)
+        {
+            navWallSignature = wallSignature;
+            navGrid.Build(blackboard.Walls(), NavGrid::Settings{});
+            if (navGrid.IsBuilt())
+            {
+                std::cout << "[AiSystem] Navigation grid " << navGrid.Columns() << "x" << navGrid.Rows()
+                    << " (" << navGrid.BlockedCount() << " blocked) from " << blackboard.WallCount() << " walls\n";
+            }
         }
-       
-        UpdateDefaultEnemyTree(goc, dt, logic);
+
+        // One flow field for every chaser, and only while someone is chasing.
+        const bool anyChasing = std::any_of(blackboard.Enemies().begin(), blackboard.Enemies().end(),
+            [](const AiAgent& agent) { return agent.ai->state.hasSeenPlayer; });
+        if (anyChasing && blackboard.HasPlayer() && navGrid.IsBuilt())
+            stats.navFieldRebuilt = navGrid.UpdateFlowField(blackboard.PlayerX(), blackboard.PlayerY());
+        blackboard.SetNavigation(anyChasing && navGrid.HasFlowField() ? &navGrid : nullptr);
+        const Clock::time_point navEnd = Clock::now();
+
+        for (const AiAgent& agent : blackboard.Enemies())
+        {
+            // Lazy lookup of the shared decision tree
+            if (!agent.ai->tree)
+            {
+                ResolveTree(agent);
+                std::cout << "[AiSystem] Enemy ID " << agent.object->GetId() << " uses decision tree '"
+                    << (agent.ai->tree ? agent.ai->tree->treeId : std::string("<none>")) << "'\n";
+            }
+        }
+
+        // A lockstep replay must run the same trees on every build and window size, so it
+        // drops the measured-cost budget (fixed far slice) and the camera view (near radius only).
+        const bool lockstep = FramePacing::GetSettings().lockstep;
+        AiLodScheduler::Settings lodSettings = gLodSettings;
+        if (lockstep)
+            lodSettings.budgetUs = 0.0;
+
+        AiLodScheduler::ViewRect view;
+        const RenderSystem* render = lockstep ? nullptr : RenderSystem::Get();
+        if (render)
+            render->GetGameViewBounds(view.minX, view.minY, view.maxX, view.maxY);
+        lod.Schedule(blackboard, dt, lodSettings, render ? &view : nullptr, dueAgents);
+
+        const Clock::time_point evaluateStart = Clock::now();
+        EvaluateBatched(blackboard, dueAgents, gLodSettings.maxStep, true, &stats);
+
+        const Clock::time_point applyStart = Clock::now();
+        lod.ReportCost(ElapsedMs(evaluateStart, applyStart) * 1000.0, dueAgents.size());
+        for (const AiAgent& agent : dueAgents)
+            ApplyEnemyAttackRequest(agent, logic);
+        const Clock::time_point applyEnd = Clock::now();
+
+        const AiLodScheduler::Stats& lodStats = lod.LastStats();
+        stats.nearCount = lodStats.nearCount;
+        stats.farCount = lodStats.farCount;
+        stats.farEvaluated = lodStats.farEvaluated;
+        stats.usPerTree = lodStats.usPerTree;
+
+        stats.enemies = blackboard.Enemies().size();
+        stats.walls = blackboard.WallCount();
+        stats.blackboardMs = ElapsedMs(buildStart, navStart);
+        stats.navMs = ElapsedMs(navStart, navEnd);
+        stats.navCells = navGrid.CellCount();
+        stats.navReachable = navGrid.HasFlowField() ? navGrid.ReachableCount() : 0;
+        stats.evaluateMs = ElapsedMs(evaluateStart, applyStart);
+        stats.applyMs = ElapsedMs(applyStart, applyEnd);
+        gLastFrame = stats;
+    }
+
+    /*****************************************************************************************
+     \brief
+        Runs the trees of \a agents in batches of kBatchSize.
+
+     \details
+        Each batch is one JobSystem index. The pool's workers are long-lived, so a
+        parallel update costs a wake-up rather than a thread start; the calling thread
+        runs batches too. Small enemy counts stay on the calling thread, where the
+        batches run back to back.
+    *****************************************************************************************/
+    void AiSystem::EvaluateBatched(const AiBlackboard& board, const std::vector<AiAgent>& agents,
+        float maxStep, bool parallel, FrameStats* stats)
+    {
+        PROFILE_SCOPE("AiSystem::EvaluateBatched");
+        const std::size_t batches = (agents.size() + kBatchSize - 1) / kBatchSize;
+        auto runBatch = [&agents, &board, maxStep](std::size_t batch)
+        {
+            const std::size_t begin = batch * kBatchSize;
+            const std::size_t end = std::min(begin + kBatchSize, agents.size());
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const float step = AiLodScheduler::ConsumeStep(agents[i], maxStep);
+                if (const DecisionTreeAsset* tree = agents[i].ai->tree)
+                    RunDecisionTree(*tree, board, agents[i], step);
+            }
+        };
+
+        unsigned workers = 0;
+        if (parallel && agents.size() >= kParallelThreshold)
+        {
+            workers = JobSystem::ParallelFor(batches, runBatch);
+        }
+        else
+        {
+            for (std::size_t batch = 0; batch < batches; ++batch)
+                runBatch(batch);
+        }
+
+        if (stats)
+        {
+            stats->batches = batches;
+            stats->workers = workers;
+        }
+    }
+
+    AiSystem::FrameStats AiSystem::LastFrameStats()
+    {
+        return gLastFrame;
+    }
+
+    AiLodScheduler::Settings& AiSystem::LodSettings()
+    {
+        return gLodSettings;
+    }
+
+    /*****************************************************************************************
+     \brief
+        Benchmarks a synthetic level of \a enemies enemies and \a walls walls.
+
+     \details
+        Half of the enemies are ranged and half start in the chase branch, so both leaves
+        are exercised. Each update rebuilds the blackboard and evaluates the scheduled
+        trees, as Update() does; requested attacks are counted and discarded. The inline
+        and batched runs evaluate every enemy. The LOD run uses the default settings with
+        no camera view and a zero budget, so it measures the floor: near enemies plus
+        the minimum far slice. The layout is seeded, so consecutive runs are comparable.
+    *****************************************************************************************/
+    AiSystem::StressResult AiSystem::RunStressBenchmark(std::size_t enemies, std::size_t walls, int updates)
+    {
+        constexpr float kArenaW = 24.0f;
+        constexpr float kArenaH = 8.0f;
+        constexpr float kDt = 1.0f / 60.0f;
+
+        StressResult result;
+        result.enemies = enemies;
+        result.walls = walls;
+        result.updates = std::max(1, updates);
+
+        std::mt19937 rng(4321u);
+        std::uniform_real_distribution<float> px(-kArenaW * 0.5f, kArenaW * 0.5f);
+        std::uniform_real_distribution<float> py(-kArenaH * 0.5f, kArenaH * 0.5f);
+
+        std::vector<std::unique_ptr<GOC>> owned;
+        std::vector<GOC*> objects;
+        owned.reserve(enemies + walls + 1);
+        objects.reserve(enemies + walls + 1);
+
+        auto makeObject = [&](const char* name, float x, float y, float w, float h)
+        {
+            owned.push_back(std::make_unique<GOC>());
+            GOC* goc = owned.back().get();
+            goc->SetObjectName(name);
+            auto* tr = goc->EmplaceComponent<TransformComponent>(ComponentTypeId::CT_TransformComponent);
+            tr->x = x;
+            tr->y = y;
+            auto* rb = goc->EmplaceComponent<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
+            rb->width = w;
+            rb->height = h;
+            rb->velX = rb->velY = 0.0f;
+            objects.push_back(goc);
+            return goc;
+        };
+
+        makeObject("Player", 0.0f, 0.0f, 0.2f, 0.3f)
+            ->EmplaceComponent<PlayerComponent>(ComponentTypeId::CT_PlayerComponent);
+        for (std::size_t i = 0; i < walls; ++i)
+            makeObject("rect", px(rng), py(rng), 0.5f, 0.5f);
+        for (std::size_t i = 0; i < enemies; ++i)
+        {
+            GOC* enemy = makeObject("Enemy", px(rng), py(rng), 0.2f, 0.3f);
+            auto* ai = enemy->EmplaceComponent<EnemyDecisionTreeComponent>(ComponentTypeId::CT_EnemyDecisionTreeComponent);
+            ai->state.hasSeenPlayer = (i % 2) == 0;
+            enemy->EmplaceComponent<EnemyAttackComponent>(ComponentTypeId::CT_EnemyAttackComponent);
+            auto* type = enemy->EmplaceComponent<EnemyTypeComponent>(ComponentTypeId::CT_EnemyTypeComponent);
+            type->Etype = (i % 4) < 2 ? EnemyTypeComponent::EnemyType::physical : EnemyTypeComponent::EnemyType::ranged;
+        }
+
+        AiBlackboard board;
+        board.Build(objects);
+        for (const AiAgent& agent : board.Enemies())
+            ResolveTree(agent);
+
+        std::vector<AiAgent> due;
+        auto run = [&](bool parallel, bool useLod, std::size_t& attacks, std::size_t& evaluated)
+        {
+            AiLodScheduler scheduler;
+            AiLodScheduler::Settings settings;
+            settings.enabled = useLod;
+            settings.budgetUs = 0.0;
+            FrameStats stats;
+            attacks = 0;
+            evaluated = 0;
+            const Clock::time_point start = Clock::now();
+            for (int u = 0; u < result.updates; ++u)
+            {
+                board.Build(objects);
+                scheduler.Schedule(board, kDt, settings, nullptr, due);
+                const Clock::time_point evaluateStart = Clock::now();
+                EvaluateBatched(board, due, settings.maxStep, parallel, &stats);
+                scheduler.ReportCost(ElapsedMs(evaluateStart, Clock::now()) * 1000.0, due.size());
+                evaluated += due.size();
+                for (const AiAgent& agent : due)
+                {
+                    if (agent.ai->state.attackRequest.kind != EnemyAttackRequest::Kind::None)
+                        ++attacks;
+                    agent.ai->state.attackRequest = {};
+                }
+            }
+            result.workers = std::max(result.workers, stats.workers);
+            return ElapsedMs(start, Clock::now()) / result.updates;
+        };
+
+        std::size_t otherAttacks = 0;
+        std::size_t evaluated = 0;
+        result.serialMs = run(false, false, otherAttacks, evaluated);
+        result.batchedMs = run(true, false, result.attacks, evaluated);
+        result.lodMs = run(true, true, otherAttacks, evaluated);
+        result.lodEvaluated = static_cast<double>(evaluated) / result.updates;
+
+        std::cout << "[AiSystem] Stress " << enemies << " enemies, " << walls << " walls: inline "
+            << result.serialMs << " ms/update, batched " << result.batchedMs << " ms/update on "
+            << result.workers << " workers (" << result.attacks << " attacks requested), LOD "
+            << result.lodMs << " ms/update (" << result.lodEvaluated << " trees/update)\n";
+        return result;
+    }
+
+    /*****************************************************************************************
+     \brief
+        Benchmarks navigation on every level file in Data_Files that contains walls.
+
+     \details
+        For each level: the grid build, one shared flow field toward a random walkable
+        target, steering lookups for \a chasers random walkable enemies, and the same
+        chasers each running their own search instead. The per-chaser search is an
+        uninformed BFS; A* with a good heuristic visits fewer cells, so that column is
+        an upper bound on per-agent pathing. Positions are seeded, so runs are comparable.
+    *****************************************************************************************/
+    std::vector<AiSystem::NavBenchResult> AiSystem::RunNavBenchmark(std::size_t chasers)
+    {
+        constexpr int kBuilds = 10;
+        constexpr std::size_t kTargets = 20;
+        constexpr std::size_t kPerAgentTargets = 3;
+
+        std::vector<std::filesystem::path> files;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(FindDataFilesRoot(), ec))
+        {
+            if (entry.is_regular_file(ec) && entry.path().extension() == ".json")
+                files.push_back(entry.path());
+        }
+        std::sort(files.begin(), files.end());
+
+        std::vector<NavBenchResult> results;
+        std::vector<AABB> walls;
+        for (const std::filesystem::path& file : files)
+        {
+            if (!LoadLevelWalls(file, walls) || walls.empty())
+                continue;
+
+            NavBenchResult result;
+            result.level = file.filename().string();
+            result.walls = walls.size();
+
+            NavGrid grid;
+            const Clock::time_point buildStart = Clock::now();
+            for (int i = 0; i < kBuilds; ++i)
+                grid.Build(walls, NavGrid::Settings{});
+            result.buildMs = ElapsedMs(buildStart, Clock::now()) / kBuilds;
+            result.cells = grid.CellCount();
+            result.blocked = grid.BlockedCount();
+
+            float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+            grid.Bounds(minX, minY, maxX, maxY);
+            std::mt19937 rng(4321u);
+            std::uniform_real_distribution<float> px(minX, maxX);
+            std::uniform_real_distribution<float> py(minY, maxY);
+            auto sample = [&](std::size_t count)
+            {
+                std::vector<std::pair<float, float>> points;
+                for (std::size_t tries = 0; points.size() < count && tries < count * 20; ++tries)
+                {
+                    const float x = px(rng);
+                    const float y = py(rng);
+                    if (grid.IsWalkable(x, y))
+                        points.emplace_back(x, y);
+                }
+                return points;
+            };
+            const auto targets = sample(kTargets);
+            const auto agents = sample(chasers);
+            result.chasers = agents.size();
+            if (targets.empty())
+            {
+                results.push_back(result);
+                continue;
+            }
+
+            double fieldMs = 0.0;
+            double steerMs = 0.0;
+            float checksum = 0.0f;
+            for (const auto& [tx, ty] : targets)
+            {
+                grid.InvalidateFlowField();
+                const Clock::time_point fieldStart = Clock::now();
+                grid.UpdateFlowField(tx, ty);
+                const Clock::time_point steerStart = Clock::now();
+                for (const auto& [ax, ay] : agents)
+                {
+                    float dirX = 0.0f, dirY = 0.0f;
+                    grid.Steer(ax, ay, dirX, dirY);
+                    checksum += dirX + dirY;
+                }
+                const Clock::time_point steerEnd = Clock::now();
+                fieldMs += ElapsedMs(fieldStart, steerStart);
+                steerMs += ElapsedMs(steerStart, steerEnd);
+            }
+            result.fieldMs = fieldMs / targets.size();
+            result.steerMs = steerMs / targets.size();
+
+            const std::size_t perAgentTargets = std::min(kPerAgentTargets, targets.size());
+            const Clock::time_point perAgentStart = Clock::now();
+            for (std::size_t t = 0; t < perAgentTargets; ++t)
+            {
+                for (const auto& [ax, ay] : agents)
+                {
+                    grid.InvalidateFlowField();
+                    grid.UpdateFlowField(ax, ay);
+                    checksum += static_cast<float>(grid.StepsToTarget(targets[t].first, targets[t].second) & 1u);
+                }
+            }
+            result.perAgentMs = ElapsedMs(perAgentStart, Clock::now()) / perAgentTargets;
+
+            std::cout << "[AiSystem] Nav " << result.level << ": " << grid.Columns() << "x" << grid.Rows()
+                << " cells from " << result.walls << " walls, build " << result.buildMs << " ms, shared field "
+                << result.fieldMs << " ms + " << result.chasers << " steers " << result.steerMs
+                << " ms, per-chaser search " << result.perAgentMs << " ms\n";
+            gNavSink = checksum;   // keep the lookups from being optimised away
+            results.push_back(result);
+        }
+
+        if (results.empty())
+            std::cout << "[AiSystem] Nav benchmark: no level files with walls under " << FindDataFilesRoot() << "\n";
+        return results;
     }
-}
 
     /*****************************************************************************************
      \brief
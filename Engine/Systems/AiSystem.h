@@ -32,7 +32,14 @@
 #include "Factory/Factory.h"
 #include "Component/EnemyComponent.h"
 #include "Component/EnemyDecisionTreeComponent.h"
+#include "AI/AiBlackboard.h"
+#include "AI/AiLodScheduler.h"
+#include "AI/NavGrid.h"
 #include "../../Engine/Graphics/Window.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
 namespace Framework {
     /*****************************************************************************************
     \class AiSystem
@@ -44,6 +51,14 @@ namespace Framework {
     evaluating their decision trees, handling transitions between behaviors
     such as patrol, attack, and flee, and optionally visualizing AI state
     during debugging sessions.
+
+    Each update runs in three phases:
+    - Build the AiBlackboard (one pass over the objects) and let the AiLodScheduler
+      pick the enemies due this tick. The NavGrid is rebuilt when the set of walls
+      changes (a level load) and its flow field follows the player while anyone chases.
+    - Run the due trees in batches of kBatchSize enemies, on JobSystem workers once
+      there are at least kParallelThreshold enemies.
+    - Apply the attacks the trees requested, on the main thread, in enemy order.
     *****************************************************************************************/
 	class AiSystem :public Framework::ISystem {
 	public:
@@ -53,9 +68,96 @@ namespace Framework {
 		void draw() override;
 		void Shutdown() override;
 		std::string GetName() override{ return "AiSystem"; }
+
+        /// Enemies per evaluation task.
+        static constexpr std::size_t kBatchSize = 256;
+        /// Below this many enemies the trees run inline. The pool only has to be woken,
+        /// so two batches are enough to split the work.
+        static constexpr std::size_t kParallelThreshold = 2 * kBatchSize;
+
+        /// Timing of the most recent Update(), shown in the performance overlay.
+        struct FrameStats
+        {
+            std::size_t enemies = 0;
+            std::size_t walls = 0;
+            std::size_t batches = 0;
+            unsigned    workers = 0;
+            double      blackboardMs = 0.0;
+            double      evaluateMs = 0.0;
+            double      applyMs = 0.0;
+            std::size_t nearCount = 0;      ///< LOD: run every tick
+            std::size_t farCount = 0;       ///< LOD: time-sliced
+            std::size_t farEvaluated = 0;   ///< LOD: far enemies run this tick
+            double      usPerTree = 0.0;    ///< LOD: cost estimate used for the budget
+            std::size_t navCells = 0;       ///< Navigation grid size (0 when there are no walls)
+            std::size_t navReachable = 0;   ///< Cells that can reach the player
+            bool        navFieldRebuilt = false;
+            double      navMs = 0.0;        ///< Grid rebuild + flow field update
+        };
+
+        /// Result of RunStressBenchmark(); times are averages per update.
+        struct StressResult
+        {
+            std::size_t enemies = 0;
+            std::size_t walls = 0;
+            int         updates = 0;
+            unsigned    workers = 0;
+            double      serialMs = 0.0;
+            double      batchedMs = 0.0;
+            double      lodMs = 0.0;        ///< Batched, LOD with a zero budget (the floor)
+            double      lodEvaluated = 0.0; ///< Average trees run per update under LOD
+            std::size_t attacks = 0;
+        };
+
+        /*************************************************************************************
+          \brief Run the decision trees of \a agents, split into kBatchSize batches. Each
+                 enemy steps by its accumulated time (AiLodScheduler::ConsumeStep).
+          \param maxStep  Cap on one enemy's step, in seconds.
+          \param parallel Allow JobSystem workers (still inline below kParallelThreshold).
+          \param stats    Optional; receives the batch and worker counts.
+        *************************************************************************************/
+        static void EvaluateBatched(const AiBlackboard& board, const std::vector<AiAgent>& agents,
+            float maxStep, bool parallel, FrameStats* stats = nullptr);
+
+        static FrameStats LastFrameStats();
+
+        /// LOD settings used by Update(); editable from the performance overlay.
+        static AiLodScheduler::Settings& LodSettings();
+
+        /*************************************************************************************
+          \brief Time blackboard build + tree evaluation for a synthetic level, inline and
+                 batched. The objects are created for the run only and never enter the factory.
+        *************************************************************************************/
+        static StressResult RunStressBenchmark(std::size_t enemies, std::size_t walls, int updates);
+
+        /// One level's result from RunNavBenchmark().
+        struct NavBenchResult
+        {
+            std::string level;
+            std::size_t walls = 0;
+            std::size_t cells = 0;
+            std::size_t blocked = 0;
+            std::size_t chasers = 0;
+            double      buildMs = 0.0;      ///< Grid build
+            double      fieldMs = 0.0;      ///< One shared flow field
+            double      steerMs = 0.0;      ///< Steering lookups for every chaser
+            double      perAgentMs = 0.0;   ///< One search per chaser instead of a shared field
+        };
+
+        /*************************************************************************************
+          \brief Build navigation grids for every level file in Data_Files that has walls and
+                 time the shared flow field against one search per chaser.
+        *************************************************************************************/
+        static std::vector<NavBenchResult> RunNavBenchmark(std::size_t chasers);
+
 	private:
 		gfx::Window* window;
         LogicSystem* logic;
+        AiBlackboard blackboard;
+        AiLodScheduler lod;
+        std::vector<AiAgent> dueAgents;
+        NavGrid navGrid;
+        std::uint64_t navWallSignature = 0;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,365 @@
+/*********************************************************************************************
+ \file      AnimationSystem.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements AnimationSystem: event-driven tracking, the gather / advance / publish
+            passes and the per-layout UV tables.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Systems/AnimationSystem.h"
+#include "Component/SpriteComponent.h"
+#include "Factory/Factory.h"
+#include "Messaging_System/GameplayEvents.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework {
+
+    namespace
+    {
+        AnimationSystem::FrameStats gLastFrame{};
+
+        using Clock = std::chrono::steady_clock;
+
+        double MsSince(Clock::time_point start)
+        {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        /// Sheet dimensions are far below 2^21, so three of them fit one key.
+        std::uint64_t LayoutKey(int columns, int rows, int frames)
+        {
+            return (static_cast<std::uint64_t>(columns) << 42) |
+                (static_cast<std::uint64_t>(rows) << 21) |
+                static_cast<std::uint64_t>(frames);
+        }
+    }
+
+    AnimationSystem::FrameStats AnimationSystem::LastFrameStats()
+    {
+        return gLastFrame;
+    }
+
+    void AnimationSystem::Track(GOC* object)
+    {
+        const GOCId id = object->GetId();
+        if (entryIndex.count(id))
+            return;
+        auto* anim = object->GetComponentType<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent);
+        if (!anim)
+            return;
+
+        Entry entry;
+        entry.id = id;
+        entry.anim = anim;
+        entry.sprite = object->GetComponentType<SpriteComponent>(ComponentTypeId::CT_SpriteComponent);
+        entryIndex.emplace(id, entries.size());
+        entries.push_back(entry);
+    }
+
+    // Swap-and-pop. The packed arrays are refilled by every gather, so only entries move.
+    void AnimationSystem::Untrack(GOCId id)
+    {
+        auto it = entryIndex.find(id);
+        if (it == entryIndex.end())
+            return;
+
+        const std::size_t slot = it->second;
+        entryIndex.erase(it);
+        if (slot + 1 != entries.size())
+        {
+            entries[slot] = entries.back();
+            entryIndex[entries[slot].id] = slot;
+        }
+        entries.pop_back();
+    }
+
+    void AnimationSystem::OnComponentAdded(const ComponentAddedEvent& event)
+    {
+        if (event.type == ComponentTypeId::CT_SpriteAnimationComponent)
+        {
+            Track(event.object);
+        }
+        else if (event.type == ComponentTypeId::CT_SpriteComponent)
+        {
+            auto it = entryIndex.find(event.id);
+            if (it != entryIndex.end())
+            {
+                Entry& entry = entries[it->second];
+                entry.sprite = event.object->GetComponentType<SpriteComponent>(ComponentTypeId::CT_SpriteComponent);
+                entry.spriteKeyDirty = true;
+            }
+        }
+    }
+
+    void AnimationSystem::OnComponentRemoved(const ComponentRemovedEvent& event)
+    {
+        if (event.type == ComponentTypeId::CT_SpriteAnimationComponent)
+        {
+            Untrack(event.id);
+        }
+        else if (event.type == ComponentTypeId::CT_SpriteComponent)
+        {
+            auto it = entryIndex.find(event.id);
+            if (it != entryIndex.end())
+                entries[it->second].sprite = nullptr;
+        }
+    }
+
+    void AnimationSystem::OnObjectDestroyed(const ObjectDestroyedEvent& event)
+    {
+        Untrack(event.id);
+    }
+
+    void AnimationSystem::RefreshTrackedObjects()
+    {
+        if (!FACTORY)
+            return;
+        for (auto& [id, goc] : FACTORY->Objects())
+        {
+            (void)id;
+            if (goc)
+                Track(goc.get());
+        }
+    }
+
+    void AnimationSystem::Initialize()
+    {
+        entries.clear();
+        entryIndex.clear();
+        uvTable.clear();
+        uvLayouts.clear();
+
+        EventBus& bus = EventBus::Instance();
+        for (EventBus::SubscriptionId subscription : subscriptions)
+            bus.Unsubscribe(subscription);
+        subscriptions[0] = bus.Subscribe<ComponentAddedEvent, &AnimationSystem::OnComponentAdded>(this);
+        subscriptions[1] = bus.Subscribe<ComponentRemovedEvent, &AnimationSystem::OnComponentRemoved>(this);
+        subscriptions[2] = bus.Subscribe<ObjectDestroyedEvent, &AnimationSystem::OnObjectDestroyed>(this);
+
+        // Objects created before we subscribed.
+        RefreshTrackedObjects();
+    }
+
+    /*****************************************************************************************
+      \brief Append one rect per frame for a new layout, laid out exactly like
+             SpriteAnimationComponent::CurrentSheetSample(). Layouts are shared by every clip
+             with the same grid, so the table stays small.
+    *****************************************************************************************/
+    std::uint32_t AnimationSystem::UvBaseFor(int columns, int rows, int frames, std::uint64_t key)
+    {
+        auto it = uvLayouts.find(key);
+        if (it != uvLayouts.end())
+            return it->second;
+
+        const std::uint32_t base = static_cast<std::uint32_t>(uvTable.size());
+        const float invCols = 1.0f / static_cast<float>(columns);
+        const float invRows = 1.0f / static_cast<float>(rows);
+        for (int f = 0; f < frames; ++f)
+        {
+            uvTable.emplace_back(
+                static_cast<float>(f % columns) * invCols,
+                static_cast<float>(f / columns) * invRows,
+                invCols,
+                invRows);
+        }
+        uvLayouts.emplace(key, base);
+        return base;
+    }
+
+    void AnimationSystem::Update(float dt)
+    {
+        const std::size_t count = entries.size();
+        frame.resize(count);
+        accumulator.resize(count);
+        frameDuration.resize(count);
+        playing.resize(count);
+        firstFrame.resize(count);
+        lastFrame.resize(count);
+        looping.resize(count);
+
+        FrameStats stats;
+        stats.animated = count;
+
+        // --- Gather: pick up clip switches and edits made through the components --------
+        Clock::time_point start = Clock::now();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Entry& entry = entries[i];
+            const SpriteAnimationComponent::SpriteSheetAnimation* clip = entry.anim->ActiveAnimation();
+            if (!clip || clip->config.fps <= 0.f)
+            {
+                playing[i] = 0.0f;
+                frameDuration[i] = 1.0f;
+                accumulator[i] = 0.0f;
+                frame[i] = firstFrame[i] = lastFrame[i] = 0.0f;
+                looping[i] = 0.0f;
+                entry.clip = -1;
+                continue;
+            }
+            ++stats.sheets;
+
+            const int total = std::max(1, clip->config.totalFrames);
+            const int first = std::clamp(clip->config.startFrame, 0, total - 1);
+            const int last = clip->config.endFrame >= 0
+                ? std::clamp(clip->config.endFrame, first, total - 1)
+                : total - 1;
+
+            playing[i] = 1.0f;
+            frameDuration[i] = 1.0f / clip->config.fps;
+            accumulator[i] = clip->accumulator;
+            frame[i] = static_cast<float>(std::min(clip->currentFrame, last));   // stale frames past the range
+            firstFrame[i] = static_cast<float>(first);
+            lastFrame[i] = static_cast<float>(last);
+            looping[i] = clip->config.loop ? 1.0f : 0.0f;
+
+            const int columns = std::max(1, clip->config.columns);
+            const int rows = std::max(1, clip->config.rows);
+            const std::uint64_t key = LayoutKey(columns, rows, total);
+            const int clipIndex = entry.anim->ActiveAnimationIndex();
+            if (entry.clip != clipIndex || entry.layout != key)
+            {
+                entry.clip = clipIndex;
+                entry.layout = key;
+                entry.uvBase = UvBaseFor(columns, rows, total, key);
+                entry.finished = false;
+                entry.spriteKeyDirty = true;
+            }
+        }
+        stats.gatherMs = MsSince(start);
+
+        // --- Advance: whole frames elapsed, then wrap (looping) or hold (one-shot) -------
+        // Same result as SpriteAnimationComponent::AdvanceSpriteSheets' while loop, without
+        // branches or integer division, so the compiler can vectorize it.
+        start = Clock::now();
+        {
+            float* const frames = frame.data();
+            float* const acc = accumulator.data();
+            const float* const duration = frameDuration.data();
+            const float* const active = playing.data();
+            const float* const first = firstFrame.data();
+            const float* const last = lastFrame.data();
+            const float* const loops = looping.data();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const float elapsed = acc[i] + dt * active[i];
+                const float steps = std::floor(elapsed / duration[i]);
+                acc[i] = elapsed - steps * duration[i];
+
+                const float next = frames[i] + steps;
+                const float past = next - last[i] - 1.0f;   // >= 0 once we run off the end
+                const float span = last[i] - first[i] + 1.0f;
+                const float wrapped = first[i] + (past - span * std::floor(past / span));
+                const float ended = loops[i] > 0.5f ? wrapped : last[i];
+                const float moved = past < 0.0f ? next : ended;
+                frames[i] = steps > 0.0f ? moved : frames[i];
+            }
+        }
+        stats.advanceMs = MsSince(start);
+
+        // --- Publish: write back, sample the UV table, feed the sprite -------------------
+        start = Clock::now();
+        for (std::size_t i = 0; i < count; ++i)
+            Publish(i, dt);
+        stats.publishMs = MsSince(start);
+
+        stats.layouts = uvLayouts.size();
+        stats.uvRects = uvTable.size();
+        gLastFrame = stats;
+    }
+
+    void AnimationSystem::Publish(std::size_t i, float dt)
+    {
+        Entry& entry = entries[i];
+        SpriteAnimationComponent& anim = *entry.anim;
+
+        if (anim.HasFrames())
+            anim.AdvanceFrameArray(dt);
+
+        auto* clip = anim.ActiveAnimation();
+        if (clip && entry.clip >= 0)
+        {
+            clip->currentFrame = static_cast<int>(frame[i]);
+            clip->accumulator = accumulator[i];
+            anim.EnsureTexture(*clip);
+
+            const int total = std::max(1, clip->config.totalFrames);
+            const int sampleFrame = std::clamp(clip->currentFrame, 0, total - 1);
+            anim.sampled.texture = clip->textureId;
+            anim.sampled.uv = uvTable[entry.uvBase + static_cast<std::uint32_t>(sampleFrame)];
+            anim.sampled.animation = entry.clip;
+            anim.sampled.frame = clip->currentFrame;
+
+            if (entry.sprite)
+            {
+                // The key only changes with the clip; EnsureTexture may have just filled it in.
+                if (entry.spriteKeyDirty && !clip->textureKey.empty())
+                {
+                    entry.sprite->texture_key = clip->textureKey;
+                    entry.spriteKeyDirty = false;
+                }
+                if (clip->textureId)
+                    entry.sprite->texture_id = clip->textureId;
+            }
+
+            if (looping[i] == 0.0f && frame[i] >= lastFrame[i])
+            {
+                if (!entry.finished)
+                {
+                    entry.finished = true;
+                    EventBus::Instance().Enqueue(AnimationFinishedEvent{ entry.id, entry.clip });
+                }
+            }
+            else
+            {
+                entry.finished = false;
+            }
+        }
+        else if (clip)
+        {
+            // fps <= 0: the clip is paused on its current frame.
+            anim.sampled = {};
+            if (entry.sprite)
+            {
+                auto sample = anim.CurrentSheetSample();
+                if (!sample.textureKey.empty() && entry.sprite->texture_key != sample.textureKey)
+                    entry.sprite->texture_key = sample.textureKey;
+                if (sample.texture)
+                    entry.sprite->texture_id = sample.texture;
+            }
+        }
+        else if (anim.HasFrames() && entry.sprite)
+        {
+            const std::size_t frameIndex = anim.CurrentFrameIndex();
+            if (frameIndex < anim.frames.size())
+            {
+                entry.sprite->texture_key = anim.frames[frameIndex].texture_key;
+                if (const unsigned tex = anim.ResolveFrameTexture(frameIndex))
+                    entry.sprite->texture_id = tex;
+            }
+        }
+    }
+
+    void AnimationSystem::Shutdown()
+    {
+        for (EventBus::SubscriptionId& subscription : subscriptions)
+        {
+            EventBus::Instance().Unsubscribe(subscription);
+            subscription = 0;
+        }
+        entries.clear();
+        entryIndex.clear();
+        uvTable.clear();
+        uvLayouts.clear();
+        gLastFrame = {};
+    }
+}
@@ -0,0 +1,110 @@
+/*********************************************************************************************
+ \file      AnimationSystem.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Advances every SpriteAnimationComponent in one pass over packed playback arrays
+            and publishes each object's sampled texture and UV rect for the renderer.
+ \details   Objects with a SpriteAnimationComponent are tracked from factory events, like
+            HealthSystem does. Each update runs three passes:
+            - Gather: copy the active clip's frame, accumulator, fps and resolved frame range
+              into structure-of-arrays storage. Gameplay, AI and the editor keep switching
+              clips through the component, so this is where their changes are picked up.
+            - Advance: one branch-free loop over the packed arrays. It computes how many
+              frames elapsed and wraps or clamps them, with no per-frame while loop.
+            - Publish: write the frame and accumulator back, look the UV rect up in a table
+              precomputed per sheet layout (columns x rows x frames), and store the
+              texture/UV in SpriteAnimationComponent::sampled for RenderSystem.
+
+            A non-looping clip that reaches its last frame queues one AnimationFinishedEvent.
+            Legacy frame-array animations still step through the component.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "Common/System.h"
+#include "Composition/Composition.h"
+#include "Component/SpriteAnimationComponent.h"
+#include "Factory/FactoryEvents.h"
+#include "Messaging_System/EventBus.h"
+#include <glm/vec4.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework {
+
+    class SpriteComponent;
+
+    /*****************************************************************************************
+      \class AnimationSystem
+      \brief Bulk sprite-sheet playback with precomputed per-layout UV tables.
+    *****************************************************************************************/
+    class AnimationSystem : public ISystem {
+    public:
+        void Initialize() override;
+        void Update(float dt) override;
+        void Shutdown() override;
+
+        std::string GetName() override { return "AnimationSystem"; }
+
+        struct FrameStats
+        {
+            std::size_t animated = 0;    ///< Tracked objects
+            std::size_t sheets = 0;      ///< Of those, playing a sprite-sheet clip
+            std::size_t layouts = 0;     ///< Distinct sheet layouts in the UV table
+            std::size_t uvRects = 0;     ///< Entries in the UV table
+            double      gatherMs = 0.0;
+            double      advanceMs = 0.0;
+            double      publishMs = 0.0;
+        };
+        static FrameStats LastFrameStats();
+
+        /// Full resync with the factory; events keep the set current after Initialize().
+        void RefreshTrackedObjects();
+
+    private:
+        /// Cold per-object data, parallel to the packed playback arrays below.
+        struct Entry
+        {
+            GOCId                     id = 0;
+            SpriteAnimationComponent* anim = nullptr;
+            SpriteComponent*          sprite = nullptr;
+            int                       clip = -1;      ///< activeAnimation seen by the last gather
+            std::uint64_t             layout = 0;     ///< Layout key of that clip
+            std::uint32_t             uvBase = 0;     ///< Its first rect in uvTable
+            bool                      finished = false;        ///< AnimationFinishedEvent sent for this play
+            bool                      spriteKeyDirty = true;   ///< Copy the clip's texture key to the sprite
+        };
+
+        void Track(GOC* object);
+        void Untrack(GOCId id);
+        std::uint32_t UvBaseFor(int columns, int rows, int frames, std::uint64_t key);
+        void Publish(std::size_t index, float dt);
+
+        void OnComponentAdded(const ComponentAddedEvent& event);
+        void OnComponentRemoved(const ComponentRemovedEvent& event);
+        void OnObjectDestroyed(const ObjectDestroyedEvent& event);
+
+        std::vector<Entry>                       entries;
+        std::unordered_map<GOCId, std::size_t>   entryIndex;
+
+        // Packed playback state, one slot per entry. Frames are floats so the advance
+        // loop needs no integer division.
+        std::vector<float> frame;
+        std::vector<float> accumulator;
+        std::vector<float> frameDuration;   ///< 1 / fps
+        std::vector<float> playing;         ///< 1 = advancing, 0 = no clip / fps <= 0
+        std::vector<float> firstFrame;
+        std::vector<float> lastFrame;
+        std::vector<float> looping;         ///< 1 = wrap to firstFrame, 0 = hold lastFrame
+
+        std::vector<glm::vec4>                            uvTable;
+        std::unordered_map<std::uint64_t, std::uint32_t>  uvLayouts;   ///< layout key -> uvBase
+
+        EventBus::SubscriptionId subscriptions[3] = {};
+    };
+}
@@ -11,9 +11,11 @@
             - Tracks all GameObjectComposition instances that contain health components.
             - Handles enemy death: triggers death animation (if available), waits for both
               animation completion and a minimum timer before destruction.
+            - Queues EnemyDiedEvent / PlayerDiedEvent; audio and particles react to those.
             - Handles player death: plays death animation, enforces invulnerability timers,
               and destroys the player only after animation + timer finish.
-            - Uses stable IDs instead of raw pointers to avoid dangling references.
+            - Keeps a dense set of health-bearing objects, updated from factory events
+              (component added/removed, object destroyed) instead of rescanning every frame.
             - Provides draw() support for player HUD through PlayerHUDComponent.
             - Fully integrates with SpriteAnimationComponent for frame-based animation logic.
  \copyright
@@ -25,7 +27,8 @@
 #include "Factory/Factory.h"
 #include "Component/SpriteAnimationComponent.h"
 #include "RenderSystem.h"
-#include "Systems/ParticleSystem.h"
+#include "Messaging_System/EventBus.h"
+#include "Messaging_System/GameplayEvents.h"
 #include <algorithm>
 #include <cmath>
 #include <cctype>
@@ -39,6 +42,8 @@
 #endif
 namespace Framework
 {
+    using namespace Framework::literals;
+
     namespace
     {
         /*****************************************************************************************
@@ -47,37 +52,14 @@ namespace Framework
          \param anim
                 Pointer to the SpriteAnimationComponent.
          \param desired
-                Name of the animation we want to find.
+                Case-folded animation id (lowercase "_sid" literal or StringId::Folded).
 
          \return
                 Index of the animation if found, otherwise -1.
         *****************************************************************************************/
-        int FindAnimationIndex(SpriteAnimationComponent* anim, std::string_view desired)
+        int FindAnimationIndex(SpriteAnimationComponent* anim, StringId desired)
         {
-            if (!anim)
-                return -1;
-
-            auto equalsIgnoreCase = [](std::string_view a, std::string_view b)
-                {
-                    if (a.size() != b.size())
-                        return false;
-
-                    for (std::size_t i = 0; i < a.size(); ++i)
-                    {
-                        if (std::tolower(static_cast<unsigned char>(a[i])) !=
-                            std::tolower(static_cast<unsigned char>(b[i])))
-                            return false;
-                    }
-                    return true;
-                };
-
-            for (std::size_t i = 0; i < anim->animations.size(); ++i)
-            {
-                if (equalsIgnoreCase(anim->animations[i].name, desired))
-                    return static_cast<int>(i);
-            }
-
-            return -1;
+            return anim ? anim->FindAnimationIndex(desired) : -1;
         }
 
         /*****************************************************************************************
@@ -91,7 +73,7 @@ namespace Framework
          \details
                 Does nothing if the animation component or requested animation is missing.
         *****************************************************************************************/
-        void PlayAnimationIfAvailable(GOC* goc, std::string_view name)
+        void PlayAnimationIfAvailable(GOC* goc, StringId name)
         {
             if (!goc)
                 return;
@@ -120,7 +102,7 @@ namespace Framework
          \return
                 Duration of the animation in seconds, or 0.0f if it cannot be determined.
         *****************************************************************************************/
-        float AnimationDuration(SpriteAnimationComponent* anim, std::string_view name)
+        float AnimationDuration(SpriteAnimationComponent* anim, StringId name)
         {
             if (!anim)
                 return 0.0f;
@@ -158,7 +140,7 @@ namespace Framework
                 or surpassed the configured end frame. Returns false if the animation is missing
                 or still in progress.
         *****************************************************************************************/
-        bool IsAnimationFinished(SpriteAnimationComponent* anim, std::string_view name)
+        bool IsAnimationFinished(SpriteAnimationComponent* anim, StringId name)
         {
             if (!anim)
                 return false;
@@ -187,217 +169,247 @@ namespace Framework
     {
     }
 
-    void HealthSystem::RefreshTrackedObjects()
+    bool HealthSystem::HasHealth(GOC& object)
     {
-        for (auto& [id, goc] : FACTORY->Objects())
-        {
-            if (!goc)
-                continue;
+        return object.GetComponent(ComponentTypeId::CT_EnemyHealthComponent) ||
+            object.GetComponent(ComponentTypeId::CT_PlayerHealthComponent);
+    }
 
-            auto* enemyHealth =
-                goc->GetComponentType<EnemyHealthComponent>(
-                    ComponentTypeId::CT_EnemyHealthComponent);
+    void HealthSystem::Track(GOC* object)
+    {
+        const GOCId id = object->GetId();
+        if (trackedIndex.count(id))
+            return;
+        trackedIndex.emplace(id, tracked.size());
+        tracked.push_back(TrackedObject{ id, object });
+    }
 
-            auto* playerHealth =
-                goc->GetComponentType<PlayerHealthComponent>(
-                    ComponentTypeId::CT_PlayerHealthComponent);
+    // Swap-and-pop; the moved entry keeps its index map slot in sync.
+    void HealthSystem::Untrack(GOCId id)
+    {
+        auto it = trackedIndex.find(id);
+        if (it == trackedIndex.end())
+            return;
 
-            if (!(enemyHealth || playerHealth))
-                continue;
+        const std::size_t slot = it->second;
+        trackedIndex.erase(it);
+        if (slot + 1 != tracked.size())
+        {
+            tracked[slot] = tracked.back();
+            trackedIndex[tracked[slot].id] = slot;
+        }
+        tracked.pop_back();
+    }
 
-            // Skip if we're already tracking this object
-            if (std::find(gameObjectIds.begin(), gameObjectIds.end(), id) != gameObjectIds.end())
-                continue;
+    void HealthSystem::OnComponentAdded(const ComponentAddedEvent& event)
+    {
+        if (event.type == ComponentTypeId::CT_EnemyHealthComponent ||
+            event.type == ComponentTypeId::CT_PlayerHealthComponent)
+            Track(event.object);
+    }
+
+    // Fires before the component is released, so check for the *other* health component.
+    void HealthSystem::OnComponentRemoved(const ComponentRemovedEvent& event)
+    {
+        if (event.type == ComponentTypeId::CT_EnemyHealthComponent)
+        {
+            if (!event.object->GetComponent(ComponentTypeId::CT_PlayerHealthComponent))
+                Untrack(event.id);
+        }
+        else if (event.type == ComponentTypeId::CT_PlayerHealthComponent)
+        {
+            if (!event.object->GetComponent(ComponentTypeId::CT_EnemyHealthComponent))
+                Untrack(event.id);
+        }
+    }
 
-            gameObjectIds.push_back(id);
+    void HealthSystem::OnObjectDestroyed(const ObjectDestroyedEvent& event)
+    {
+        Untrack(event.id);
+        deathTimers.erase(event.id);
+    }
+
+    void HealthSystem::RefreshTrackedObjects()
+    {
+        for (auto& [id, goc] : FACTORY->Objects())
+        {
+            (void)id;
+            if (goc && HasHealth(*goc))
+                Track(goc.get());
         }
     }
 
     void HealthSystem::Initialize()
     {
-        // Track by ID instead of raw pointers to avoid dangling references.
-        gameObjectIds.clear();
+        tracked.clear();
+        trackedIndex.clear();
         deathTimers.clear();
         playerDied = false;
 
+        EventBus& bus = EventBus::Instance();
+        for (EventBus::SubscriptionId subscription : subscriptions)
+            bus.Unsubscribe(subscription);
+        subscriptions[0] = bus.Subscribe<ComponentAddedEvent, &HealthSystem::OnComponentAdded>(this);
+        subscriptions[1] = bus.Subscribe<ComponentRemovedEvent, &HealthSystem::OnComponentRemoved>(this);
+        subscriptions[2] = bus.Subscribe<ObjectDestroyedEvent, &HealthSystem::OnObjectDestroyed>(this);
+
+        // Objects created before we subscribed.
         RefreshTrackedObjects();
     }
-    
-   
 
     void HealthSystem::Update(float dt)
     {
         lastDt = dt;
-        RefreshTrackedObjects();
-        gameObjectIds.erase(
-            std::remove_if(
-                gameObjectIds.begin(),
-                gameObjectIds.end(),
-                [this, dt](GOCId id) -> bool
+        for (std::size_t i = 0; i < tracked.size();)
+        {
+            const TrackedObject entry = tracked[i];
+            if (UpdateTrackedObject(entry.id, entry.object, dt))
+                Untrack(entry.id);   // the last entry moved into slot i; visit it next
+            else
+                ++i;
+        }
+    }
+
+    bool HealthSystem::UpdateTrackedObject(GOCId id, GOC* goc, float dt)
+    {
+        // ---------------------------------------------------------
+        // Enemy health handling (plays death animation before destroy)
+        // ---------------------------------------------------------
+        if (auto* enemyHealth =
+            goc->GetComponentType<EnemyHealthComponent>(
+                ComponentTypeId::CT_EnemyHealthComponent))
+        {
+            if (enemyHealth->enemyHealth <= 0)
+            {
+                // Default death animation name; can be extended per-enemy type if
+                // future enemies need unique death clips (e.g., "water_death").
+                constexpr StringId deathAnimName = "death"_sid;
+                float& timer = deathTimers[id];
+                auto* anim = goc->GetComponentType<SpriteAnimationComponent>(
+                    ComponentTypeId::CT_SpriteAnimationComponent);
+
+                // First frame after "death" �C trigger death animation and compute duration.
+                if (timer <= 0.0f)
                 {
-                    // Re-resolve each frame; if gone, drop it safely.
-                    GOC* goc = FACTORY->GetObjectWithId(id);
-                    if (!goc)
-                    {
-                        // Object was destroyed elsewhere; clean up any death timer.
-                        deathTimers.erase(id);
-                        return true;
-                    }
+                    PlayAnimationIfAvailable(goc, deathAnimName);
 
-                    // ---------------------------------------------------------
-                    // Enemy health handling (plays death animation before destroy)
-                    // ---------------------------------------------------------
-                    if (auto* enemyHealth =
-                        goc->GetComponentType<EnemyHealthComponent>(
-                            ComponentTypeId::CT_EnemyHealthComponent))
+                    // Particles and the explosion clip react to this in the EventBus flush.
+                    EnemyDiedEvent died{ id, false, 0.0f, 0.0f };
+                    if (auto* tr = goc->GetComponentType<TransformComponent>(
+                        ComponentTypeId::CT_TransformComponent))
                     {
-                        if (enemyHealth->enemyHealth <= 0)
-                        {
-                            // Default death animation name; can be extended per-enemy type if
-                            // future enemies need unique death clips (e.g., "water_death").
-                            constexpr std::string_view deathAnimName = "death";
-                            float& timer = deathTimers[id];
-                            auto* anim = goc->GetComponentType<SpriteAnimationComponent>(
-                                ComponentTypeId::CT_SpriteAnimationComponent);
-                            auto* audio = goc->GetComponentType<AudioComponent>(
-                                ComponentTypeId::CT_AudioComponent);
-
-                            // First frame after "death" �C trigger death animation and compute duration.
-                            if (timer <= 0.0f)
-                            {
-                                PlayAnimationIfAvailable(goc, deathAnimName);
-
-                                if (auto* tr = goc->GetComponentType<TransformComponent>(
-                                    ComponentTypeId::CT_TransformComponent))
-                                {
-                                    if (auto* particleSystem = ParticleSystem::Instance())
-                                    {
-                                        particleSystem->SpawnEnemyDeathParticles({ tr->x, tr->y });
-                                    }
-                                }
-                                if (audio)
-                                {
-                                    if (audio->entityType == "enemy_fire")
-                                        audio->Play("FireGhostExplosion");  // the death clip
-                                    else if (audio->entityType == "enemy_water")
-                                        audio->Play("WaterGhostExplosion"); // the death clip
-                                }
-                                // Use animation length if available; otherwise fall back to a minimum.
-                                timer = std::max(AnimationDuration(anim, deathAnimName), 0.2f);
-                            }
-                            else
-                            {
-                                // Count down until we actually destroy the object.
-                                timer = std::max(0.0f, timer - dt);
-                            }
-
-                            const bool hasAnimation = anim && FindAnimationIndex(anim, deathAnimName) >= 0;
-                            const bool animationFinished = hasAnimation
-                                ? IsAnimationFinished(anim, deathAnimName)
-                                : true; // if no animation, rely on timer only
-
-                            // Destroy only after both the timer has elapsed and the animation has
-                            // completed its final frame (ensures death pose is visible briefly).
-                            if (timer <= 0.0f && animationFinished)
-                            {
-                                FACTORY->Destroy(goc);
-                                deathTimers.erase(id);
-
-                                std::cout << "[HealthSystem] Enemy "
-                                    << goc->GetId()
-                                    << " destroyed.\n";
-                                return true; // remove from tracked IDs
-                            }
-
-                            // Keep the object for now so the death animation can finish.
-                            return false;
-                        }
-
-                        // Enemy is still alive; make sure we don't keep a stale timer.
-                        deathTimers.erase(id);
+                        died.hasPosition = true;
+                        died.x = tr->x;
+                        died.y = tr->y;
                     }
+                    EventBus::Instance().Enqueue(died);
+                    // Use animation length if available; otherwise fall back to a minimum.
+                    timer = std::max(AnimationDuration(anim, deathAnimName), 0.2f);
+                }
+                else
+                {
+                    // Count down until we actually destroy the object.
+                    timer = std::max(0.0f, timer - dt);
+                }
+
+                const bool hasAnimation = anim && FindAnimationIndex(anim, deathAnimName) >= 0;
+                const bool animationFinished = hasAnimation
+                    ? IsAnimationFinished(anim, deathAnimName)
+                    : true; // if no animation, rely on timer only
+
+                // Destroy only after both the timer has elapsed and the animation has
+                // completed its final frame (ensures death pose is visible briefly).
+                if (timer <= 0.0f && animationFinished)
+                {
+                    FACTORY->Destroy(goc);
+                    deathTimers.erase(id);
+
+                    std::cout << "[HealthSystem] Enemy "
+                        << goc->GetId()
+                        << " destroyed.\n";
+                    return true; // remove from tracked IDs
+                }
+
+                // Keep the object for now so the death animation can finish.
+                return false;
+            }
 
-                    // ---------------------------------------------------------
-                    // Player health handling (plays death animation before destroy)
-                    // ---------------------------------------------------------
-                    if (auto* playerHealth =
-                        goc->GetComponentType<PlayerHealthComponent>(
-                            ComponentTypeId::CT_PlayerHealthComponent))
+            // Enemy is still alive; make sure we don't keep a stale timer.
+            deathTimers.erase(id);
+        }
+
+        // ---------------------------------------------------------
+        // Player health handling (plays death animation before destroy)
+        // ---------------------------------------------------------
+        if (auto* playerHealth =
+            goc->GetComponentType<PlayerHealthComponent>(
+                ComponentTypeId::CT_PlayerHealthComponent))
+        {
+            constexpr StringId deathAnimName = "death"_sid;
+            auto* anim = goc->GetComponentType<SpriteAnimationComponent>(
+                ComponentTypeId::CT_SpriteAnimationComponent);
+
+            if (!playerHealth->isDead)
+            {
+                if (playerHealth->isInvulnerable)
+                {
+                    playerHealth->invulnTime -= dt;
+                    if (playerHealth->invulnTime <= 0.0f)
                     {
-                        auto* audio = goc->GetComponentType<AudioComponent>(
-                            ComponentTypeId::CT_AudioComponent);
-
-                        constexpr std::string_view deathAnimName = "death";
-                        auto* anim = goc->GetComponentType<SpriteAnimationComponent>(
-                            ComponentTypeId::CT_SpriteAnimationComponent);
-
-                        if (!playerHealth->isDead)
-                        {
-                            if (playerHealth->isInvulnerable)
-                            {
-                                playerHealth->invulnTime -= dt;
-                                if (playerHealth->invulnTime <= 0.0f)
-                                {
-                                    playerHealth->invulnTime = 0.0f;
-                                    playerHealth->isInvulnerable = false;
-                                    std::cout << "[PlayerHealthComponent] Invulnerability ended.\n";
-                                }
-                            }
-                        }
-
-                        if (playerHealth->playerHealth <= 0)
-                        {
-                            float& timer = deathTimers[id];
-
-                            playerDied = true;
-                            
-                            if (!playerHealth->deathSoundPlayed && audio)
-                            {
-                                audio->TriggerSound("PlayerDead");
-                                playerHealth->deathSoundPlayed = true;
-                                std::cout << "[DEBUG] PlayerDead triggered\n";
-                            }
-                            if (!playerHealth->isDead)
-                            {
-                                audio->TriggerSound("PlayerDead");
-                                playerHealth->isDead = true;
-                                PlayAnimationIfAvailable(goc, deathAnimName);
-                                timer = std::max(AnimationDuration(anim, deathAnimName), 0.2f);
-                            }
-                            else
-                            {
-                                timer = std::max(0.0f, timer - dt);
-                            }
-
-                            const bool hasAnimation = anim && FindAnimationIndex(anim, deathAnimName) >= 0;
-                            const bool animationFinished = hasAnimation
-                                ? IsAnimationFinished(anim, deathAnimName)
-                                : true; // if no animation, rely on timer only
-
-                            if (timer <= 0.0f && animationFinished)
-                            {
-                                FACTORY->Destroy(goc);
-                                deathTimers.erase(id);
-
-                                std::cout << "[HealthSystem] Player "
-                                    << goc->GetId()
-                                    << " destroyed.\n";
-                                return true; // remove from tracked IDs
-                            }
-
-                            // Keep player around until animation finishes
-                            return false;
-                        }
-
-                        // Player is alive; clear any stale death timers / flags.
-                        deathTimers.erase(id);
-                        
+                        playerHealth->invulnTime = 0.0f;
+                        playerHealth->isInvulnerable = false;
+                        std::cout << "[PlayerHealthComponent] Invulnerability ended.\n";
                     }
+                }
+            }
+
+            if (playerHealth->playerHealth <= 0)
+            {
+                float& timer = deathTimers[id];
+
+                playerDied = true;
+
+                if (!playerHealth->isDead)
+                {
+                    // A lethal hit already reported itself as HitLandedEvent; this covers
+                    // deaths that did not come through TakeDamage().
+                    EventBus::Instance().Enqueue(PlayerDiedEvent{ id });
+                    playerHealth->isDead = true;
+                    PlayAnimationIfAvailable(goc, deathAnimName);
+                    timer = std::max(AnimationDuration(anim, deathAnimName), 0.2f);
+                }
+                else
+                {
+                    timer = std::max(0.0f, timer - dt);
+                }
+
+                const bool hasAnimation = anim && FindAnimationIndex(anim, deathAnimName) >= 0;
+                const bool animationFinished = hasAnimation
+                    ? IsAnimationFinished(anim, deathAnimName)
+                    : true; // if no animation, rely on timer only
+
+                if (timer <= 0.0f && animationFinished)
+                {
+                    FACTORY->Destroy(goc);
+                    deathTimers.erase(id);
+
+                    std::cout << "[HealthSystem] Player "
+                        << goc->GetId()
+                        << " destroyed.\n";
+                    return true; // remove from tracked IDs
+                }
 
-                    // Keep tracking this ID.
-                    return false;
-                }),
-            gameObjectIds.end());
+                // Keep player around until animation finishes
+                return false;
+            }
+
+            // Player is alive; clear any stale death timers / flags.
+            deathTimers.erase(id);
+            
+        }
+
+        // Keep tracking this ID.
+        return false;
     }
     auto WorldToScreenUI = [](float worldX, float worldY, int screenW, int screenH, const glm::mat4& vpMatrix)
     {
@@ -439,11 +451,9 @@ namespace Framework
 
         glViewport(viewportX, viewportY, viewportW, viewportH);
 
-        for (GOCId id : gameObjectIds)
+        for (const TrackedObject& entry : tracked)
         {
-            GOC* goc = FACTORY->GetObjectWithId(id);
-            if (!goc)
-                continue;
+            GOC* goc = entry.object;
 
             auto* playerHealth =
                 goc->GetComponentType<PlayerHealthComponent>(ComponentTypeId::CT_PlayerHealthComponent);
@@ -459,11 +469,9 @@ namespace Framework
      
         }
         
-        for (GOCId id : gameObjectIds)
+        for (const TrackedObject& entry : tracked)
         {
-            GOC* goc = FACTORY->GetObjectWithId(id);
-            if (!goc)
-                continue;
+            GOC* goc = entry.object;
             auto* enemyHealth =
                 goc->GetComponentType<EnemyHealthComponent>(ComponentTypeId::CT_EnemyHealthComponent);
             auto* transform =
@@ -525,7 +533,13 @@ namespace Framework
 
     void HealthSystem::Shutdown()
     {
-        gameObjectIds.clear();
+        for (EventBus::SubscriptionId& subscription : subscriptions)
+        {
+            EventBus::Instance().Unsubscribe(subscription);
+            subscription = 0;
+        }
+        tracked.clear();
+        trackedIndex.clear();
         deathTimers.clear();
         playerDied = false;
     }
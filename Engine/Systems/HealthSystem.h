@@ -13,7 +13,8 @@
               animation completion and a minimum timer before destruction.
             - Handles player death: plays death animation, enforces invulnerability timers,
               and destroys the player only after animation + timer finish.
-            - Uses stable IDs instead of raw pointers to avoid dangling references.
+            - Keeps a dense set of health-bearing objects, updated from factory events
+              (component added/removed, object destroyed) instead of rescanning every frame.
             - Provides draw() support for player HUD through PlayerHUDComponent.
             - Fully integrates with SpriteAnimationComponent for frame-based animation logic.
  \copyright
@@ -54,7 +55,10 @@
 
 
 #include "Component/AudioComponent.h"
+#include "Factory/FactoryEvents.h"
+#include "Messaging_System/EventBus.h"
 #include <unordered_map>
+#include <vector>
 
 
 namespace Framework {
@@ -79,8 +83,14 @@ namespace Framework {
 
         // System name for diagnostics and registries.
         std::string GetName() override { return "HealthSystem"; }
+
+        // Full resync with the factory. Events keep the set current; this is only needed
+        // for objects that existed before Initialize().
         void RefreshTrackedObjects();
 
+        // Number of objects with a player or enemy health component.
+        std::size_t TrackedCount() const { return tracked.size(); }
+
         // Expose player death state so the game loop can react (e.g., show defeat screen).
         bool HasPlayerDied() const { return playerDied; }
 
@@ -89,8 +99,26 @@ namespace Framework {
 
 
     private:
+        struct TrackedObject
+        {
+            GOCId id;
+            GOC*  object;   // Valid until ObjectDestroyedEvent
+        };
+
+        void Track(GOC* object);
+        void Untrack(GOCId id);
+        static bool HasHealth(GOC& object);
+        // Per-object death/invulnerability logic. Returns true when the object should stop being tracked.
+        bool UpdateTrackedObject(GOCId id, GOC* goc, float dt);
+
+        void OnComponentAdded(const ComponentAddedEvent& event);
+        void OnComponentRemoved(const ComponentRemovedEvent& event);
+        void OnObjectDestroyed(const ObjectDestroyedEvent& event);
+
         gfx::Window* window;          // Non-owning window handle used by the system.
-        std::vector<GOCId> gameObjectIds;
+        std::vector<TrackedObject> tracked;                 // Dense; order is not stable
+        std::unordered_map<GOCId, std::size_t> trackedIndex; // id -> slot in tracked
+        EventBus::SubscriptionId subscriptions[3] = {};
         std::unordered_map<GOCId, float> deathTimers;
         float lastDt = 0.0f;
 
@@ -6,8 +6,11 @@
  \details   This lightweight system manages transient attack volumes (HitBoxComponent):
             - Creation: SpawnHitBox() attaches owner/context and a lifetime timer.
             - Lifetime: Each active hit box counts down; removed when it expires or hits.
-            - Collision: On each Update(), checks hit box vs. world hurt boxes (other objs'
-              HitBoxComponent flagged active) via AABB overlap.
+            - Collision: On each Update(), snapshots hurtable level objects into a
+              HurtBoxIndex (uniform grid) and resolves each hit box with one filtered
+              spatial query instead of scanning every level object.
+            - Feedback: Landed hits are queued as HitLandedEvent; audio and impact VFX
+              react to them when the EventBus flushes at the end of the frame.
             - Integration: Driven by LogicSystem (e.g., mouse click creates a hit box in
               the player's facing direction).
 
@@ -28,14 +31,19 @@
 #include "LogicSystem.h"
 #include "Component/HitBoxComponent.h"
 #include "Component/SpriteAnimationComponent.h"
-#include "Systems/VfxHelpers.h"
+#include "Messaging_System/EventBus.h"
+#include "Messaging_System/GameplayEvents.h"
 #include "Factory/Factory.h"
+#include "Common/VerboseLog.h"
+#include "Debug/Profiler.h"
 
 #include <iostream>
 #include <cctype>
 #include <string_view>
 #include <cmath>
-#include <glm/vec2.hpp>
+#include <algorithm>
+#include <chrono>
+#include <random>
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
 #ifdef _DEBUG
@@ -43,6 +51,8 @@
 #endif
 namespace Framework
 {
+    using namespace Framework::literals;
+
     namespace
     {
         /*****************************************************************************************
@@ -51,37 +61,14 @@ namespace Framework
          \param anim
                 Pointer to the SpriteAnimationComponent.
          \param desired
-                Name of the animation we want to find.
+                Case-folded animation id (lowercase "_sid" literal or StringId::Folded).
 
          \return
                 Index of the animation if found, otherwise -1.
         *****************************************************************************************/
-        int FindAnimationIndex(SpriteAnimationComponent* anim, std::string_view desired)
+        int FindAnimationIndex(SpriteAnimationComponent* anim, StringId desired)
         {
-            if (!anim)
-                return -1;
-
-            auto equalsIgnoreCase = [](std::string_view a, std::string_view b)
-                {
-                    if (a.size() != b.size())
-                        return false;
-
-                    for (std::size_t i = 0; i < a.size(); ++i)
-                    {
-                        if (std::tolower(static_cast<unsigned char>(a[i])) !=
-                            std::tolower(static_cast<unsigned char>(b[i])))
-                            return false;
-                    }
-                    return true;
-                };
-
-            for (std::size_t i = 0; i < anim->animations.size(); ++i)
-            {
-                if (equalsIgnoreCase(anim->animations[i].name, desired))
-                    return static_cast<int>(i);
-            }
-
-            return -1;
+            return anim ? anim->FindAnimationIndex(desired) : -1;
         }
 
         /*****************************************************************************************
@@ -95,7 +82,7 @@ namespace Framework
          \details
                 Does nothing if the animation component or requested animation is missing.
         *****************************************************************************************/
-        void PlayAnimationIfAvailable(GOC* goc, std::string_view name)
+        void PlayAnimationIfAvailable(GOC* goc, StringId name)
         {
             if (!goc)
                 return;
@@ -111,6 +98,19 @@ namespace Framework
                 anim->SetActiveAnimation(idx);
             }
         }
+
+        /// Static label for logs; no string is built per spawn.
+        [[maybe_unused]] constexpr const char* TeamName(HitBoxComponent::Team team)
+        {
+            switch (team)
+            {
+            case HitBoxComponent::Team::Player:  return "Player";
+            case HitBoxComponent::Team::Enemy:   return "Enemy";
+            case HitBoxComponent::Team::Thrown:  return "Thrown";
+            case HitBoxComponent::Team::Neutral: return "Neutral";
+            }
+            return "Unknown";
+        }
     } // anonymous namespace
 
     /*****************************************************************************************
@@ -134,16 +134,45 @@ namespace Framework
     *****************************************************************************************/
     void HitBoxSystem::Initialize()
     {
-        activeHitBoxes.clear();
+        activeCount = 0;
+        droppedSpawns = 0;
     }
 
     /*****************************************************************************************
       \brief Release runtime state held by the system.
-             (No heap ownership beyond unique_ptrs inside activeHitBoxes.)
+             (The pool is inline storage; dropping the count is all that is needed.)
     *****************************************************************************************/
     void HitBoxSystem::Shutdown()
     {
-        activeHitBoxes.clear();
+        activeCount = 0;
+        hurtIndex.Clear();
+    }
+
+    /*****************************************************************************************
+      \brief Claim the next free pool slot.
+      \return Slot reset to defaults, or nullptr if all kMaxActiveHitBoxes are live.
+    *****************************************************************************************/
+    HitBoxSystem::ActiveHitBox* HitBoxSystem::AcquireSlot()
+    {
+        if (activeCount >= activeHitBoxes.size())
+        {
+            if (droppedSpawns++ == 0)
+                std::cerr << "[HitBoxSystem] Hitbox pool full (" << kMaxActiveHitBoxes << "), dropping spawns\n";
+            return nullptr;
+        }
+        ActiveHitBox& slot = activeHitBoxes[activeCount++];
+        slot = ActiveHitBox{};
+        return &slot;
+    }
+
+    /*****************************************************************************************
+      \brief Swap-and-pop removal: O(1), does not preserve order.
+    *****************************************************************************************/
+    void HitBoxSystem::ReleaseSlot(std::size_t index)
+    {
+        --activeCount;
+        if (index != activeCount)
+            activeHitBoxes[index] = activeHitBoxes[activeCount];
     }
 
     /*****************************************************************************************
@@ -157,8 +186,8 @@ namespace Framework
       \param duration  Lifetime in seconds before the hit box auto-expires.
       \param team      Initial team value (may be overridden based on attacker).
       \details
-        - Allocates a HitBoxComponent and marks it active for collision participation.
-        - Stores an internal ActiveHitBox record with countdown timer.
+        - Claims a pool slot (no allocation) and fills it with the hit volume.
+        - The slot keeps a countdown timer; a full pool drops the spawn.
         - The hit is checked against other objects' active hurt boxes during Update().
     *****************************************************************************************/
     void HitBoxSystem::SpawnHitBox(GameObjectComposition* attacker,
@@ -171,45 +200,32 @@ namespace Framework
         if (!attacker)
             return;
 
-        auto newhitbox = std::make_unique<HitBoxComponent>();
-        newhitbox->spawnX = targetX;
-        newhitbox->spawnY = targetY;
-        newhitbox->width = width;
-        newhitbox->height = height;
-        newhitbox->damage = damage;
-        newhitbox->duration = duration;
-        newhitbox->owner = attacker;
-        newhitbox->team = team;
-        newhitbox->soundDelay = soundDelay;
-
         // Decide team based on attacker, so we avoid friendly fire.
         if (attacker->GetComponentType<PlayerComponent>(ComponentTypeId::CT_PlayerComponent))
-            newhitbox->team = HitBoxComponent::Team::Player;
+            team = HitBoxComponent::Team::Player;
         else if (attacker->GetComponentType<EnemyComponent>(ComponentTypeId::CT_EnemyComponent))
-            newhitbox->team = HitBoxComponent::Team::Enemy;
+            team = HitBoxComponent::Team::Enemy;
         else
-            newhitbox->team = HitBoxComponent::Team::Neutral;
-
-        newhitbox->ActivateHurtBox(); // reuse flag: treat as active volume for collisions
+            team = HitBoxComponent::Team::Neutral;
 
-        std::string teamStr;
-        switch (newhitbox->team)
-        {
-        case HitBoxComponent::Team::Player:  teamStr = "Player";  break;
-        case HitBoxComponent::Team::Enemy:   teamStr = "Enemy";   break;
-        case HitBoxComponent::Team::Thrown:  teamStr = "Thrown";  break;
-        case HitBoxComponent::Team::Neutral: teamStr = "Neutral"; break;
-        }
-
-        std::cout << "HitBox spawned at (" << targetX << ", " << targetY
-            << ") with team: " << teamStr << "\n";
-
-        ActiveHitBox active;
-        active.hitbox = std::move(newhitbox);
-        active.ownerId = attacker->GetId();
-        active.timer = duration;
+        ActiveHitBox* active = AcquireSlot();
+        if (!active)
+            return;
 
-        activeHitBoxes.push_back(std::move(active));
+        active->spawnX = targetX;
+        active->spawnY = targetY;
+        active->width = width;
+        active->height = height;
+        active->damage = damage;
+        active->duration = duration;
+        active->timer = duration;
+        active->soundDelay = soundDelay;
+        active->team = team;
+        active->targetMask = TargetMaskForTeam(team);
+        active->ownerId = attacker->GetId();
+
+        SOFASPUDS_VLOG("HitBox", "spawned at (" << targetX << ", " << targetY
+            << ") with team: " << TeamName(team));
     }
 
     /*****************************************************************************************
@@ -246,88 +262,135 @@ namespace Framework
         dirX /= len;
         dirY /= len;
 
-        auto newhitbox = std::make_unique<HitBoxComponent>();
-        newhitbox->spawnX = targetX;
-        newhitbox->spawnY = targetY;
-        newhitbox->width = width;
-        newhitbox->height = height;
-        newhitbox->damage = damage;
-        newhitbox->duration = duration;
-        newhitbox->owner = attacker;
-        newhitbox->team = team;
-
         // Set the team / make sure friendly fire does not happen.
         if (attacker->GetComponentType<PlayerComponent>(ComponentTypeId::CT_PlayerComponent))
-            newhitbox->team = HitBoxComponent::Team::Thrown;
+            team = HitBoxComponent::Team::Thrown;
         else if (attacker->GetComponentType<EnemyComponent>(ComponentTypeId::CT_EnemyComponent))
-            newhitbox->team = HitBoxComponent::Team::Enemy;
+            team = HitBoxComponent::Team::Enemy;
 
-        newhitbox->ActivateHurtBox();
+        ActiveHitBox* projectile = AcquireSlot();
+        if (!projectile)
+            return;
 
-        std::string teamStr;
-        switch (newhitbox->team)
+        projectile->spawnX = targetX;
+        projectile->spawnY = targetY;
+        projectile->width = width;
+        projectile->height = height;
+        projectile->damage = damage;
+        projectile->duration = duration;
+        projectile->timer = duration;
+        projectile->hitGraceTimer = 1.0f;
+        projectile->velX = dirX * speed;
+        projectile->velY = dirY * speed;
+        projectile->isProjectile = true;
+        projectile->team = team;
+        projectile->targetMask = TargetMaskForTeam(team);
+        projectile->ownerId = attacker->GetId();
+
+        SOFASPUDS_VLOG("HitBox", "projectile spawned at (" << targetX << ", " << targetY
+            << ") with team: " << TeamName(team));
+    }
+
+    /*****************************************************************************************
+      \brief Map a hitbox team to the target categories it interacts with.
+      \param team Team assigned at spawn time.
+      \return HurtCategory bitmask.
+    *****************************************************************************************/
+    std::uint32_t HitBoxSystem::TargetMaskForTeam(HitBoxComponent::Team team)
+    {
+        switch (team)
         {
-        case HitBoxComponent::Team::Player:  teamStr = "Player";  break;
-        case HitBoxComponent::Team::Enemy:   teamStr = "Enemy";   break;
-        case HitBoxComponent::Team::Thrown:  teamStr = "Thrown";  break;
-        case HitBoxComponent::Team::Neutral: teamStr = "Neutral"; break;
+        case HitBoxComponent::Team::Player:
+        case HitBoxComponent::Team::Thrown:
+            return HurtCategory_Enemy | HurtCategory_Other;
+        case HitBoxComponent::Team::Enemy:
+            return HurtCategory_Player | HurtCategory_Other;
+        case HitBoxComponent::Team::Neutral:
+        default:
+            return HurtCategory_All;
         }
+    }
+
+    /*****************************************************************************************
+      \brief Snapshot every hurtable level object (transform + rigid body on an enabled
+             layer) into hurtIndex, in LevelObjects() order.
+      \note  Component lookups happen once per object here instead of once per
+             hitbox/object pair.
+    *****************************************************************************************/
+    void HitBoxSystem::BuildHurtIndex()
+    {
+        hurtIndex.Clear();
+        auto& layers = FACTORY->Layers();
 
-        std::cout << "HitBox spawned at (" << targetX << ", " << targetY
-            << ") with team: " << teamStr << "\n";
+        for (auto* obj : logic.LevelObjects())
+        {
+            if (!obj)
+                continue;
+            if (!layers.IsLayerEnabled(layers.LayerKeyFor(obj->GetId())))
+                continue;
+            auto* tr = obj->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
+            auto* rb = obj->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
+            if (!(tr && rb))
+                continue;
 
-        ActiveHitBox projectile;
-        projectile.hitbox = std::move(newhitbox);
-        projectile.ownerId = attacker->GetId();
-        projectile.timer = duration;
-        projectile.hitGraceTimer = 1.0f;
-        projectile.velX = dirX * speed;
-        projectile.velY = dirY * speed;
-        projectile.isProjectile = true;
+            HurtTarget target;
+            target.object = obj;
+            target.box = AABB(tr->x, tr->y, rb->width, rb->height);
+            target.transform = tr;
+            target.body = rb;
+            target.playerHealth = obj->GetComponentType<PlayerHealthComponent>(ComponentTypeId::CT_PlayerHealthComponent);
+            target.enemyHealth = obj->GetComponentType<EnemyHealthComponent>(ComponentTypeId::CT_EnemyHealthComponent);
+            target.enemyType = obj->GetComponentType<EnemyTypeComponent>(ComponentTypeId::CT_EnemyTypeComponent);
+
+            if (obj->GetComponentType<PlayerComponent>(ComponentTypeId::CT_PlayerComponent))
+                target.category = HurtCategory_Player;
+            else if (obj->GetComponentType<EnemyComponent>(ComponentTypeId::CT_EnemyComponent))
+                target.category = HurtCategory_Enemy;
+            else
+                target.category = HurtCategory_Other;
 
-        activeHitBoxes.push_back(std::move(projectile));
+            hurtIndex.Add(target);
+        }
     }
 
     /*****************************************************************************************
       \brief Advance all active hit boxes: tick timers, check collisions, and cull as needed.
       \param dt Delta time (seconds).
       \details
+        - Rebuilds the hurtbox index once (only when hit boxes are active).
         - For each active hit box:
           * Decrement remaining time.
           * Build its AABB (center + extents).
-          * Iterate over level objects from LogicSystem; skip the owner.
-          * If an object is a valid target (based on team/type), check overlap.
+          * Query the index for the first overlapping target its team may hit; the owner
+            and objects on disabled layers are never returned.
           * If an enemy is hit, apply damage, knockback, and trigger "knockback" animation.
         - If no hit occurs, remove the hit box once its timer reaches zero.
     *****************************************************************************************/
     void HitBoxSystem::Update(float dt)
     {
-        if (!FACTORY)
+        PROFILE_SCOPE("HitBoxSystem::Update");
+        if (!FACTORY || activeCount == 0)
             return;
 
         auto& layers = FACTORY->Layers();
+        BuildHurtIndex();
 
-        for (auto it = activeHitBoxes.begin(); it != activeHitBoxes.end();)
+        for (std::size_t i = 0; i < activeCount;)
         {
-            it->timer -= dt;
-            auto* HB = it->hitbox.get();
-            auto* attacker = FACTORY->GetObjectWithId(it->ownerId);
+            ActiveHitBox* HB = &activeHitBoxes[i];
+            HB->timer -= dt;
+            auto* attacker = FACTORY->GetObjectWithId(HB->ownerId);
 
-            if (!attacker || !HB || !HB->active)
-            {
-                it = activeHitBoxes.erase(it);
-                continue;
-            }
-            if (!layers.IsLayerEnabled(attacker->GetLayerName()))
+            if (!attacker || !layers.IsLayerEnabled(layers.LayerKeyFor(HB->ownerId)))
             {
-                it = activeHitBoxes.erase(it);
+                ReleaseSlot(i);   // the last entry moved into i; process it next
                 continue;
             }
             // Projectile movement
-            if (it->isProjectile || HB->team == HitBoxComponent::Team::Thrown)
+            if (HB->isProjectile || HB->team == HitBoxComponent::Team::Thrown)
             {
-                it->hitbox->spawnX += it->velX * dt;
-                it->hitbox->spawnY += it->velY * dt;
+                HB->spawnX += HB->velX * dt;
+                HB->spawnY += HB->velY * dt;
             }
 
             AABB hitboxAABB(HB->spawnX, HB->spawnY, HB->width, HB->height);
@@ -336,58 +399,42 @@ namespace Framework
             bool hitEnemy = false;
             bool ineffectiveHit = false;
 
-            if (it->isProjectile && it->hitGraceTimer > 0.0f)
-                it->hitGraceTimer = std::max(0.0f, it->hitGraceTimer - dt);
+            if (HB->isProjectile && HB->hitGraceTimer > 0.0f)
+                HB->hitGraceTimer = std::max(0.0f, HB->hitGraceTimer - dt);
 
-            for (auto* obj : logic.LevelObjects())
-            {
-                if (!obj || obj == attacker) continue;
-                if (!layers.IsLayerEnabled(obj->GetLayerName())) continue;
-                auto* tr = obj->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
-                auto* rb = obj->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
-                if (!(tr && rb)) continue;
-
-                if (it->isProjectile && it->hitGraceTimer > 0.0f)
-                {
-                    const bool isPlayer = obj->GetComponentType<PlayerComponent>(
-                        ComponentTypeId::CT_PlayerComponent) != nullptr;
-                    const bool isEnemy = obj->GetComponentType<EnemyComponent>(
-                        ComponentTypeId::CT_EnemyComponent) != nullptr;
-                    if (!isPlayer && !isEnemy)
-                        continue;
-                }
+            // While a projectile is leaving its thrower it only reacts to characters.
+            std::uint32_t mask = HB->targetMask;
+            if (HB->isProjectile && HB->hitGraceTimer > 0.0f)
+                mask &= HurtCategory_Player | HurtCategory_Enemy;
 
-                AABB targetAABB(tr->x, tr->y, rb->width, rb->height);
-                if (!Collision::CheckCollisionRectToRect(hitboxAABB, targetAABB)) continue;
+            // Only the first collision per hitbox counts.
+            const int targetIndex = hurtIndex.FirstOverlap(hitboxAABB, mask, attacker);
+            if (targetIndex >= 0)
+            {
+                const HurtTarget& target = hurtIndex[targetIndex];
+                auto* obj = target.object;
+                auto* tr = target.transform;
+                auto* rb = target.body;
 
                 bool validTargetHit = false;
 
                 // Player hit logic
-                if (auto* playerHealth = obj->GetComponentType<PlayerHealthComponent>(ComponentTypeId::CT_PlayerHealthComponent))
+                if (auto* playerHealth = target.playerHealth)
                 {
                     if (!playerHealth->isInvulnerable)
                     {
                         playerHealth->TakeDamage(static_cast<int>(HB->damage));
                         validTargetHit = true;
-
-                        if (auto* audio = obj->GetComponentType<AudioComponent>(ComponentTypeId::CT_AudioComponent))
-                        {
-                            if (!playerHealth->isDead)
-                                audio->TriggerSound("PlayerHit");
-                            else if (!playerHealth->deathSoundPlayed)
-                            {
-                                audio->TriggerSound("PlayerDead");
-                                playerHealth->deathSoundPlayed = true;
-                            }
-                        }
+                        EventBus::Instance().Enqueue(HitLandedEvent{ attacker->GetId(), obj->GetId(),
+                            HitLandedEvent::Target::Player, playerHealth->isDead, tr->x, tr->y, HB->damage });
                     }
                 }
                 // Enemy hit logic
-                else if (auto* enemyHealth = obj->GetComponentType<EnemyHealthComponent>(ComponentTypeId::CT_EnemyHealthComponent))
+                else if (auto* enemyHealth = target.enemyHealth)
                 {
                     bool canHit = false;
 
-                    if (auto* typeComp = obj->GetComponentType<EnemyTypeComponent>(ComponentTypeId::CT_EnemyTypeComponent))
+                    if (auto* typeComp = target.enemyType)
                     {
                         if (typeComp->Etype == EnemyTypeComponent::EnemyType::physical && HB->team == HitBoxComponent::Team::Player)
                             canHit = true;
@@ -406,9 +453,8 @@ namespace Framework
                         enemyHealth->TakeDamage(static_cast<int>(HB->damage));
                         validTargetHit = true;
                         hitEnemy = true;
-                        SpawnHitImpactVFX(glm::vec2(tr->x, tr->y));
-                        if (auto* audio = obj->GetComponentType<AudioComponent>(ComponentTypeId::CT_AudioComponent))
-                        {audio->TriggerSound("EnemyHit");}
+                        EventBus::Instance().Enqueue(HitLandedEvent{ attacker->GetId(), obj->GetId(),
+                            HitLandedEvent::Target::Enemy, enemyHealth->enemyHealth <= 0, tr->x, tr->y, HB->damage });
                     }
                     else if (enemyHealth->enemyHealth > 0)
                     {
@@ -423,9 +469,7 @@ namespace Framework
                 // Apply knockback if valid hit
                 if (validTargetHit)
                 {
-                    bool isPlayer = obj->GetComponentType<PlayerComponent>(ComponentTypeId::CT_PlayerComponent) != nullptr;
-                    bool isEnemy = obj->GetComponentType<EnemyComponent>(ComponentTypeId::CT_EnemyComponent) != nullptr;
-                    if ((isPlayer || isEnemy))
+                    if (target.category & (HurtCategory_Player | HurtCategory_Enemy))
                     {
                         auto* attackerTr = attacker->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
                         if (attackerTr)
@@ -441,12 +485,11 @@ namespace Framework
                             rb->knockbackTime = 0.25f;
                         }
 
-                        PlayAnimationIfAvailable(obj, "knockback");
+                        PlayAnimationIfAvailable(obj, "knockback"_sid);
                     }
                 }
 
                 if (validTargetHit) hitAnything = true;
-                break; // Only first collision per hitbox
             }
 
             // Play air swing or ineffective sound if no enemy hit
@@ -469,12 +512,92 @@ namespace Framework
             }
 
             // Remove hitbox if hit or expired
-            if (hitAnything || it->timer <= 0.0f)
-                it = activeHitBoxes.erase(it);
+            if (hitAnything || HB->timer <= 0.0f)
+                ReleaseSlot(i);
             else
-                ++it;
+                ++i;
         }
     }
 
+    /*****************************************************************************************
+      \brief Time hitbox resolution for \p projectiles moving boxes against \p enemies static
+             hurtboxes, with the spatial index and with a linear scan.
+      \param projectiles Number of projectile hitboxes (0.1 x 0.1 units).
+      \param enemies     Number of enemy hurtboxes (0.2 x 0.3 units).
+      \param updates     Simulated updates at 60 Hz; projectiles wrap around the arena.
+      \return Average milliseconds per update for both paths.
+      \note  Layout is seeded, so consecutive runs are comparable. The grid timing includes
+             rebuilding the index every update, as Update() does.
+    *****************************************************************************************/
+    HitBoxSystem::StressResult HitBoxSystem::RunStressBenchmark(std::size_t projectiles,
+        std::size_t enemies, int updates)
+    {
+        using Clock = std::chrono::steady_clock;
+        constexpr float kArenaW = 24.0f;
+        constexpr float kArenaH = 8.0f;
+        constexpr float kDt = 1.0f / 60.0f;
+
+        StressResult result;
+        result.projectiles = projectiles;
+        result.enemies = enemies;
+        result.updates = std::max(1, updates);
+
+        std::mt19937 rng(1234u);
+        std::uniform_real_distribution<float> px(-kArenaW * 0.5f, kArenaW * 0.5f);
+        std::uniform_real_distribution<float> py(-kArenaH * 0.5f, kArenaH * 0.5f);
+        std::uniform_real_distribution<float> pv(-3.0f, 3.0f);
+
+        std::vector<HurtTarget> enemyTargets(enemies);
+        for (HurtTarget& t : enemyTargets)
+        {
+            t.category = HurtCategory_Enemy;
+            t.box = AABB(px(rng), py(rng), 0.2f, 0.3f);
+        }
+
+        struct Shot { float x, y, vx, vy; };
+        std::vector<Shot> shots(projectiles);
+        for (Shot& shot : shots)
+            shot = { px(rng), py(rng), pv(rng), pv(rng) };
+
+        const std::uint32_t mask = TargetMaskForTeam(HitBoxComponent::Team::Thrown);
+        auto wrap = [](float v, float half) { return v > half ? v - 2.0f * half : (v < -half ? v + 2.0f * half : v); };
+
+        auto run = [&](bool useGrid, std::size_t& hits)
+        {
+            std::vector<Shot> state = shots;
+            HurtBoxIndex index;
+            hits = 0;
+            const Clock::time_point start = Clock::now();
+            for (int u = 0; u < result.updates; ++u)
+            {
+                index.Clear();
+                for (const HurtTarget& t : enemyTargets)
+                    index.Add(t);
+
+                for (Shot& shot : state)
+                {
+                    shot.x = wrap(shot.x + shot.vx * kDt, kArenaW * 0.5f);
+                    shot.y = wrap(shot.y + shot.vy * kDt, kArenaH * 0.5f);
+                    const AABB box(shot.x, shot.y, 0.1f, 0.1f);
+                    const int hit = useGrid
+                        ? index.FirstOverlap(box, mask, nullptr)
+                        : index.FirstOverlapLinear(box, mask, nullptr);
+                    hits += (hit >= 0) ? 1u : 0u;
+                }
+            }
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / result.updates;
+        };
+
+        std::size_t gridHits = 0, linearHits = 0;
+        result.gridMs = run(true, gridHits);
+        result.linearMs = run(false, linearHits);
+        result.hits = gridHits;
+
+        std::cout << "[HitBoxSystem] Stress " << projectiles << " projectiles vs " << enemies
+            << " enemies: grid " << result.gridMs << " ms/update, linear " << result.linearMs
+            << " ms/update (" << gridHits << " hits"
+            << (gridHits == linearHits ? "" : ", MISMATCH with linear scan") << ")\n";
+        return result;
+    }
 
 } // namespace Framework
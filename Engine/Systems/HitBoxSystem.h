@@ -3,7 +3,7 @@
  \par       SofaSpuds
  \author	Ho Jun (h.jun@digipen.edu) - Primary Author, 100%
  \brief     Spawns and manages temporary attack hitboxes for damage interactions.
- \details   Maintains an active list of one-shot hitboxes created by enemy or player attacks.
+ \details   Maintains a fixed-capacity pool of one-shot hitboxes created by enemy or player attacks.
 			Each hitbox persists for a short duration, moves relative to its owner, and
 			checks for overlap against hurtboxes on other objects. Once the hitbox expires
 			or applies damage, it is removed from the active list. Driven by LogicSystem and
@@ -16,6 +16,12 @@
 #include "Composition/Component.h"
 #include "LogicSystem.h"
 #include "Component/HitBoxComponent.h"
+#include "Systems/HurtBoxIndex.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
 
 namespace Framework
 {
@@ -35,18 +41,44 @@ namespace Framework
 		/*************************************************************************
 		  \struct ActiveHitBox
 		  \brief  Represents a currently active attack hitbox instance.
-		  \details Holds ownership of a HitBoxComponent, reference to the owner
-				   object, and a timer controlling hitbox lifetime.
+		  \details Plain data stored by value in the system's fixed-capacity pool;
+				   spawning or expiring a hitbox never touches the heap.
 		*************************************************************************/
 		struct ActiveHitBox {
-			std::unique_ptr<HitBoxComponent> hitbox;
-			GOCId ownerId = 0;        // store id, not raw pointer
-			float timer = 0.0f;
+			float spawnX = 0.0f;		// world-space center
+			float spawnY = 0.0f;
+			float width = 0.0f;
+			float height = 0.0f;
+			float damage = 0.0f;
+			float duration = 0.0f;		// total lifetime (for animation)
+			float timer = 0.0f;			// remaining lifetime
 			float hitGraceTimer = 0.0f;
+			float soundDelay = 0.0f;
 
 			float velX = 0.0f;
 			float velY = 0.0f;
+			GOCId ownerId = 0;			// store id, not raw pointer
+			std::uint32_t targetMask = HurtCategory_All;	// HurtCategory bits this hitbox can hit
+			HitBoxComponent::Team team = HitBoxComponent::Team::Neutral;
 			bool isProjectile = false;
+			bool soundTriggered = false;
+		};
+		static_assert(std::is_trivially_copyable_v<ActiveHitBox>, "ActiveHitBox must stay POD for swap-and-pop");
+
+		/// Pool capacity; spawns beyond this are dropped (and counted) instead of allocating.
+		static constexpr std::size_t kMaxActiveHitBoxes = 1024;
+
+		/*************************************************************************
+		  \struct StressResult
+		  \brief  Timings from RunStressBenchmark(), in milliseconds per update.
+		*************************************************************************/
+		struct StressResult {
+			std::size_t projectiles = 0;
+			std::size_t enemies = 0;
+			int updates = 0;
+			double gridMs = 0.0;		// spatial index: rebuild + queries
+			double linearMs = 0.0;		// same queries as a linear scan
+			std::size_t hits = 0;		// overlaps found per run (identical for both)
 		};
 		/*************************************************************************
 		 \brief  Construct the hitbox system with access to logic/scene queries.
@@ -103,11 +135,50 @@ namespace Framework
 		/*************************************************************************
 		  \brief  Access the current active hitboxes (read-only).
 		*************************************************************************/
-		const std::vector<ActiveHitBox>& GetActiveHitBoxes() const { return activeHitBoxes; }
+		std::span<const ActiveHitBox> GetActiveHitBoxes() const { return { activeHitBoxes.data(), activeCount }; }
+
+		/*************************************************************************
+		  \brief  Spawns rejected because the pool was full (since Initialize).
+		*************************************************************************/
+		std::size_t GetDroppedSpawnCount() const { return droppedSpawns; }
+
+		/*************************************************************************
+		  \brief  HurtCategory bits a hitbox of \p team may interact with.
+		  \note   Teams never hit their own side; solid "other" objects still
+				   absorb a hit, as before.
+		*************************************************************************/
+		static std::uint32_t TargetMaskForTeam(HitBoxComponent::Team team);
+
+		/*************************************************************************
+		  \brief  Combat stress benchmark: moving projectiles vs. static enemies.
+		  \details Resolves every projectile against synthetic enemy hurtboxes
+				   once through the spatial index and once by linear scan, over
+				   \p updates simulated frames. No game objects are touched.
+		*************************************************************************/
+		static StressResult RunStressBenchmark(std::size_t projectiles = 1000,
+			std::size_t enemies = 500, int updates = 120);
 
 	private:
+		/*************************************************************************
+		  \brief  Snapshot hurtable level objects into the spatial index.
+		*************************************************************************/
+		void BuildHurtIndex();
+
+		/*************************************************************************
+		  \brief  Claim the next pool slot, or null (and count a drop) if full.
+		*************************************************************************/
+		ActiveHitBox* AcquireSlot();
+
+		/*************************************************************************
+		  \brief  Remove slot \p index by moving the last active entry into it.
+		*************************************************************************/
+		void ReleaseSlot(std::size_t index);
+
 		LogicSystem& logic;							//!< Access to objects and scene queries.
-		std::vector<ActiveHitBox> activeHitBoxes;	//!< List of currently active hitboxes.
+		std::array<ActiveHitBox, kMaxActiveHitBoxes> activeHitBoxes{};	//!< Pool; [0, activeCount) are live.
+		std::size_t activeCount = 0;				//!< Number of live entries at the front of the pool.
+		std::size_t droppedSpawns = 0;				//!< Spawns rejected because the pool was full.
+		HurtBoxIndex hurtIndex;						//!< Rebuilt each Update() with active hitboxes.
 	};
 
 
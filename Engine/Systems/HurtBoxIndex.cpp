@@ -0,0 +1,82 @@
+/*********************************************************************************************
+ \file      HurtBoxIndex.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements HurtBoxIndex: grid insertion, filtered first-overlap queries and the
+            linear reference query.
+ \details   Grid entries are target indices. A target that spans several cells can come
+            back more than once from a query. That is harmless, because the query keeps the
+            smallest accepted index.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Systems/HurtBoxIndex.h"
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    HurtBoxIndex::HurtBoxIndex()
+        : grid(kCellSize)
+    {
+    }
+
+    void HurtBoxIndex::Clear()
+    {
+        targets.clear();
+        grid.Clear();
+    }
+
+    void HurtBoxIndex::Add(const HurtTarget& target)
+    {
+        grid.Insert(static_cast<GOCId>(targets.size()), target.box);
+        targets.push_back(target);
+    }
+
+    /*****************************************************************************************
+      \brief Cheap rejects first (category bit, owner), then the AABB narrow phase.
+    *****************************************************************************************/
+    bool HurtBoxIndex::Accepts(const HurtTarget& target, const AABB& box, std::uint32_t mask,
+        const GameObjectComposition* exclude) const
+    {
+        if ((target.category & mask) == 0)
+            return false;
+        if (exclude && target.object == exclude)
+            return false;
+        return Collision::CheckCollisionRectToRect(box, target.box);
+    }
+
+    int HurtBoxIndex::FirstOverlap(const AABB& box, std::uint32_t mask, const GameObjectComposition* exclude) const
+    {
+        if (targets.empty() || mask == 0)
+            return -1;
+
+        grid.Query(box, candidates);
+
+        int best = -1;
+        for (GOCId id : candidates)
+        {
+            const int index = static_cast<int>(id);
+            if (best >= 0 && index >= best)
+                continue;
+            if (Accepts(targets[id], box, mask, exclude))
+                best = index;
+        }
+        return best;
+    }
+
+    int HurtBoxIndex::FirstOverlapLinear(const AABB& box, std::uint32_t mask, const GameObjectComposition* exclude) const
+    {
+        for (std::size_t i = 0; i < targets.size(); ++i)
+        {
+            if (Accepts(targets[i], box, mask, exclude))
+                return static_cast<int>(i);
+        }
+        return -1;
+    }
+}
@@ -0,0 +1,105 @@
+/*********************************************************************************************
+ \file      HurtBoxIndex.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Per-frame spatial index of damageable objects used to resolve attack hitboxes.
+ \details   HitBoxSystem rebuilds the index once per update from the level objects. Each
+            entry snapshots the object's AABB, caches the component pointers the hit logic
+            needs, and records a category bit (player / enemy / other). Objects on disabled
+            layers never enter the index.
+
+            A query runs three stages:
+            - Broad phase: UniformGrid lookup of the cells the hitbox overlaps.
+            - Filter: category bitmask and owner exclusion (integer tests only).
+            - Narrow phase: AABB overlap.
+            The query returns the overlapping entry that was added first. That is the same
+            target the old linear walk over LogicSystem::LevelObjects() hit first.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "Systems/UniformGrid.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Framework
+{
+    class GameObjectComposition;
+    class TransformComponent;
+    class RigidBodyComponent;
+    class PlayerHealthComponent;
+    class EnemyHealthComponent;
+    class EnemyTypeComponent;
+
+    /// Target categories used by hitbox team masks.
+    enum HurtCategory : std::uint32_t
+    {
+        HurtCategory_Player = 1u << 0,
+        HurtCategory_Enemy = 1u << 1,
+        HurtCategory_Other = 1u << 2,   ///< Solid objects without Player/Enemy components
+        HurtCategory_All = HurtCategory_Player | HurtCategory_Enemy | HurtCategory_Other
+    };
+
+    /*****************************************************************************************
+      \struct HurtTarget
+      \brief  Snapshot of one damageable object for the current update.
+    *****************************************************************************************/
+    struct HurtTarget
+    {
+        GameObjectComposition* object = nullptr;
+        AABB                   box{ 0.0f, 0.0f, 0.0f, 0.0f };
+        std::uint32_t          category = HurtCategory_Other;
+
+        TransformComponent*    transform = nullptr;
+        RigidBodyComponent*    body = nullptr;
+        PlayerHealthComponent* playerHealth = nullptr;
+        EnemyHealthComponent*  enemyHealth = nullptr;
+        EnemyTypeComponent*    enemyType = nullptr;
+    };
+
+    /*****************************************************************************************
+      \class HurtBoxIndex
+      \brief Uniform-grid index over HurtTargets with first-hit queries.
+    *****************************************************************************************/
+    class HurtBoxIndex
+    {
+    public:
+        /// Cell size in world units. Level objects are roughly 0.1 - 0.5 units wide.
+        static constexpr float kCellSize = 0.5f;
+
+        HurtBoxIndex();
+
+        /// Drop all entries. Grid cell storage is kept for the next build.
+        void Clear();
+
+        /// Append a target. Entries added earlier win ties in FirstOverlap().
+        void Add(const HurtTarget& target);
+
+        /*************************************************************************************
+          \brief Find the earliest-added target that overlaps \a box.
+          \param box     Hitbox bounds.
+          \param mask    HurtCategory bits the hitbox may interact with.
+          \param exclude Object to skip (the attacker), may be null.
+          \return Index of the target, or -1 if nothing overlaps.
+        *************************************************************************************/
+        int FirstOverlap(const AABB& box, std::uint32_t mask, const GameObjectComposition* exclude) const;
+
+        /// Same result as FirstOverlap() via a linear scan; used as the benchmark baseline.
+        int FirstOverlapLinear(const AABB& box, std::uint32_t mask, const GameObjectComposition* exclude) const;
+
+        const HurtTarget& operator[](int index) const { return targets[static_cast<std::size_t>(index)]; }
+        std::size_t Size() const { return targets.size(); }
+        bool Empty() const { return targets.empty(); }
+
+    private:
+        bool Accepts(const HurtTarget& target, const AABB& box, std::uint32_t mask,
+            const GameObjectComposition* exclude) const;
+
+        std::vector<HurtTarget> targets;
+        UniformGrid             grid;
+        mutable std::vector<GOCId> candidates;   ///< Query scratch, reused across calls
+    };
+}
@@ -12,6 +12,7 @@
 *********************************************************************************************/
 
 #include "InputSystem.h"
+#include "Input/InputRecorder.h"
 #if defined(APIENTRY)
 #  undef APIENTRY
 #endif
@@ -82,10 +83,12 @@ namespace Framework
 
 	/*************************************************************************************
 	  \brief  Shutdown input system by clearing window reference.
-	  \note   Does not destroy input state; simply prevents further polling.
+	  \note   Does not destroy input state; simply prevents further polling. An input
+	          recording is flushed here, and an unfinished replay writes its results.
 	*************************************************************************************/
 	void InputSystem::Shutdown()
 	{
+		InputRecorder::Stop();
 		window = nullptr;
 	}
 
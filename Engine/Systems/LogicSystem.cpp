@@ -9,7 +9,8 @@
  \brief     Core gameplay loop and input-driven logic for the sample sandbox.
  \details   This module owns high-level game state orchestration:
             - Factory lifetime: component registration, prefab loading/unloading, level create/destroy.
-            - Player references: discovery, cached size for scale operations, animation state machine.
+            - Player references: discovery, cached size for scale operations, and the signals
+              (dead / knockback / attack / moving) that drive the player's AnimStateMachine.
             - Input mapping: WASD movement, Q/E rotation, Z/X scale, R reset, Shift accelerator.
             - HitBoxSystem integration: spawns short-lived attack boxes towards cursor on LMB.
             - Crash logging utilities: F9 forces a safe, logged crash for robustness testing.
@@ -18,7 +19,8 @@
             Performance & stability:
             * Uses TryGuard::Run to isolate Update() logic and attribute errors with a tag.
             * Minimizes per-frame object lookups by caching player/targets (validated via IsAlive()).
-            * Time-based animation frame stepping decoupled from render rate via fps in AnimConfig.
+            * Animation states and clip switches come from the data-driven "player" state
+              machine (Data_Files/Animation/player.json); AnimationSystem advances the frames.
 
             Conventions:
             * Screen coordinates are mapped to world space via RenderSystem::ScreenToWorld().
@@ -32,16 +34,19 @@
 #include "Systems/RenderSystem.h"      // for ScreenToWorld / camera-based world mapping
 #include "Debug/Selection.h"
 #include "Debug/Spawn.h"
-#include "Systems/VfxHelpers.h"
 #include "Memory/GameObjectPool.h"
+#include "Memory/LevelArena.h"
+#include "Debug/Profiler.h"
 #include "Resource_Asset_Manager/Resource_Manager.h"
 #include "Systems/ParticleSystem.h"
+#include "Input/InputRecorder.h"
 #include <cctype>
 #include <string>
 #include <string_view>
 #include <csignal>
 #include <cmath>
 #include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <iostream>
 #include <Debug/UndoStack.h>
@@ -66,77 +71,59 @@ namespace Framework {
     /// Defaulted virtual destructor; shuts down via Shutdown().
     LogicSystem::~LogicSystem() = default;
 
-    /*****************************************************************************************
-      \brief Get the currently active animation configuration (idle / run / attacks).
-    *****************************************************************************************/
-    const LogicSystem::AnimConfig& LogicSystem::CurrentConfig() const
+    namespace
     {
-        return ConfigForState(animState);
+        /// Player machine state names, indexed by LogicSystem::AnimationInfo::Mode.
+        constexpr std::string_view kModeStateNames[] = {
+            "idle", "run", "attack1", "attack2", "attack3", "throw", "knockback", "death" };
     }
 
-    const LogicSystem::AnimConfig& LogicSystem::ConfigForState(AnimState state) const
+    /*****************************************************************************************
+      \brief Built-in sheet layout for a mode, used when the player has no clip for it.
+    *****************************************************************************************/
+    const LogicSystem::AnimConfig& LogicSystem::FallbackConfig(Mode mode) const
     {
-        switch (state)
+        switch (mode)
         {
-        case AnimState::Idle:      return idleConfig;
-        case AnimState::Run:       return runConfig;
-        case AnimState::Attack1:   return attackConfigs[0];
-        case AnimState::Attack2:   return attackConfigs[1];
-        case AnimState::Attack3:   return attackConfigs[2];
-        case AnimState::Throw:     return throwConfig;
-        case AnimState::Knockback: return knockbackConfig;
-        case AnimState::Death:     return deathConfig;
+        case Mode::Idle:      return idleConfig;
+        case Mode::Run:       return runConfig;
+        case Mode::Attack1:   return attackConfigs[0];
+        case Mode::Attack2:   return attackConfigs[1];
+        case Mode::Attack3:   return attackConfigs[2];
+        case Mode::Throw:     return throwConfig;
+        case Mode::Knockback: return knockbackConfig;
+        case Mode::Death:     return deathConfig;
         }
         // Fallback
         return idleConfig;
     }
 
-    bool LogicSystem::IsAttackState(AnimState state) const
-    {
-        return state == AnimState::Attack1 ||
-            state == AnimState::Attack2 ||
-            state == AnimState::Attack3 ||
-            state == AnimState::Throw;
-    }
-
-    void LogicSystem::SetAnimState(AnimState newState)
+    bool LogicSystem::IsAttackMode(Mode mode) const
     {
-        if (animState == newState)
-        {
-            ApplyAnimationStateToComponent(newState);
-            return;
-        }
-
-        animState = newState;
-        frame = 0;
-        frameClock = 0.f;
-
-        ApplyAnimationStateToComponent(newState);
+        return mode == Mode::Attack1 ||
+            mode == Mode::Attack2 ||
+            mode == Mode::Attack3 ||
+            mode == Mode::Throw;
     }
 
-    LogicSystem::AnimState LogicSystem::AttackStateForIndex(int comboIndex) const
+    LogicSystem::Mode LogicSystem::AttackModeForIndex(int comboIndex) const
     {
         // Wrap combo index into [0,2]
         const int wrapped = ((comboIndex - 1) % 3 + 3) % 3;
         switch (wrapped)
         {
-        case 0:  return AnimState::Attack1;
-        case 1:  return AnimState::Attack2;
-        default: return AnimState::Attack3;
+        case 0:  return Mode::Attack1;
+        case 1:  return Mode::Attack2;
+        default: return Mode::Attack3;
         }
     }
 
-    float LogicSystem::AttackDurationForState(AnimState state) const
+    float LogicSystem::AttackDurationForMode(Mode mode)
     {
-        if (!IsAttackState(state))
+        if (!IsAttackMode(mode))
             return 0.f;
-        const SpriteAnimationComponent* anim = nullptr;
-        if (IsAlive(player))
-        {
-            anim = player->GetComponentType<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent);
-        }
 
-        const AnimConfig cfg = ConfigFromSpriteSheet(anim, state);
+        const AnimConfig cfg = ConfigForMode(mode);
 
         if (cfg.fps <= 0.f)
             return 0.f;
@@ -147,9 +134,8 @@ namespace Framework {
     void LogicSystem::ForceAttackState(int comboIndex)
     {
         comboStep = ((comboIndex - 1) % 3 + 3) % 3 + 1;   // store 1..3 for bookkeeping
-        AnimState nextState = AttackStateForIndex(comboStep);
-        SetAnimState(nextState);
-        attackTimer = AttackDurationForState(nextState);
+        attackMode = AttackModeForIndex(comboStep);
+        attackTimer = AttackDurationForMode(attackMode);
     }
 
     void LogicSystem::BeginComboAttack()
@@ -160,78 +146,62 @@ namespace Framework {
 
     void LogicSystem::BeginThrowAttack()
     {
-        SetAnimState(AnimState::Throw);
-        attackTimer = AttackDurationForState(AnimState::Throw);
-    }
-
-    LogicSystem::AnimationInfo::Mode LogicSystem::ModeForState(AnimState state) const
-    {
-        switch (state)
-        {
-        case AnimState::Run:       return AnimationInfo::Mode::Run;
-        case AnimState::Attack1:   return AnimationInfo::Mode::Attack1;
-        case AnimState::Attack2:   return AnimationInfo::Mode::Attack2;
-        case AnimState::Attack3:   return AnimationInfo::Mode::Attack3;
-        case AnimState::Throw:     return AnimationInfo::Mode::Throw;
-        case AnimState::Knockback: return AnimationInfo::Mode::Knockback;
-        case AnimState::Death:     return AnimationInfo::Mode::Death;
-        case AnimState::Idle:
-        default:                 return AnimationInfo::Mode::Idle;
-        }
+        attackMode = Mode::Throw;
+        attackTimer = AttackDurationForMode(Mode::Throw);
     }
 
-    std::string_view LogicSystem::AnimNameForState(AnimState state) const
+    SpriteAnimationComponent* LogicSystem::PlayerAnimation() const
     {
-        switch (state)
-        {
-        case AnimState::Run:       return "run";
-        case AnimState::Attack1:   return "attack1";
-        case AnimState::Attack2:   return "attack2";
-        case AnimState::Attack3:   return "attack3";
-        case AnimState::Throw:     return "throw";
-        case AnimState::Knockback: return "knockback";
-        case AnimState::Death:     return "death";
-        case AnimState::Idle:
-        default:                 return "idle";
-        }
+        if (!IsAlive(player))
+            return nullptr;
+        return player->GetComponentType<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent);
     }
 
-    int LogicSystem::AnimationIndexForState(const SpriteAnimationComponent* comp, AnimState state) const
+    /*****************************************************************************************
+      \brief Bind the player's state machine (the prefab's "stateMachine", else the built-in
+             "player" machine) and, when it changed, look up our signals and states by name.
+    *****************************************************************************************/
+    AnimStateMachineInstance* LogicSystem::PlayerStateMachine(SpriteAnimationComponent& anim)
     {
-        if (!comp)
-            return -1;
-
-        auto equalsIgnoreCase = [](std::string_view a, std::string_view b)
-            {
-                if (a.size() != b.size())
-                    return false;
-                for (std::size_t i = 0; i < a.size(); ++i)
-                {
-                    unsigned char c1 = static_cast<unsigned char>(a[i]);
-                    unsigned char c2 = static_cast<unsigned char>(b[i]);
-                    if (std::tolower(c1) != std::tolower(c2))
-                        return false;
-                }
-                return true;
-            };
+        AnimStateMachineInstance* machine = anim.BoundStateMachine(AnimStateMachineLibrary::kPlayerMachine);
+        if (!machine)
+            return nullptr;
 
-        const std::string_view desired = AnimNameForState(state);
-        for (std::size_t i = 0; i < comp->animations.size(); ++i)
+        const AnimStateMachineAsset* asset = machine->Asset();
+        if (playerMachine.asset == asset && playerMachine.revision == asset->Revision())
+            return machine;
+
+        playerMachine = PlayerMachineBinding{};
+        playerMachine.asset = asset;
+        playerMachine.revision = asset->Revision();
+        playerMachine.dead = asset->SignalBit(StringId::Folded("dead"));
+        playerMachine.knockback = asset->SignalBit(StringId::Folded("knockback"));
+        playerMachine.moving = asset->SignalBit(StringId::Folded("moving"));
+        playerMachine.modeForState.assign(asset->states.size(), Mode::Idle);
+        for (int i = 0; i < kModeCount; ++i)
         {
-            if (equalsIgnoreCase(comp->animations[i].name, desired))
-                return static_cast<int>(i);
+            const StringId name = StringId::Folded(kModeStateNames[i]);
+            if (IsAttackMode(static_cast<Mode>(i)))
+                playerMachine.attackSignal[i] = asset->SignalBit(name);
+            playerMachine.stateForMode[i] = asset->FindState(name);
+            if (playerMachine.stateForMode[i] >= 0)
+                playerMachine.modeForState[static_cast<std::size_t>(playerMachine.stateForMode[i])] = static_cast<Mode>(i);
         }
-
-        return -1;
+        return machine;
     }
 
-    LogicSystem::AnimConfig LogicSystem::ConfigFromSpriteSheet(const SpriteAnimationComponent* comp, AnimState state) const
+    /*****************************************************************************************
+      \brief Layout and fps of the clip the player machine plays for \p mode.
+    *****************************************************************************************/
+    LogicSystem::AnimConfig LogicSystem::ConfigForMode(Mode mode)
     {
-        AnimConfig cfg = ConfigForState(state);
-        if (!comp)
+        AnimConfig cfg = FallbackConfig(mode);
+        SpriteAnimationComponent* comp = PlayerAnimation();
+        AnimStateMachineInstance* machine = comp ? PlayerStateMachine(*comp) : nullptr;
+        if (!machine)
             return cfg;
 
-        const int index = AnimationIndexForState(comp, state);
+        const int index = machine->ClipForState(playerMachine.stateForMode[static_cast<int>(mode)]);
         if (index < 0 || index >= static_cast<int>(comp->animations.size()))
             return cfg;
 
@@ -243,20 +213,6 @@ namespace Framework {
         return cfg;
     }
 
-    void LogicSystem::ApplyAnimationStateToComponent(AnimState state)
-    {
-        if (!IsAlive(player))
-            return;
-
-        auto* anim = player->GetComponentType<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent);
-        if (!anim)
-            return;
-
-        const int index = AnimationIndexForState(anim, state);
-        if (index >= 0 && index != anim->ActiveAnimationIndex())
-            anim->SetActiveAnimation(index);
-    }
-
     /*****************************************************************************************
       \brief Check if a given object pointer still exists in the factory.
       \param obj Candidate object pointer.
@@ -343,25 +299,11 @@ namespace Framework {
 
         gateController.SetPlayer(player);
 
-        auto nameEqualsIgnoreCase = [](const std::string& lhs, std::string_view rhs)
-            {
-                if (lhs.size() != rhs.size())
-                    return false;
-                for (std::size_t i = 0; i < lhs.size(); ++i)
-                {
-                    unsigned char c1 = static_cast<unsigned char>(lhs[i]);
-                    unsigned char c2 = static_cast<unsigned char>(rhs[i]);
-                    if (std::tolower(c1) != std::tolower(c2))
-                        return false;
-                }
-                return true;
-            };
-
         if (!collisionTarget)
         {
             for (auto* obj : levelObjects)
             {
-                if (obj && nameEqualsIgnoreCase(obj->GetObjectName(), "rect"))
+                if (obj && obj->GetObjectNameId() == StringId::Folded("rect"))
                 {
                     collisionTarget = obj;
                     break;
@@ -373,17 +315,14 @@ namespace Framework {
     }
 
     /*****************************************************************************************
-      \brief Step the sprite-sheet animation based on desired state (idle/run/attacks).
+      \brief Update the player's combat timers, turn them into state machine signals and step
+             the machine, which switches the clip when the state changes.
       \param dt      Delta time (seconds).
       \param wantRun Whether the input implies running (vs idle).
     *****************************************************************************************/
     void LogicSystem::UpdateAnimation(float dt, bool wantRun)
     {
-        SpriteAnimationComponent* animComp = nullptr;
-        if (IsAlive(player))
-        {
-            animComp = player->GetComponentType<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent);
-        }
+        SpriteAnimationComponent* animComp = PlayerAnimation();
         auto* rb = IsAlive(player)
             ? player->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent)
             : nullptr;
@@ -402,11 +341,10 @@ namespace Framework {
         if (playerDead)
         {
             knockbackAnimTimer = 0.0f;
-            SetAnimState(AnimState::Death);
         }
         else if (rb && rb->knockbackTime > 0.0f)
         {
-            if (animState != AnimState::Knockback)
+            if (animInfo.mode != Mode::Knockback)
             {
                 pendingThrow.active = false;
                 throwRequestQueued = false;
@@ -414,46 +352,43 @@ namespace Framework {
             }
             if (knockbackAnimTimer <= 0.0f)
             {
-                const AnimConfig cfg = ConfigFromSpriteSheet(animComp, AnimState::Knockback);
+                const AnimConfig cfg = ConfigForMode(Mode::Knockback);
                 const float fps = cfg.fps > 0.0f ? cfg.fps : 1.0f;
                 knockbackAnimTimer = static_cast<float>(cfg.frames) / fps;
             }
-            SetAnimState(AnimState::Knockback);
-        }
-        else if (knockbackAnimTimer > 0.0f)
-        {
-            SetAnimState(AnimState::Knockback);
-        }
-        // If we are in an attack animation, let it run to completion.
-        else if (IsAttackState(animState))
-        {
-            attackTimer -= dt;
-            if (attackTimer <= 0.f)
-            {
-                attackTimer = 0.f;
-                AnimState desired = wantRun ? AnimState::Run : AnimState::Idle;
-                SetAnimState(desired);
-            }
         }
-        else
+        // An attack runs to completion unless something above interrupts it.
+        else if (knockbackAnimTimer <= 0.0f && attackTimer > 0.f)
         {
-            AnimState desired = wantRun ? AnimState::Run : AnimState::Idle;
-            SetAnimState(desired);
+            attackTimer = std::max(0.f, attackTimer - dt);
         }
 
-        const AnimConfig cfg = ConfigFromSpriteSheet(animComp, animState);
-        frameClock += dt * cfg.fps;
-        while (frameClock >= 1.f)
+        Mode mode = Mode::Idle;
+        AnimStateMachineInstance* machine = animComp ? PlayerStateMachine(*animComp) : nullptr;
+        if (machine)
         {
-            frameClock -= 1.f;
-            frame = (frame + 1) % cfg.frames;
+            std::uint32_t signals = 0;
+            if (playerDead)
+                signals |= playerMachine.dead;
+            if (!playerDead && ((rb && rb->knockbackTime > 0.0f) || knockbackAnimTimer > 0.0f))
+                signals |= playerMachine.knockback;
+            if (attackTimer > 0.f)
+                signals |= playerMachine.attackSignal[static_cast<int>(attackMode)];
+            if (wantRun)
+                signals |= playerMachine.moving;
+
+            const int state = machine->Step(*animComp, signals);
+            if (state >= 0 && state < static_cast<int>(playerMachine.modeForState.size()))
+                mode = playerMachine.modeForState[static_cast<std::size_t>(state)];
         }
 
-        animInfo.frame = frame;
-        animInfo.columns = cfg.cols;
-        animInfo.rows = cfg.rows;
-        animInfo.mode = ModeForState(animState);
-        animInfo.running = (animState == AnimState::Run);
+        const AnimConfig fallback = FallbackConfig(mode);
+        const auto* clip = animComp ? animComp->ActiveAnimation() : nullptr;
+        animInfo.frame = clip ? clip->currentFrame : 0;
+        animInfo.columns = clip ? std::max(1, clip->config.columns) : fallback.cols;
+        animInfo.rows = clip ? std::max(1, clip->config.rows) : fallback.rows;
+        animInfo.mode = mode;
+        animInfo.running = (mode == Mode::Run);
     }
 
     /*****************************************************************************************
@@ -477,6 +412,21 @@ namespace Framework {
         return true;
     }
 
+    bool LogicSystem::GetPlayerPreviousPosition(float& outX, float& outY) const
+    {
+        if (!IsAlive(player))
+            return false;
+
+        auto* tr = player->GetComponentType<Framework::TransformComponent>(
+            Framework::ComponentTypeId::CT_TransformComponent);
+        if (!tr)
+            return false;
+
+        outX = tr->hasPrev ? tr->prevX : tr->x;
+        outY = tr->hasPrev ? tr->prevY : tr->y;
+        return true;
+    }
+
     std::filesystem::path LogicSystem::resolveData(std::string_view name) const
     {
         return Framework::ResolveDataPath(std::filesystem::path(name));
@@ -544,6 +494,10 @@ namespace Framework {
             startLevelPath = requestedPath.is_absolute() ? requestedPath : resolveData(startLevelName);
         }
 #endif
+        // Input replays start on the level they were recorded on.
+        if (const std::string replayLevel = InputRecorder::ReplayStartLevel(); !replayLevel.empty())
+            startLevelPath = resolveData(replayLevel);
+        InputRecorder::NoteStartLevel(startLevelPath.filename().string());
 
         levelObjects = factory->CreateLevel(startLevelPath.string());
 
@@ -635,6 +589,8 @@ namespace Framework {
             "fire_death",
             Framework::ResolveAssetPath("Textures/Character/Fire Enemy_Sprite/Death_Sprite.png").string()
         );
+        for (const char* key : { "fire_idle", "fire_attack", "fire_projectile", "fire_knockback", "fire_death" })
+            Resource_Manager::Pin(key); // preloaded on purpose; keep resident across levels
 
         std::cout << "\n=== Controls ===\n"
             << "WASD: Move | Q/E: Rotate | Z/X: Scale | R: Reset\n"
@@ -649,7 +605,7 @@ namespace Framework {
     }
 
     /*****************************************************************************************
-      \brief Per-frame update: input handling, physics intent, animation stepping, hitbox spawn,
+      \brief Per-frame update: input handling, physics intent, player animation state, hitbox spawn,
              collision AABB bookkeeping, and crash-test handling.
       \param dt Delta time (seconds).
     *****************************************************************************************/
@@ -682,81 +638,6 @@ namespace Framework {
             if (input.IsKeyPressed(GLFW_KEY_P))
                 std::cout << "Number of enemies alive: " << enemiesAlive << "\n";
 
-            std::vector<GOC*> finishedVfx;
-
-            auto AdvanceSpriteAnimations = [&](float step)
-                {
-                    if (!factory)
-                        return;
-
-                    for (auto& [id, objPtr] : factory->Objects())
-                    {
-                        (void)id;
-                        auto* obj = objPtr.get();
-                        if (!obj)
-                            continue;
-
-                        auto* anim = obj->GetComponentType<Framework::SpriteAnimationComponent>(
-                            Framework::ComponentTypeId::CT_SpriteAnimationComponent);
-                        if (!anim || (!anim->HasFrames() && !anim->HasSpriteSheets()))
-                            continue;
-
-                        anim->Advance(step);
-
-                        auto* sprite = obj->GetComponentType<Framework::SpriteComponent>(
-                            Framework::ComponentTypeId::CT_SpriteComponent);
-                        if (!sprite)
-                            continue;
-
-                        if (anim->HasSpriteSheets())
-                        {
-                            auto sample = anim->CurrentSheetSample();
-                            if (!sample.textureKey.empty())
-                                sprite->texture_key = sample.textureKey;
-                            if (sample.texture)
-                                sprite->texture_id = sample.texture;
-                        }
-                        else
-                        {
-                            size_t frameIndex = anim->CurrentFrameIndex();
-                            if (frameIndex >= anim->frames.size())
-                                continue;
-
-                            const auto& frame = anim->frames[frameIndex];
-                            sprite->texture_key = frame.texture_key;
-                            unsigned tex = anim->ResolveFrameTexture(frameIndex);
-                            if (tex)
-                                sprite->texture_id = tex;
-                        }
-                        if (IsImpactVfxObject(obj))
-                        {
-                            if (auto* active = anim->ActiveAnimation())
-                            {
-                                if (!active->config.loop && active->name == "impact")
-                                {
-                                    const int total = std::max(1, active->config.totalFrames);
-                                    const int start = std::clamp(active->config.startFrame, 0, total - 1);
-                                    const int end = (active->config.endFrame >= 0)
-                                        ? std::clamp(active->config.endFrame, start, total - 1)
-                                        : total - 1;
-
-                                    const int current = std::clamp(active->currentFrame, 0, total - 1);
-                                    if (current >= end)
-                                        finishedVfx.push_back(obj);
-                                }
-                            }
-                        }
-                    }
-                };
-
-            AdvanceSpriteAnimations(dt);
-
-            for (auto* vfx : finishedVfx)
-            {
-                if (factory)
-                    factory->Destroy(vfx);
-            }
-
             // --- Enemy loop: reacts to player's ACTIVE hitbox if both sides are valid ---
             for (auto* obj : levelObjects)
             {
@@ -962,7 +843,7 @@ namespace Framework {
             }
             else if (playerHealth && !playerHealth->isDead && throwRequestQueued && attack && tr && rc)
             {
-                const bool canThrow = throwCooldownTimer <= 0.0f && !pendingThrow.active && !IsAttackState(animState);
+                const bool canThrow = throwCooldownTimer <= 0.0f && !pendingThrow.active && attackTimer <= 0.0f;
 
                 // Only spawn if we have a valid direction (mouse in viewport & not exactly on player).
                 if (canThrow && (aimDirX != 0.0f || aimDirY != 0.0f))
@@ -982,7 +863,7 @@ namespace Framework {
                     pendingThrow.dirY = aimDirY;
 
                     BeginThrowAttack();
-                    throwCooldownTimer = std::max(throwCooldownTimer, AttackDurationForState(AnimState::Throw));
+                    throwCooldownTimer = std::max(throwCooldownTimer, AttackDurationForMode(Mode::Throw));
                     throwRequestQueued = false;
                 }
             }
@@ -1052,7 +933,9 @@ namespace Framework {
     {
         if (!factory)
             return;
+        PROFILE_SCOPE("LogicSystem::LoadLevel");
 
+        const auto loadStart = std::chrono::steady_clock::now();
         for (auto const& [id, obj] : factory->Objects())
         {
             (void)id;
@@ -1062,22 +945,35 @@ namespace Framework {
         factory->Update(0.0f);
 
         {
-            const unsigned pagesFreed = Framework::GameObjectPool::Storage().Allocator().FreeEmptyPages();
+            const unsigned pagesFreed = Framework::GameObjectPool::Storage().TrimEmptyPages();
             if (pagesFreed > 0) {
                 std::cout << "[Allocator] FreeEmptyPages trimmed " << pagesFreed
                     << " empty pages after level unload.\n";
             }
         }
 
+        // CreateLevel hands the old level's arena back in one go (LevelArena::BeginLevel).
         levelObjects = factory->CreateLevel(levelPath.string());
+        {
+            const LevelArena::Stats newLevel = LevelArena::Instance().GetStats();
+            std::cout << "[LevelArena] Unload + load of " << levelPath.filename().string() << ": "
+                << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count()
+                << " ms, " << newLevel.usedBytes / 1024 << " KB in " << newLevel.chunks << " chunk(s), "
+                << newLevel.liveBlocks << " blocks\n";
+        }
+
+        // The new level's components now reference what they need; drop the previous
+        // level's sheets. Evicted textures reload on demand through getTexture().
+        Resource_Manager::EvictUnreferenced();
+        Resource_Manager::ReportLevelTextures(levelPath.stem().string());
 
         player = nullptr;
         collisionTarget = nullptr;
         pendingLevelTransition = false;
-        animState = AnimState::Idle;
-        frame = 0;
-        frameClock = 0.f;
         attackTimer = 0.f;
+        attackMode = Mode::Idle;
+        knockbackAnimTimer = 0.0f;
+        playerMachine = PlayerMachineBinding{};
         comboStep = 0;
         animInfo = AnimationInfo{};
         collisionInfo = CollisionInfo{};
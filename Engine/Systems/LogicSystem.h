@@ -111,6 +111,8 @@ namespace Framework {
         const AnimationInfo& Animation()     const { return animInfo; }
         const CollisionInfo& Collision()     const { return collisionInfo; }
         bool                       GetPlayerWorldPosition(float& outX, float& outY) const;
+        /// Player position at the start of the last fixed step (current position before any step).
+        bool                       GetPlayerPreviousPosition(float& outX, float& outY) const;
         int                        ScreenWidth()   const { return screenW; }
         int                        ScreenHeight()  const { return screenH; }
         GOC* FindAnyAlivePlayer();
@@ -125,8 +127,8 @@ namespace Framework {
 
         std::filesystem::path resolveData(std::string_view name) const;
 
-        // Extended to support combo attacks.
-        enum class AnimState { Idle, Run, Attack1, Attack2, Attack3, Throw, Knockback, Death };
+        using Mode = AnimationInfo::Mode;
+        static constexpr int kModeCount = static_cast<int>(Mode::Death) + 1;
 
         struct AnimConfig {
             int   cols;
@@ -135,20 +137,29 @@ namespace Framework {
             float fps;
         };
 
-        const AnimConfig& CurrentConfig() const;
-        const AnimConfig& ConfigForState(AnimState state) const;
-        bool                 IsAttackState(AnimState state) const;
-        void                 SetAnimState(AnimState newState);
+        /*! \brief Player machine signal bits and Mode <-> state indices, looked up by name
+                   once per machine revision (the states and signals of the "player" asset). */
+        struct PlayerMachineBinding {
+            const AnimStateMachineAsset* asset{ nullptr };
+            std::uint32_t                revision{ 0 };
+            std::uint32_t                dead{ 0 };
+            std::uint32_t                knockback{ 0 };
+            std::uint32_t                moving{ 0 };
+            std::uint32_t                attackSignal[kModeCount]{};   //!< Attack1..3 / Throw
+            int                          stateForMode[kModeCount]{};
+            std::vector<Mode>            modeForState;
+        };
+
+        const AnimConfig&    FallbackConfig(Mode mode) const;
+        bool                 IsAttackMode(Mode mode) const;
         void                 BeginComboAttack();
         void                 BeginThrowAttack();
         void                 ForceAttackState(int comboIndex);
-        AnimState            AttackStateForIndex(int comboIndex) const;
-        float                AttackDurationForState(AnimState state) const;
-        AnimationInfo::Mode  ModeForState(AnimState state) const;
-        std::string_view     AnimNameForState(AnimState state) const;
-        int                  AnimationIndexForState(const SpriteAnimationComponent* comp, AnimState state) const;
-        AnimConfig           ConfigFromSpriteSheet(const SpriteAnimationComponent* comp, AnimState state) const;
-        void                 ApplyAnimationStateToComponent(AnimState state);
+        Mode                 AttackModeForIndex(int comboIndex) const;
+        float                AttackDurationForMode(Mode mode);
+        AnimConfig           ConfigForMode(Mode mode);
+        SpriteAnimationComponent* PlayerAnimation() const;
+        AnimStateMachineInstance* PlayerStateMachine(SpriteAnimationComponent& anim);
 
         bool                 IsAlive(GOC* obj) const;
         void                 RefreshLevelReferences();
@@ -175,18 +186,18 @@ namespace Framework {
         GOC* collisionTarget{ nullptr };
         GateController                       gateController;
 
-        AnimState                            animState{ AnimState::Idle };
+        // Used when the player has no clip for a mode.
         AnimConfig                           idleConfig{ 5,1,5,6.f };
         AnimConfig                           runConfig{ 8,1,8,10.f };
         AnimConfig                           attackConfigs[3]{ {13,1,13,12.f}, {8,1,8,12.f}, {9,1,9,12.f} };
         AnimConfig                           throwConfig{ 14,1,14,18.f };
         AnimConfig                           knockbackConfig{ 4,1,4,5.f };
         AnimConfig                           deathConfig{ 8,1,8,8.f };
-        int                                  frame{ 0 };
-        float                                frameClock{ 0.f };
         float                                attackTimer{ 0.f };
+        Mode                                 attackMode{ Mode::Idle };   //!< Attack being played while attackTimer > 0
         int                                  comboStep{ 0 };
         float                                knockbackAnimTimer{ 0.0f };
+        PlayerMachineBinding                 playerMachine{};
 
         AnimationInfo                        animInfo{};
         CollisionInfo                        collisionInfo{};
@@ -21,6 +21,8 @@
 #include "Factory/Factory.h"
 #include "Resource_Asset_Manager/Resource_Manager.h"
 #include "Core/PathUtils.h"
+#include "Systems/VfxHelpers.h"
+#include "Component/SpriteAnimationComponent.h"
 
 #include <algorithm>
 #include <cmath>
@@ -48,10 +50,22 @@ namespace Framework {
     void ParticleSystem::Initialize()
     {
         particles.clear();
+
+        EventBus& bus = EventBus::Instance();
+        for (EventBus::SubscriptionId subscription : subscriptions)
+            bus.Unsubscribe(subscription);
+        subscriptions[0] = bus.Subscribe<HitLandedEvent, &ParticleSystem::OnHitLanded>(this);
+        subscriptions[1] = bus.Subscribe<EnemyDiedEvent, &ParticleSystem::OnEnemyDied>(this);
+        subscriptions[2] = bus.Subscribe<AnimationFinishedEvent, &ParticleSystem::OnAnimationFinished>(this);
     }
 
     void ParticleSystem::Shutdown()
     {
+        for (EventBus::SubscriptionId& subscription : subscriptions)
+        {
+            EventBus::Instance().Unsubscribe(subscription);
+            subscription = 0;
+        }
         particles.clear();
         if (instance == this)
         {
@@ -59,6 +73,29 @@ namespace Framework {
         }
     }
 
+    void ParticleSystem::OnHitLanded(const HitLandedEvent& event)
+    {
+        if (event.kind == HitLandedEvent::Target::Enemy)
+            SpawnHitImpactVFX(glm::vec2(event.x, event.y));
+    }
+
+    void ParticleSystem::OnEnemyDied(const EnemyDiedEvent& event)
+    {
+        if (event.hasPosition)
+            SpawnEnemyDeathParticles({ event.x, event.y });
+    }
+
+    void ParticleSystem::OnAnimationFinished(const AnimationFinishedEvent& event)
+    {
+        GOC* obj = FACTORY ? FACTORY->GetObjectWithId(event.id) : nullptr;
+        if (!obj || !IsImpactVfxObject(obj))
+            return;
+        auto* anim = obj->GetComponentType<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent);
+        if (anim && event.animation >= 0 && event.animation < static_cast<int>(anim->animations.size()) &&
+            anim->animations[static_cast<std::size_t>(event.animation)].name == "impact")
+            FACTORY->Destroy(obj);
+    }
+
     void ParticleSystem::Update(float dt)
     {
         if (!FACTORY)
@@ -14,6 +14,8 @@
 
 #include "Common/System.h"
 #include "Composition/Composition.h"
+#include "Messaging_System/EventBus.h"
+#include "Messaging_System/GameplayEvents.h"
 #include <glm/vec2.hpp>
 #include <random>
 #include <vector>
@@ -26,7 +28,9 @@ namespace Framework {
 
       Provides a spawn helper for enemy death bursts and updates particle motion/fade
       each frame. Internally stores particle metadata keyed by GOC IDs so particles
-      can be destroyed safely by the factory.
+      can be destroyed safely by the factory. Also owns the gameplay VFX reactions:
+      hit impacts (HitLandedEvent) and death bursts (EnemyDiedEvent), and removes impact
+      sprites once their clip finishes (AnimationFinishedEvent).
     *****************************************************************************************/
     class ParticleSystem : public ISystem {
     public:
@@ -43,6 +47,10 @@ namespace Framework {
         void SpawnEnemyDeathParticles(const glm::vec2& worldPos, std::size_t count = 12);
         void SpawnRunParticles(const glm::vec2& worldPos, float facingDir, std::size_t count = 3);
     private:
+        void OnHitLanded(const HitLandedEvent& event);
+        void OnEnemyDied(const EnemyDiedEvent& event);
+        void OnAnimationFinished(const AnimationFinishedEvent& event);
+
         enum class ParticleVisual
         {
             Circle,
@@ -64,6 +72,7 @@ namespace Framework {
 
         std::vector<Particle> particles;
         std::mt19937 rng;
+        EventBus::SubscriptionId subscriptions[3] = {};
 
         static ParticleSystem* instance;
     };
@@ -21,13 +21,16 @@
 #include <cmath>
 
 #include "Component/ZoomTriggerComponent.h"
-#include "RenderSystem.h"
+#include "Messaging_System/EventBus.h"
+#include "Messaging_System/GameplayEvents.h"
+#include "Debug/Profiler.h"
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
 #ifdef _DEBUG
 #define new DBG_NEW       // <- redefine new AFTER all includes
 #endif
 namespace Framework {
+    using namespace Framework::literals;
 
     /*************************************************************************************
       \brief  Construct the physics system with access to game logic/factory.
@@ -68,27 +71,36 @@ namespace Framework {
 
         // Build the uniform grid from the current frame snapshot so every body sees
         // all potential neighbors regardless of iteration order.
-        m_grid.Clear();
         auto& layers = FACTORY->Layers();
-        for (auto& [id, obj] : objects)
         {
-            if (!obj)
-                continue;
+            PROFILE_SCOPE("PhysicSystem::BuildGrid");
+            m_grid.Clear();
+            for (auto& [id, obj] : objects)
+            {
+                if (!obj)
+                    continue;
 
-            const LayerKey objectLayer = layers.LayerKeyFor(obj->GetId());
-            if (!layers.IsLayerEnabled(objectLayer))
-                continue;
+                const LayerKey objectLayer = layers.LayerKeyFor(obj->GetId());
+                if (!layers.IsLayerEnabled(objectLayer))
+                    continue;
 
-            auto* rb = obj->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
-            auto* tr = obj->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
-            if (!rb || !tr)
-                continue;
+                auto* rb = obj->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
+                auto* tr = obj->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
+                if (!rb || !tr)
+                    continue;
 
-            AABB box(tr->x, tr->y, rb->width, rb->height);
-            m_grid.Insert(id, box);
+                AABB box(tr->x, tr->y, rb->width, rb->height);
+                m_grid.Insert(id, box);
+            }
         }
         // --- Kinematic step with AABB collisions against solid bodies on the same layer ----------
 
+        PROFILE_SCOPE("PhysicSystem::MoveAndCollide");
+
+        // Broad-phase results for one body at a time; frame-arena memory, reused by every body.
+        FrameVector<GOCId> candidates;
+        candidates.reserve(64);
+
         for (auto& [id, obj] : objects)
         {
             if (!obj)
@@ -98,11 +110,8 @@ namespace Framework {
             if (!layers.IsLayerEnabled(objectLayer))
                 continue;
 
-            // Determine if THIS object is the Player (by name)
-            std::string objName = obj->GetObjectName();
-            std::transform(objName.begin(), objName.end(), objName.begin(),
-                [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
-            const bool isPlayer = (objName == "player");
+            // Determine if THIS object is the Player (by name, case-insensitive)
+            const bool isPlayer = (obj->GetObjectNameId() == "player"_sid);
 
             auto* rb = obj->GetComponentType<RigidBodyComponent>(ComponentTypeId::CT_RigidBodyComponent);
             auto* tr = obj->GetComponentType<TransformComponent>(ComponentTypeId::CT_TransformComponent);
@@ -141,8 +150,6 @@ namespace Framework {
             // Replaced with a model.
             // Explanation: The old code USED TO check every other object in the world,
             // now, the logic will only check the objects that are near.
-            std::vector<GOCId> candidates;
-
             // Query grid using the object's current bounds
             AABB selfBox(tr->x, tr->y, rb->width, rb->height);
             m_grid.Query(selfBox, candidates);
@@ -188,11 +195,8 @@ namespace Framework {
                             {
                                 zoom->triggered = true;
 
-                                if (auto* rs = RenderSystem::Get())
-                                {
-                                    // targetZoom is interpreted as "view height" here.
-                                    rs->SetCameraViewHeight(zoom->targetZoom);
-                                }
+                                // targetZoom is interpreted as "view height"; the renderer applies it.
+                                EventBus::Instance().Enqueue(ZoomTriggeredEvent{ otherObj->GetId(), zoom->targetZoom });
 
                                 if (zoom->oneShot)
                                 {
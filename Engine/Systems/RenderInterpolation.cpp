@@ -0,0 +1,104 @@
+/*********************************************************************************************
+ \file      RenderInterpolation.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements RenderInterpolation over the factory's live objects.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Systems/RenderInterpolation.h"
+#include "Component/TransformComponent.h"
+#include "Core/FramePacing.h"
+#include "Factory/Factory.h"
+#include <cstdint>
+#include <vector>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        /// One Transform changed by Apply(): the simulated pose and what was written over it.
+        struct Applied
+        {
+            GOCId id;
+            float x, y, rot;        // simulated
+            float ix, iy, irot;     // interpolated
+        };
+
+        std::vector<Applied> gApplied;      // capacity is kept between frames
+        std::uint64_t        gSavedStep = 0;
+        bool                 gHaveSavedStep = false;
+    }
+
+    void RenderInterpolation::SaveStep()
+    {
+        gSavedStep = FramePacing::StepCount();
+        gHaveSavedStep = true;
+        if (!FACTORY)
+            return;
+
+        for (auto& [id, obj] : FACTORY->Objects())
+        {
+            (void)id;
+            auto* tr = HAS(obj.get(), TransformComponent);
+            if (!tr)
+                continue;
+            tr->prevX = tr->x;
+            tr->prevY = tr->y;
+            tr->prevRot = tr->rot;
+            tr->hasPrev = true;
+        }
+    }
+
+    void RenderInterpolation::Apply()
+    {
+        gApplied.clear();
+        const float alpha = FramePacing::InterpolationAlpha();
+        if (!FACTORY || !gHaveSavedStep || gSavedStep != FramePacing::StepCount() || alpha >= 1.0f)
+            return;
+
+        for (auto& [id, obj] : FACTORY->Objects())
+        {
+            auto* tr = HAS(obj.get(), TransformComponent);
+            if (!tr || !tr->hasPrev)
+                continue;
+
+            Applied entry{ id, tr->x, tr->y, tr->rot, 0.0f, 0.0f, 0.0f };
+            entry.ix = tr->prevX + (tr->x - tr->prevX) * alpha;
+            entry.iy = tr->prevY + (tr->y - tr->prevY) * alpha;
+            entry.irot = tr->prevRot + (tr->rot - tr->prevRot) * alpha;
+            tr->x = entry.ix;
+            tr->y = entry.iy;
+            tr->rot = entry.irot;
+            gApplied.push_back(entry);
+        }
+    }
+
+    void RenderInterpolation::Restore()
+    {
+        if (!FACTORY)
+        {
+            gApplied.clear();
+            return;
+        }
+
+        for (const Applied& entry : gApplied)
+        {
+            GOC* obj = FACTORY->GetObjectWithId(entry.id);
+            auto* tr = HAS(obj, TransformComponent);
+            if (!tr)
+                continue;
+            if (tr->x == entry.ix) tr->x = entry.x;
+            if (tr->y == entry.iy) tr->y = entry.y;
+            if (tr->rot == entry.irot) tr->rot = entry.rot;
+        }
+        gApplied.clear();
+    }
+}
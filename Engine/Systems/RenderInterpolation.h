@@ -0,0 +1,38 @@
+/*********************************************************************************************
+ \file      RenderInterpolation.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Blends Transforms between the last two fixed steps for the duration of a draw.
+ \details   SystemManager::UpdateAll() calls SaveStep() before the systems run, copying every
+            Transform's position and rotation into its prev* fields. SystemManager::DrawAll()
+            brackets the draw with Apply() and Restore(). Apply() writes
+            prev + (current - prev) * FramePacing::InterpolationAlpha() into the Transform, and
+            Restore() puts the simulated value back. Systems draw the blended pose without
+            knowing about it, and the simulation never sees it.
+
+            Restore() only puts back a value the draw left untouched. A drag in the editor
+            gizmo during the draw therefore sticks. Objects are found again by id, so an
+            object destroyed during the draw is simply skipped.
+
+            Interpolation is skipped (alpha 1) when the latest fixed step did not reach
+            UpdateAll(), for example while the game is paused. Otherwise the draw would keep
+            showing a pose from one step in the past.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+namespace Framework
+{
+    class RenderInterpolation
+    {
+    public:
+        /// Start of a simulation step: current pose becomes the previous pose.
+        static void SaveStep();
+        /// Start of a draw: replace poses with the interpolated ones.
+        static void Apply();
+        /// End of a draw: put the simulated poses back.
+        static void Restore();
+    };
+}
@@ -0,0 +1,93 @@
+/*********************************************************************************************
+ \file      RenderSnapshot.cpp
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Implements the RenderSnapshot front/back swap.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+
+#include "Systems/RenderSnapshot.h"
+#include <utility>
+#include "Common/CRTDebug.h"   // <- bring in DBG_NEW
+
+#ifdef _DEBUG
+#define new DBG_NEW       // <- redefine new AFTER all includes
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        struct SnapshotState
+        {
+            RenderFrame frames[2];
+            unsigned    front = 0;
+            bool        committed = false;  // back holds a complete frame not yet published
+            bool        capturing = false;
+        };
+
+        SnapshotState& State()
+        {
+            static SnapshotState state;
+            return state;
+        }
+    }
+
+    void RenderFrame::Clear()
+    {
+        items.clear();
+        glowPoints.clear();
+        projectiles.clear();
+        hasPlayer = false;
+        enemiesAlive = 0;
+        valid = false;
+    }
+
+    void RenderSnapshot::SetCapturing(bool on)
+    {
+        SnapshotState& state = State();
+        if (state.capturing == on)
+            return;
+        state.capturing = on;
+        state.committed = false;
+        state.frames[0].Clear();
+        state.frames[1].Clear();
+    }
+
+    bool RenderSnapshot::Capturing()
+    {
+        return State().capturing;
+    }
+
+    RenderFrame& RenderSnapshot::Back()
+    {
+        SnapshotState& state = State();
+        return state.frames[state.front ^ 1u];
+    }
+
+    void RenderSnapshot::Commit()
+    {
+        SnapshotState& state = State();
+        state.frames[state.front ^ 1u].valid = true;
+        state.committed = true;
+    }
+
+    void RenderSnapshot::Publish(float alpha)
+    {
+        SnapshotState& state = State();
+        if (state.committed)
+        {
+            state.front ^= 1u;
+            state.committed = false;
+        }
+        state.frames[state.front].alpha = alpha;
+    }
+
+    const RenderFrame& RenderSnapshot::Front()
+    {
+        SnapshotState& state = State();
+        return state.frames[state.front];
+    }
+}
@@ -0,0 +1,124 @@
+/*********************************************************************************************
+ \file      RenderSnapshot.h
+ \par       SofaSpuds
+ \author    SofaSpuds Team
+ \brief     Double-buffered copy of what the world pass draws, captured at the end of each
+            fixed step.
+ \details   A RenderFrame holds everything RenderSystem's world pass reads from game state.
+            That covers one RenderItem per drawable object (layer-sorted, disabled layers
+            dropped), the flying projectiles, the camera target and the objective counter.
+            Each item keeps both the current pose and the pose at the start of the step, so
+            the frame can be interpolated without going back to the Transforms.
+
+            While capturing is on (the pipelined setting in FramePacing), SystemManager calls
+            ISystem::CaptureRenderState() after every step. RenderSystem fills Back() there
+            and Commit() marks it complete. On the main thread, Publish() swaps Back() to the
+            front once the simulation is idle, and stamps it with the frame's interpolation
+            factor. A pipelined frame draws Front() while the next steps fill Back() on the
+            simulation thread.
+
+            Texture handles are copied as they are. When a handle is still 0, the item keeps
+            the key and the renderer resolves it on the main thread; capture never calls
+            into Resource_Manager for sprites.
+
+            Vectors are cleared, never shrunk, so capture stops allocating once the buffers
+            have grown to the scene's size.
+ \copyright
+            All content © 2025 DigiPen Institute of Technology Singapore.
+            All rights reserved.
+*********************************************************************************************/
+#pragma once
+
+#include "Common/StringId.h"
+#include "Component/RenderComponent.h"
+#include "Core/Layer.h"
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Framework
+{
+    /// One object as the world pass sees it. Flags mirror the live pass's rules: an invisible
+    /// RenderComponent hides the sprite, rectangle and circle, but not the glow.
+    struct RenderItem
+    {
+        unsigned   id = 0;
+        LayerGroup group = LayerGroup::Background;
+
+        float x = 0.f, y = 0.f, rot = 0.f;          // end of step
+        float prevX = 0.f, prevY = 0.f, prevRot = 0.f;  // start of step
+        float scaleX = 1.f, scaleY = 1.f;
+
+        bool hasSpriteComponent = false;            // sprite objects never draw rect/circle
+        bool drawSprite = false;
+        bool drawRect = false;
+        bool drawCircle = false;
+        bool drawGlow = false;
+
+        // Sprite, or rectangle when there is no sprite (size and tint from RenderComponent)
+        unsigned  texture = 0;
+        StringId  textureKey;
+        glm::vec4 uv{ 0.f, 0.f, 1.f, 1.f };
+        float     w = 1.f, h = 1.f;
+        float     r = 1.f, g = 1.f, b = 1.f, a = 1.f;
+        BlendMode blendMode = BlendMode::Alpha;
+
+        // Circle
+        float radius = 0.f;
+        float cr = 1.f, cg = 1.f, cb = 1.f, ca = 1.f;
+
+        // Glow; points are glowPoints[firstGlowPoint, firstGlowPoint + glowPointCount)
+        float glowInner = 0.f, glowOuter = 0.f, glowBrightness = 0.f, glowFalloff = 1.f;
+        float glowR = 1.f, glowG = 1.f, glowB = 1.f, glowOpacity = 1.f;
+        std::uint32_t firstGlowPoint = 0;
+        std::uint32_t glowPointCount = 0;
+    };
+
+    /// Projectile hitbox, as drawn by the sprite pass.
+    struct ProjectileItem
+    {
+        float x = 0.f, y = 0.f, angle = 0.f;
+        float w = 0.f, h = 0.f;
+        float elapsed = 0.f, duration = 0.f;
+        bool  enemy = false;
+    };
+
+    struct RenderFrame
+    {
+        std::vector<RenderItem>     items;
+        std::vector<glm::vec2>      glowPoints;
+        std::vector<ProjectileItem> projectiles;
+
+        bool  hasPlayer = false;
+        float playerX = 0.f, playerY = 0.f, playerPrevX = 0.f, playerPrevY = 0.f;
+        int   enemiesAlive = 0;
+
+        float         alpha = 1.f;      ///< Interpolation factor between prev* and current
+        std::uint64_t step = 0;         ///< FramePacing::StepCount() when captured
+        bool          valid = false;
+
+        void Clear();
+    };
+
+    /*****************************************************************************************
+      \class RenderSnapshot
+      \brief Static front/back RenderFrame pair shared by the simulation and the renderer.
+    *****************************************************************************************/
+    class RenderSnapshot
+    {
+    public:
+        /// Turn per-step capture on or off (off also drops both frames).
+        static void SetCapturing(bool on);
+        static bool Capturing();
+
+        /// Simulation side: the frame being filled, and "it is complete".
+        static RenderFrame& Back();
+        static void Commit();
+
+        /// Main thread, simulation idle: promote the last committed frame and set its alpha.
+        static void Publish(float alpha);
+        /// Main thread: the frame to draw.
+        static const RenderFrame& Front();
+    };
+}
@@ -74,6 +74,12 @@
 #include "Physics/Dynamics/RigidBodyComponent.h"
 #include "../../Sandbox/MyGame/Game.hpp"
 #include "Component/HitBoxComponent.h"
+#include "Common/VerboseLog.h"
+#include "Memory/FrameArena.h"
+#include "Debug/Profiler.h"
+#include "Graphics/GpuTimer.h"
+#include "Core/FramePacing.h"
+#include "Core/SimulationThread.h"
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
 #ifdef _DEBUG
@@ -268,6 +274,12 @@ namespace Framework {
         camera.SetViewHeight(cameraViewHeight);
     }
 
+    void RenderSystem::OnZoomTriggered(const ZoomTriggeredEvent& event)
+    {
+        // Published during the update, which may be on the simulation thread; draw() applies it.
+        pendingViewHeight.store(event.viewHeight, std::memory_order_relaxed);
+    }
+
     /*************************************************************************************
       \brief  Probe for a Roboto font file in common asset locations.
       \return Absolute/relative path string to a usable Roboto .ttf, or empty if not found.
@@ -975,6 +987,28 @@ namespace Framework {
         return UnprojectWithCamera(activeCamera, ndcX, ndcY, worldX, worldY);
     }
 
+    /*************************************************************************************
+      \brief  World-space bounds of the gameplay camera view.
+      \details Mirrors ScreenToWorld: with the camera off, world space is the NDC square.
+    *************************************************************************************/
+    void RenderSystem::GetGameViewBounds(float& minX, float& minY, float& maxX, float& maxY) const
+    {
+        if (!cameraEnabled)
+        {
+            minX = minY = -1.0f;
+            maxX = maxY = 1.0f;
+            return;
+        }
+
+        const glm::vec2& centre = camera.Position();
+        const float halfH = camera.ViewHeight() * 0.5f;
+        const float halfW = halfH * camera.AspectRatio();
+        minX = centre.x - halfW;
+        maxX = centre.x + halfW;
+        minY = centre.y - halfH;
+        maxY = centre.y + halfH;
+    }
+
     /*************************************************************************************
       \brief  Map screen cursor to normalized device coords within the game viewport.
       \return True on success; sets ndcX/ndcY (\[-1,\+1\]) and insideViewport flag.
@@ -1830,6 +1864,9 @@ namespace Framework {
     *************************************************************************************/
     void RenderSystem::Initialize()
     {
+        EventBus::Instance().Unsubscribe(zoomSubscription);
+        zoomSubscription = EventBus::Instance().Subscribe<ZoomTriggeredEvent, &RenderSystem::OnZoomTriggered>(this);
+
 #if SOFASPUDS_ENABLE_EDITOR
         dataFilesRoot = FindDataFilesRoot();
 #endif
@@ -1896,6 +1933,13 @@ namespace Framework {
         knifeTex = Resource_Manager::resources_map["ming_knife"].handle;
         fireProjectileTex = Resource_Manager::resources_map["fire_projectile"].handle;
 
+        // These handles are cached on the RenderSystem, so keep them out of LRU eviction.
+        for (const char* key : { "player_png", "ming_idle", "ming_run", "ming_attack1", "ming_attack2",
+            "ming_attack3", "ming_throw", "ming_knockback", "ming_knife", "fire_projectile", "impact_vfx_sheet" })
+        {
+            Resource_Manager::Pin(key);
+        }
+
 #if SOFASPUDS_ENABLE_EDITOR
         ImGuiLayerConfig config;
         config.glsl_version = "#version 330";
@@ -2019,6 +2063,202 @@ namespace Framework {
                 0.0f, 0.0f, 0.0f, alpha, screenW, screenH);
         }
     }
+    FrameVector<unsigned> RenderSystem::SortedObjectIds() const
+    {
+        FrameVector<unsigned> sortedIds;
+        sortedIds.reserve(FACTORY->Objects().size());
+
+        for (auto& [id, objPtr] : FACTORY->Objects())
+            sortedIds.push_back(id);
+
+        auto& layerManager = FACTORY->Layers();
+
+        // Sort by fixed layer groups and sublayers (Background -> Gameplay -> Foreground -> UI).
+        std::sort(sortedIds.begin(), sortedIds.end(),
+            [&layerManager](unsigned a, unsigned b)
+            {
+                const LayerKey keyA = layerManager.LayerKeyFor(a);
+                const LayerKey keyB = layerManager.LayerKeyFor(b);
+
+                if (keyA.group != keyB.group)
+                    return static_cast<int>(keyA.group) < static_cast<int>(keyB.group);
+                if (keyA.sublayer != keyB.sublayer)
+                    return keyA.sublayer < keyB.sublayer;
+
+                return a < b;
+            });
+        return sortedIds;
+    }
+
+    /*************************************************************************************
+      \brief  Record, per object, what the sprite pass will draw.
+      \details Mirrors the pass's rules: disabled layers and objects without a Transform
+               are dropped; glow does not depend on the RenderComponent; an invisible
+               RenderComponent hides the sprite, the rectangle and the circle. Textures are
+               copied as handles; a missing handle keeps its key so draw() can resolve it on
+               the main thread.
+    *************************************************************************************/
+    void RenderSystem::BuildRenderFrame(RenderFrame& frame, const FrameVector<unsigned>& sortedIds)
+    {
+        frame.Clear();
+        frame.step = FramePacing::StepCount();
+        frame.alpha = 1.0f;
+
+        auto& layerManager = FACTORY->Layers();
+        for (unsigned id : sortedIds)
+        {
+            GOC* obj = FACTORY->Objects().at(id).get();
+            if (!obj) continue;
+            if (!layerManager.IsLayerEnabled(obj->GetLayerName())) continue;
+
+            auto* tr = obj->GetComponentType<Framework::TransformComponent>(
+                Framework::ComponentTypeId::CT_TransformComponent);
+            if (!tr) continue;
+
+            RenderItem item;
+            item.id = id;
+            item.group = layerManager.LayerKeyFor(id).group;
+            item.x = tr->x;
+            item.y = tr->y;
+            item.rot = tr->rot;
+            item.prevX = tr->hasPrev ? tr->prevX : tr->x;
+            item.prevY = tr->hasPrev ? tr->prevY : tr->y;
+            item.prevRot = tr->hasPrev ? tr->prevRot : tr->rot;
+            item.scaleX = tr->scaleX;
+            item.scaleY = tr->scaleY;
+
+            if (auto* glow = obj->GetComponentType<Framework::GlowComponent>(
+                Framework::ComponentTypeId::CT_GlowComponent))
+            {
+                const float scale = std::max(std::fabs(tr->scaleX), std::fabs(tr->scaleY));
+                if (glow->visible && glow->opacity > 0.0f && glow->brightness > 0.0f &&
+                    glow->outerRadius * scale > 0.0f)
+                {
+                    item.drawGlow = true;
+                    item.glowInner = glow->innerRadius * scale;
+                    item.glowOuter = glow->outerRadius * scale;
+                    item.glowBrightness = glow->brightness;
+                    item.glowFalloff = glow->falloffExponent;
+                    item.glowR = glow->r;
+                    item.glowG = glow->g;
+                    item.glowB = glow->b;
+                    item.glowOpacity = glow->opacity;
+                    item.firstGlowPoint = static_cast<std::uint32_t>(frame.glowPoints.size());
+                    item.glowPointCount = static_cast<std::uint32_t>(glow->points.size());
+                    frame.glowPoints.insert(frame.glowPoints.end(), glow->points.begin(), glow->points.end());
+                }
+            }
+
+            auto* rc = obj->GetComponentType<Framework::RenderComponent>(
+                Framework::ComponentTypeId::CT_RenderComponent);
+            const bool rcHidden = rc && (!rc->visible || rc->a <= 0.0f);
+
+            if (auto* sp = obj->GetComponentType<Framework::SpriteComponent>(
+                Framework::ComponentTypeId::CT_SpriteComponent))
+            {
+                item.hasSpriteComponent = true;
+                item.drawSprite = !rcHidden;
+                if (rc && item.drawSprite)
+                {
+                    item.w = rc->w;
+                    item.h = rc->h;
+                    item.r = rc->r;
+                    item.g = rc->g;
+                    item.b = rc->b;
+                    item.a = rc->a;
+                    item.blendMode = rc->blendMode;
+                }
+
+                item.texture = sp->texture_id;
+                auto* animComp = obj->GetComponentType<Framework::SpriteAnimationComponent>(
+                    Framework::ComponentTypeId::CT_SpriteAnimationComponent);
+                if (item.drawSprite && animComp && animComp->HasSpriteSheets())
+                {
+                    // AnimationSystem's sample, unless the clip changed since it ran.
+                    if (const auto* sampled = animComp->FreshSample())
+                    {
+                        item.texture = sampled->texture;
+                        item.uv = sampled->uv;
+                    }
+                    else
+                    {
+                        auto sample = animComp->CurrentSheetSample();
+                        if (sample.texture)
+                            item.texture = sample.texture;
+                        item.uv = sample.uv;
+                    }
+                }
+                else if (!item.texture)
+                {
+                    item.textureKey = sp->texture_key.id();
+                }
+            }
+            else
+            {
+                if (rc && !rcHidden)
+                {
+                    item.drawRect = true;
+                    item.texture = rc->texture_id;
+                    if (!item.texture)
+                        item.textureKey = rc->texture_key.id();
+                    item.w = rc->w;
+                    item.h = rc->h;
+                    item.r = rc->r;
+                    item.g = rc->g;
+                    item.b = rc->b;
+                    item.a = rc->a;
+                    item.blendMode = rc->blendMode;
+                }
+
+                auto* cc = obj->GetComponentType<Framework::CircleRenderComponent>(
+                    Framework::ComponentTypeId::CT_CircleRenderComponent);
+                if (cc && !rcHidden)
+                {
+                    item.drawCircle = true;
+                    item.radius = cc->radius * std::max(std::fabs(tr->scaleX), std::fabs(tr->scaleY));
+                    item.cr = cc->r;
+                    item.cg = cc->g;
+                    item.cb = cc->b;
+                    item.ca = cc->a;
+                }
+            }
+            frame.items.push_back(item);
+        }
+
+        if (logic.hitBoxSystem)
+        {
+            for (const auto& activeHit : logic.hitBoxSystem->GetActiveHitBoxes())
+            {
+                if (!activeHit.isProjectile)
+                    continue;
+
+                ProjectileItem projectile;
+                projectile.x = activeHit.spawnX;
+                projectile.y = activeHit.spawnY;
+                projectile.angle = std::atan2(activeHit.velY, activeHit.velX);
+                projectile.w = activeHit.width + 0.15f;
+                projectile.h = activeHit.height + 0.15f;
+                projectile.duration = std::max(0.0001f, activeHit.duration);
+                projectile.elapsed = std::clamp(projectile.duration - activeHit.timer, 0.0f, projectile.duration);
+                projectile.enemy = activeHit.team == HitBoxComponent::Team::Enemy;
+                frame.projectiles.push_back(projectile);
+            }
+        }
+
+        frame.hasPlayer = logic.GetPlayerWorldPosition(frame.playerX, frame.playerY) &&
+            logic.GetPlayerPreviousPosition(frame.playerPrevX, frame.playerPrevY);
+        frame.enemiesAlive = logic.enemiesAlive;
+        frame.valid = true;
+    }
+
+    void RenderSystem::CaptureRenderState()
+    {
+        if (!FACTORY)
+            return;
+        BuildRenderFrame(RenderSnapshot::Back(), SortedObjectIds());
+        RenderSnapshot::Commit();
+    }
+
     /*************************************************************************************
       \brief  Main per-frame render/update entry: sets VP, draws world/UI, and editor tools.
       \details Order:
@@ -2028,12 +2268,24 @@ namespace Framework {
                4) Background, batched sprites, text in screen-space
                5) Dockspace, controls, asset/json panels, debug overlays
                6) Imported assets processing and perf timing
+               The world pass (4) draws a RenderFrame. In a pipelined frame that is the
+               published snapshot, and nothing before the SimulationThread::Sync() after the
+               text pass may touch game objects; shortcuts and Resource_Manager::BeginFrame()
+               move behind that point.
       \note    Uses TryGuard::Run(...) to isolate and label crashes as "RenderSystem::draw".
     *************************************************************************************/
     void RenderSystem::draw()
     {
         TryGuard::Run([&] {
-            HandleShortcuts();
+            const bool pipelined = SimulationThread::InFlight();
+            if (!pipelined)
+            {
+                Resource_Manager::BeginFrame();
+                HandleShortcuts();
+            }
+            const float requestedViewHeight = pendingViewHeight.exchange(-1.0f, std::memory_order_relaxed);
+            if (requestedViewHeight >= 0.0f)
+                SetCameraViewHeight(requestedViewHeight);
 #if SOFASPUDS_ENABLE_EDITOR
             if (showEditor)
             {
@@ -2080,7 +2332,18 @@ namespace Framework {
             else if (cameraEnabled)
             {
                 float playerX = 0.0f, playerY = 0.0f;
-                const bool hasPlayer = logic.GetPlayerWorldPosition(playerX, playerY);
+                bool hasPlayer = false;
+                if (pipelined)
+                {
+                    const RenderFrame& snapshot = RenderSnapshot::Front();
+                    hasPlayer = snapshot.hasPlayer;
+                    playerX = snapshot.playerPrevX + (snapshot.playerX - snapshot.playerPrevX) * snapshot.alpha;
+                    playerY = snapshot.playerPrevY + (snapshot.playerY - snapshot.playerPrevY) * snapshot.alpha;
+                }
+                else
+                {
+                    hasPlayer = logic.GetPlayerWorldPosition(playerX, playerY);
+                }
 
                 if (gCameraFollowLocked)
                 {
@@ -2107,100 +2370,90 @@ namespace Framework {
             // Now handle picking with the correct (current) camera matrices.
             HandleViewportPicking();
 #endif
-            // Auto-load all textures referenced by objects
-            for (auto& [id, objPtr] : FACTORY->Objects())
+            // Auto-load all textures referenced by objects (the simulation thread owns them while pipelined)
+            if (!pipelined)
             {
-                GOC* obj = objPtr.get();
-                if (!obj) continue;
-
-                // If object has SpriteComponent
-                if (auto* sp = obj->GetComponentType<SpriteComponent>(ComponentTypeId::CT_SpriteComponent))
+                for (auto& [id, objPtr] : FACTORY->Objects())
                 {
-                    if (!sp->texture_key.empty())
+                    GOC* obj = objPtr.get();
+                    if (!obj) continue;
+
+                    // If object has SpriteComponent
+                    if (auto* sp = obj->GetComponentType<SpriteComponent>(ComponentTypeId::CT_SpriteComponent))
                     {
-                        unsigned tex = Resource_Manager::getTexture(sp->texture_key);
-                        if (!tex)
+                        if (!sp->texture_key.empty())
                         {
-                            // Try load it if not already in memory
-                            Resource_Manager::load(sp->texture_key, sp->texture_key);
-                            tex = Resource_Manager::getTexture(sp->texture_key);
+                            unsigned tex = Resource_Manager::getTexture(sp->texture_key.id());
+                            if (!tex)
+                            {
+                                // Try load it if not already in memory
+                                Resource_Manager::load(sp->texture_key, sp->texture_key);
+                                tex = Resource_Manager::getTexture(sp->texture_key.id());
+                            }
+                            sp->texture_id = tex;
                         }
-                        sp->texture_id = tex;
                     }
-                }
 
-                // If object has RenderComponent
-                if (auto* rc = obj->GetComponentType<RenderComponent>(ComponentTypeId::CT_RenderComponent))
-                {
-                    if (!rc->texture_key.empty())
+                    // If object has RenderComponent
+                    if (auto* rc = obj->GetComponentType<RenderComponent>(ComponentTypeId::CT_RenderComponent))
                     {
-                        unsigned tex = Resource_Manager::getTexture(rc->texture_key);
-                        if (!tex)
+                        if (!rc->texture_key.empty())
                         {
-                            Resource_Manager::load(rc->texture_key, rc->texture_key);
-                            tex = Resource_Manager::getTexture(rc->texture_key);
+                            unsigned tex = Resource_Manager::getTexture(rc->texture_key.id());
+                            if (!tex)
+                            {
+                                Resource_Manager::load(rc->texture_key, rc->texture_key);
+                                tex = Resource_Manager::getTexture(rc->texture_key.id());
+                            }
+                            rc->texture_id = tex;
                         }
-                        rc->texture_id = tex;
                     }
                 }
             }
 
 
-            // Layering
-            std::vector<unsigned> sortedIds;
-            sortedIds.reserve(FACTORY->Objects().size());
-
-            for (auto& [id, objPtr] : FACTORY->Objects())
-                sortedIds.push_back(id);
-
+            // Layering: draw the published snapshot, or this frame's live state
+            FrameVector<unsigned> sortedIds;
+            const RenderFrame* frame = &RenderSnapshot::Front();
+            if (!pipelined)
+            {
+                sortedIds = SortedObjectIds();
+                BuildRenderFrame(liveFrame, sortedIds);
+                frame = &liveFrame;
+            }
             auto& layerManager = FACTORY->Layers();
 
-            // Sort by fixed layer groups and sublayers (Background -> Gameplay -> Foreground -> UI).
-            std::sort(sortedIds.begin(), sortedIds.end(),
-                [&layerManager](unsigned a, unsigned b)
-                {
-                    const LayerKey keyA = layerManager.LayerKeyFor(a);
-                    const LayerKey keyB = layerManager.LayerKeyFor(b);
-
-                    if (keyA.group != keyB.group)
-                        return static_cast<int>(keyA.group) < static_cast<int>(keyB.group);
-                    if (keyA.sublayer != keyB.sublayer)
-                        return keyA.sublayer < keyB.sublayer;
-
-                    return a < b;
-                });
-
 
             auto t0 = clock::now();
 
             static unsigned hawkerFloorTex = 0;
             static unsigned hawkerHdbTex = 0;
 
+            // Paths are only resolved while the handle is still missing, not every frame.
             auto ensureBackgroundTexture = [](unsigned& textureHandle,
                 const char* key,
-                const char* path)
+                const char* relativePath)
                 {
                     if (textureHandle)
                         return;
 
                     textureHandle = Resource_Manager::getTexture(key);
-                    if (!textureHandle && path)
+                    if (!textureHandle && relativePath)
                     {
+                        const std::string path = Framework::ResolveAssetPath(relativePath).string();
                         if (Resource_Manager::load(key, path))
                         {
                             textureHandle = Resource_Manager::getTexture(key);
                         }
                     }
+                    if (textureHandle)
+                        Resource_Manager::Pin(key); // handle lives in a static
                 };
 
-            const std::string floorPath =
-                Framework::ResolveAssetPath("Textures/Environment/lvl 1_Hawker/Floor.png").string();
-            const std::string hdbPath =
-                Framework::ResolveAssetPath("Textures/Environment/lvl 1_Hawker/HDB.png").string();
-
-            ensureBackgroundTexture(hawkerFloorTex, "hawker_floor_bg", floorPath.c_str());
-            ensureBackgroundTexture(hawkerHdbTex, "hawker_hdb_bg", hdbPath.c_str());
+            ensureBackgroundTexture(hawkerFloorTex, "hawker_floor_bg", "Textures/Environment/lvl 1_Hawker/Floor.png");
+            ensureBackgroundTexture(hawkerHdbTex, "hawker_hdb_bg", "Textures/Environment/lvl 1_Hawker/HDB.png");
 
+            gfx::GpuTimer::Begin(gfx::GpuPass::Background);
             if (hawkerFloorTex && hawkerHdbTex)
             {
                 gfx::Graphics::renderSprite(hawkerHdbTex, 0.0f, 0.5f, 0.0f,
@@ -2219,6 +2472,7 @@ namespace Framework {
             {
                 gfx::Graphics::renderBackground();
             }
+            gfx::GpuTimer::End(gfx::GpuPass::Background);
 
             if (FACTORY)
             {
@@ -2289,46 +2543,38 @@ namespace Framework {
                 struct SpriteBatch
                 {
                     unsigned texture = 0;
-                    std::vector<gfx::Graphics::SpriteInstance> instances;
+                    FrameVector<gfx::Graphics::SpriteInstance> instances;
                 };
 
                 SpriteBatch spriteBatch;
-                spriteBatch.instances.reserve(64);
+                spriteBatch.instances.reserve(256);
 
 
                 auto flushSpriteBatch = [&spriteBatch]()
                     {
                         if (spriteBatch.instances.empty())
                             return;
-                        gfx::Graphics::renderSpriteBatchInstanced(spriteBatch.texture, spriteBatch.instances);
+                        gfx::Graphics::renderSpriteBatchInstanced(spriteBatch.texture,
+                            spriteBatch.instances.data(), spriteBatch.instances.size());
                         spriteBatch.instances.clear();
                     };
 
                 auto renderProjectiles = [&]()
                     {
-                        if (!(knifeTex || fireProjectileTex) || !logic.hitBoxSystem)
-                            return;
-
-                        const auto& activeHits = logic.hitBoxSystem->GetActiveHitBoxes();
-                        if (activeHits.empty())
+                        if (!(knifeTex || fireProjectileTex) || frame->projectiles.empty())
                             return;
 
                         applyBlendMode(BlendMode::Alpha);
 
-                        for (const auto& activeHit : activeHits)
+                        for (const ProjectileItem& projectile : frame->projectiles)
                         {
-                            if (!activeHit.hitbox || !activeHit.isProjectile)
-                                continue;
-
-                            const auto* hb = activeHit.hitbox.get();
-
                             unsigned projTex = 0;
                             int cols = 0;
                             int rows = 1;
                             int frames = 0;
                             float fps = 18.0f;
 
-                            if (hb->team == HitBoxComponent::Team::Enemy && fireProjectileTex)
+                            if (projectile.enemy && fireProjectileTex)
                             {
                                 projTex = fireProjectileTex;
                                 cols = 5;
@@ -2349,16 +2595,13 @@ namespace Framework {
 
                             gfx::Graphics::SpriteInstance instance;
                             glm::mat4 model(1.0f);
-                            model = glm::translate(model, glm::vec3(hb->spawnX, hb->spawnY, 0.0f));
-                            const float angle = std::atan2(activeHit.velY, activeHit.velX);
-                            model = glm::rotate(model, angle, glm::vec3(0, 0, 1));
-                            model = glm::scale(model, glm::vec3(hb->width+0.15, hb->height+0.15, 1.0f));
+                            model = glm::translate(model, glm::vec3(projectile.x, projectile.y, 0.0f));
+                            model = glm::rotate(model, projectile.angle, glm::vec3(0, 0, 1));
+                            model = glm::scale(model, glm::vec3(projectile.w, projectile.h, 1.0f));
                             instance.model = model;
                             instance.tint = glm::vec4(1.0f);
 
-                            const float duration = std::max(0.0001f, hb->duration);
-                            const float elapsed = std::clamp(duration - activeHit.timer, 0.0f, duration);
-                            const int frameIdx = static_cast<int>(elapsed * fps) % frames;
+                            const int frameIdx = static_cast<int>(projectile.elapsed * fps) % frames;
                             const float u = static_cast<float>(frameIdx) * invCols;
                             instance.uv = glm::vec4(u, 0.0f, invCols, invRows);
 
@@ -2378,123 +2621,79 @@ namespace Framework {
                 //const int animRows = std::max(1, CurrentRows());
                 bool projectilesRendered = false;
                 // Pass 1: Sprites (instanced)
-                for (unsigned id : sortedIds)
+                gfx::GpuTimer::Begin(gfx::GpuPass::Sprites);
+                const float alpha = frame->alpha;
+                for (const RenderItem& item : frame->items)
                 {
-                    auto& objPtr = FACTORY->Objects().at(id);
-                    GOC* obj = objPtr.get();
-                    if (!obj) continue;
-
-
-                    if (!layerManager.IsLayerEnabled(obj->GetLayerName())) continue;
-
-                    const LayerKey layerKey = layerManager.LayerKeyFor(id);
-                    if (!projectilesRendered && layerKey.group > LayerGroup::Gameplay)
+                    if (!projectilesRendered && item.group > LayerGroup::Gameplay)
                     {
                         flushSpriteBatch();
                         renderProjectiles();
                         projectilesRendered = true;
                     }
-                    auto* tr = obj->GetComponentType<Framework::TransformComponent>(
-                        Framework::ComponentTypeId::CT_TransformComponent);
-                    if (!tr) continue;
 
-                    auto* animComp = obj->GetComponentType<Framework::SpriteAnimationComponent>(
-                        Framework::ComponentTypeId::CT_SpriteAnimationComponent);
+                    // Pose between the start and the end of the last step (a live frame has alpha 1)
+                    float x = item.x, y = item.y, rot = item.rot;
+                    if (alpha < 1.0f)
+                    {
+                        x = item.prevX + (item.x - item.prevX) * alpha;
+                        y = item.prevY + (item.y - item.prevY) * alpha;
+                        rot = item.prevRot + (item.rot - item.prevRot) * alpha;
+                    }
 
-                    if (auto* glow = obj->GetComponentType<Framework::GlowComponent>(
-                        Framework::ComponentTypeId::CT_GlowComponent))
+                    if (item.drawGlow)
                     {
-                        if (glow->visible && glow->opacity > 0.0f && glow->brightness > 0.0f)
-                        {
-                            const float scale = std::max(std::fabs(tr->scaleX), std::fabs(tr->scaleY));
-                            const float inner = glow->innerRadius * scale;
-                            const float outer = glow->outerRadius * scale;
+                        flushSpriteBatch();
+                        applyBlendMode(BlendMode::Alpha);
+                        gfx::GpuTimer::Scope glowTimer(gfx::GpuPass::Glow);
 
-                            if (outer > 0.0f)
+                        if (item.glowPointCount == 0)
+                        {
+                            gfx::Graphics::renderGlow(x, y,
+                                item.glowInner, item.glowOuter,
+                                item.glowBrightness, item.glowFalloff,
+                                item.glowR, item.glowG, item.glowB, item.glowOpacity);
+                        }
+                        else
+                        {
+                            const float cosR = std::cos(rot);
+                            const float sinR = std::sin(rot);
+                            for (std::uint32_t i = 0; i < item.glowPointCount; ++i)
                             {
-                                flushSpriteBatch();
-                                applyBlendMode(BlendMode::Alpha);
-
-                                const float cosR = std::cos(tr->rot);
-                                const float sinR = std::sin(tr->rot);
-
-                                if (glow->points.empty())
-                                {
-                                    gfx::Graphics::renderGlow(tr->x, tr->y,
-                                        inner, outer,
-                                        glow->brightness, glow->falloffExponent,
-                                        glow->r, glow->g, glow->b, glow->opacity);
-                                }
-                                else
-                                {
-                                    for (const auto& pt : glow->points)
-                                    {
-                                        const float lx = pt.x * tr->scaleX;
-                                        const float ly = pt.y * tr->scaleY;
-                                        const float rx = cosR * lx - sinR * ly;
-                                        const float ry = sinR * lx + cosR * ly;
-                                        gfx::Graphics::renderGlow(tr->x + rx, tr->y + ry,
-                                            inner, outer,
-                                            glow->brightness, glow->falloffExponent,
-                                            glow->r, glow->g, glow->b, glow->opacity);
-                                    }
-                                }
+                                const glm::vec2& pt = frame->glowPoints[item.firstGlowPoint + i];
+                                const float lx = pt.x * item.scaleX;
+                                const float ly = pt.y * item.scaleY;
+                                const float rx = cosR * lx - sinR * ly;
+                                const float ry = sinR * lx + cosR * ly;
+                                gfx::Graphics::renderGlow(x + rx, y + ry,
+                                    item.glowInner, item.glowOuter,
+                                    item.glowBrightness, item.glowFalloff,
+                                    item.glowR, item.glowG, item.glowB, item.glowOpacity);
                             }
                         }
                     }
 
-                    if (auto* sp = obj->GetComponentType<Framework::SpriteComponent>(
-                        Framework::ComponentTypeId::CT_SpriteComponent))
+                    if (item.hasSpriteComponent)
                     {
-                        float sx = 1.f, sy = 1.f;
-                        float r = 1.f, g = 1.f, b = 1.f, a = 1.f;
-                        BlendMode blendMode = BlendMode::Alpha;
-
-                        // If a RenderComponent is present, use its size/tint AND visibility
-                        if (auto* rc = obj->GetComponentType<Framework::RenderComponent>(
-                            Framework::ComponentTypeId::CT_RenderComponent))
-                        {
-                            // Skip invisible sprites
-                            if (!rc->visible || rc->a <= 0.0f)
-                                continue;
-
-                            sx = rc->w;
-                            sy = rc->h;
-                            r = rc->r;
-                            g = rc->g;
-                            b = rc->b;
-                            a = rc->a;
-                            blendMode = rc->blendMode;
-                        }
+                        // Skip invisible sprites
+                        if (!item.drawSprite)
+                            continue;
 
+                        const BlendMode blendMode = item.blendMode;
                         const bool useSolidColor = (blendMode == BlendMode::SolidColor);
 
-                        unsigned tex = sp->texture_id;
-                        glm::vec4 uvRect(0.0f, 0.0f, 1.0f, 1.0f);
-
-                        if (animComp && animComp->HasSpriteSheets())
-                        {
-                            auto sample = animComp->CurrentSheetSample();
-                            if (sample.texture)
-                                tex = sample.texture;
-                            uvRect = sample.uv;
-                        }
-
-                        else if (!tex && !sp->texture_key.empty())
-                        {
-                            tex = Resource_Manager::getTexture(sp->texture_key);
-                            sp->texture_id = tex;
-                        }
-
+                        unsigned tex = item.texture;
+                        if (!tex && item.textureKey)
+                            tex = Resource_Manager::getTexture(item.textureKey);
 
                         gfx::Graphics::SpriteInstance instance;
                         glm::mat4 model(1.0f);
-                        model = glm::translate(model, glm::vec3(tr->x, tr->y, 0.0f));
-                        model = glm::rotate(model, tr->rot, glm::vec3(0, 0, 1));
-                        model = glm::scale(model, glm::vec3(sx * tr->scaleX, sy * tr->scaleY, 1.0f));
+                        model = glm::translate(model, glm::vec3(x, y, 0.0f));
+                        model = glm::rotate(model, rot, glm::vec3(0, 0, 1));
+                        model = glm::scale(model, glm::vec3(item.w * item.scaleX, item.h * item.scaleY, 1.0f));
                         instance.model = model;
-                        instance.tint = glm::vec4(r, g, b, a);
-                        instance.uv = uvRect;
+                        instance.tint = glm::vec4(item.r, item.g, item.b, item.a);
+                        instance.uv = item.uv;
 
                         if (useSolidColor)
                         {
@@ -2509,7 +2708,7 @@ namespace Framework {
                                 tex = idleTex ? idleTex : playerTex; // or any known valid texture
 
                             // Draw ONE instance using instanced path, but tell shader to ignore texture
-                            gfx::Graphics::EnableSolidColor(true, r, g, b, a);  // you add this helper (below)
+                            gfx::Graphics::EnableSolidColor(true, item.r, item.g, item.b, item.a);  // you add this helper (below)
                             gfx::Graphics::renderSpriteBatchInstanced(tex, &instance, 1);
                             gfx::Graphics::EnableSolidColor(false, 1, 1, 1, 1);
 
@@ -2541,56 +2740,40 @@ namespace Framework {
                     flushSpriteBatch();
 
 
-                    if (auto* rc = obj->GetComponentType<Framework::RenderComponent>(
-                        Framework::ComponentTypeId::CT_RenderComponent))
+                    if (item.drawRect)
                     {
-                        if (!rc->visible || rc->a <= 0.0f)
-                            continue;
-
-                        if (!obj->GetComponentType<Framework::SpriteComponent>(
-                            Framework::ComponentTypeId::CT_SpriteComponent))
+                        const BlendMode blendMode = item.blendMode;
+                        applyBlendMode(blendMode);
+
+                        unsigned rectTex = item.texture;
+                        if (!rectTex && item.textureKey)
+                            rectTex = Resource_Manager::getTexture(item.textureKey);
+                        const float scaledW = item.w * item.scaleX;
+                        const float scaledH = item.h * item.scaleY;
+                        if (blendMode == BlendMode::SolidColor)
                         {
-                            const BlendMode blendMode = rc->blendMode;
-                            applyBlendMode(blendMode);
-
-                            unsigned rectTex = rc->texture_id;
-                            if (!rectTex && !rc->texture_key.empty())
-                            {
-                                rectTex = Resource_Manager::getTexture(rc->texture_key);
-                                rc->texture_id = rectTex;
-                            }
-                            const float scaledW = rc->w * tr->scaleX;
-                            const float scaledH = rc->h * tr->scaleY;
-                            if (blendMode == BlendMode::SolidColor)
-                            {
-                                gfx::Graphics::renderRectangle(tr->x, tr->y, tr->rot,
-                                    scaledW, scaledH,
-                                    rc->r, rc->g, rc->b, rc->a);
-                            }
-                            else if (rectTex)
-                            {
-                                gfx::Graphics::renderSprite(rectTex, tr->x, tr->y, tr->rot,
-                                    scaledW, scaledH,
-                                    rc->r, rc->g, rc->b, rc->a);
-                            }
-                            else
-                            {
-                                gfx::Graphics::renderRectangle(tr->x, tr->y, tr->rot,
-                                    scaledW, scaledH,
-                                    rc->r, rc->g, rc->b, rc->a);
-                            }
-
-
+                            gfx::Graphics::renderRectangle(x, y, rot,
+                                scaledW, scaledH,
+                                item.r, item.g, item.b, item.a);
+                        }
+                        else if (rectTex)
+                        {
+                            gfx::Graphics::renderSprite(rectTex, x, y, rot,
+                                scaledW, scaledH,
+                                item.r, item.g, item.b, item.a);
+                        }
+                        else
+                        {
+                            gfx::Graphics::renderRectangle(x, y, rot,
+                                scaledW, scaledH,
+                                item.r, item.g, item.b, item.a);
                         }
                     }
- 
 
-                    if (auto* cc = obj->GetComponentType<Framework::CircleRenderComponent>(
-                        Framework::ComponentTypeId::CT_CircleRenderComponent))
+                    if (item.drawCircle)
                     {
                         applyBlendMode(BlendMode::Alpha);
-                        const float scaledRadius = cc->radius * std::max(std::fabs(tr->scaleX), std::fabs(tr->scaleY));
-                        gfx::Graphics::renderCircle(tr->x, tr->y, scaledRadius, cc->r, cc->g, cc->b, cc->a);
+                        gfx::Graphics::renderCircle(x, y, item.radius, item.cr, item.cg, item.cb, item.ca);
                     }
                 }
 
@@ -2599,6 +2782,7 @@ namespace Framework {
                 {
                     renderProjectiles();
                 }
+                gfx::GpuTimer::End(gfx::GpuPass::Sprites);
 
                 applyBlendMode(BlendMode::Alpha);
 
@@ -2679,7 +2863,7 @@ namespace Framework {
 
                     if (showPhysicsHitboxes && logic.hitBoxSystem)
                     {
-
+                        gfx::GpuTimer::Scope hitboxTimer(gfx::GpuPass::HitboxDebug);
                         for (unsigned id : sortedIds)
                         {
                             auto& objPtr = FACTORY->Objects().at(id);
@@ -2703,20 +2887,17 @@ namespace Framework {
                             // Check HitBoxSystem for active hitboxes
                             for (const auto& activeHit : logic.hitBoxSystem->GetActiveHitBoxes())
                             {
-                                if (activeHit.hitbox && activeHit.hitbox->active)
-                                {
-                                    gfx::Graphics::renderRectangleOutline(
-                                        activeHit.hitbox->spawnX,
-                                        activeHit.hitbox->spawnY,
-                                        0.0f,
-                                        activeHit.hitbox->width,
-                                        activeHit.hitbox->height,
-                                        0.0f, 1.0f, 0.0f, 1.0f, // green outline for enemy attacks
-                                        2.0f
-                                    );
-                                    std::cout << "Hit Box produced at coordinate:" << activeHit.hitbox->spawnX
-                                        << "," << activeHit.hitbox->spawnY << std::endl;
-                                }
+                                gfx::Graphics::renderRectangleOutline(
+                                    activeHit.spawnX,
+                                    activeHit.spawnY,
+                                    0.0f,
+                                    activeHit.width,
+                                    activeHit.height,
+                                    0.0f, 1.0f, 0.0f, 1.0f, // green outline for enemy attacks
+                                    2.0f
+                                );
+                                SOFASPUDS_VLOG("HitBox", "drawn at coordinate:" << activeHit.spawnX
+                                    << "," << activeHit.spawnY);
                             }
                         }
                     }
@@ -2742,10 +2923,11 @@ namespace Framework {
             gfx::Graphics::resetViewProjection();
 
             // Displays objective
+            gfx::GpuTimer::Begin(gfx::GpuPass::Text);
             std::string enemyText = "Didnt work";
-            if (logic.enemiesAlive > 0)
+            if (frame->enemiesAlive > 0)
             {
-                enemyText = "Objective: Kill all enemies (" + std::to_string(logic.enemiesAlive) + " enemies remaining)";
+                enemyText = "Objective: Kill all enemies (" + std::to_string(frame->enemiesAlive) + " enemies remaining)";
             }
             else
             {
@@ -2781,12 +2963,18 @@ namespace Framework {
                     glm::vec3(0.95f, 0.85f, 0.10f)
                 );*/
             }
+            gfx::GpuTimer::End(gfx::GpuPass::Text);
 
-            
 #if SOFASPUDS_ENABLE_EDITOR
             const double renderMs = std::chrono::duration<double, std::milli>(clock::now() - t0).count();
             Framework::setRender(renderMs);
 #endif
+            if (pipelined)
+            {
+                // Game objects belong to the main thread again from here on.
+                SimulationThread::Sync();
+                Resource_Manager::BeginFrame();
+            }
 
             RestoreFullViewport(); // Restore full window viewport for ImGui.
 #if SOFASPUDS_ENABLE_EDITOR
@@ -2805,6 +2993,7 @@ namespace Framework {
 #endif
 
             t0 = clock::now();
+            PROFILE_SCOPE("RenderSystem::EditorUI");
 #if SOFASPUDS_ENABLE_EDITOR
 
             DrawViewportControls();
@@ -2849,6 +3038,8 @@ namespace Framework {
             Framework::DrawPerformanceWindow();
 #endif
             ProcessImportedAssets();
+            if (pipelined)
+                HandleShortcuts(); // after the world pass, so an editor toggle starts with next frame
 #if SOFASPUDS_ENABLE_EDITOR
             const double imguiMs = std::chrono::duration<double, std::milli>(clock::now() - t0).count();
             Framework::setImGui(imguiMs);
@@ -2861,6 +3052,9 @@ namespace Framework {
     *************************************************************************************/
     void RenderSystem::Shutdown()
     {
+        EventBus::Instance().Unsubscribe(zoomSubscription);
+        zoomSubscription = 0;
+
 #if SOFASPUDS_ENABLE_EDITOR
         // Skip ImGui teardown if the context was never created (early failures)
       // to avoid dereferencing a null ImGui state pointer on shutdown.
@@ -2873,6 +3067,7 @@ namespace Framework {
         if (window && window->raw())
             glfwSetDropCallback(window->raw(), nullptr);
 
+        gfx::GpuTimer::Shutdown();
         gfx::Graphics::cleanup();
         Resource_Manager::unloadAll(Resource_Manager::Graphics);
 
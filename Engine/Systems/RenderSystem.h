@@ -13,6 +13,9 @@
             - Picking: cursor-to-world, object hit tests, and selection framing.
             Provides Begin/EndMenuFrame helpers (without drawing the engine default background).
             Exposes editor visibility for other systems to react to UI state.
+            The world pass draws from a Framework::RenderFrame: built from live state in a
+            normal frame, or the RenderSnapshot captured by CaptureRenderState() while the
+            simulation thread runs the next steps (pipelined frames).
  \copyright
             All content ©2025 DigiPen Institute of Technology Singapore.
             All rights reserved.
@@ -21,6 +24,7 @@
 #pragma once
 
 #include "LogicSystem.h"
+#include "RenderSnapshot.h"
 #include "Component/CircleRenderComponent.h"
 #include "Component/GlowComponent.h"
 #include "Component/RenderComponent.h"
@@ -46,13 +50,17 @@
 #endif
 
 #include "Factory/Factory.h"
+#include "Messaging_System/EventBus.h"
+#include "Messaging_System/GameplayEvents.h"
 #include "Graphics/Graphics.hpp"
 #include "Graphics/Camera2D.hpp"
 #include "Graphics/Window.hpp"
 #include "Graphics/GraphicsText.hpp"
 #include "Resource_Asset_Manager/Resource_Manager.h"
+#include "Memory/FrameArena.h"
 
 #include <array>
+#include <atomic>
 #include <filesystem>
 #include <string>
 #if SOFASPUDS_ENABLE_EDITOR
@@ -103,6 +111,13 @@ namespace Framework {
         *************************************************************************/
         void draw() override;
 
+        /*************************************************************************
+          \brief  Fill RenderSnapshot::Back() from the current game state.
+          \note   Runs after every fixed step while capture is on, on whichever
+                  thread is simulating. Reads game state only; no GL calls.
+        *************************************************************************/
+        void CaptureRenderState() override;
+
         // Menu helpers (do NOT draw the engine default background here)
         /// \brief Begin drawing a simple menu bar frame (no default background).
         void BeginMenuFrame();
@@ -141,6 +156,8 @@ namespace Framework {
         bool ScreenToWorld(double cursorX, double cursorY,
             float& worldX, float& worldY,
             bool& insideViewport) const;
+        /// \brief  World-space rectangle seen by the gameplay camera (NDC square when the camera is off).
+        void GetGameViewBounds(float& minX, float& minY, float& maxX, float& maxY) const;
         /// \brief  Access the last world-space view-projection matrix for camera-based UI.
         const glm::mat4& GetWorldViewProjectionMatrix() const { return worldViewProjection; }
 
@@ -148,6 +165,19 @@ namespace Framework {
         void SetCameraViewHeight(float viewHeight);
 
     private:
+        // --- Gameplay events ---------------------------------------------------------------
+        void OnZoomTriggered(const ZoomTriggeredEvent& event);
+        EventBus::SubscriptionId zoomSubscription = 0;
+        /// Zoom requested by gameplay (possibly on the simulation thread); applied by draw(). < 0 = none.
+        std::atomic<float> pendingViewHeight{ -1.0f };
+
+        // --- World pass input -------------------------------------------------------------
+        /// Object ids ordered by layer group, sublayer, then id.
+        FrameVector<unsigned> SortedObjectIds() const;
+        /// Record what the world pass draws for \a sortedIds into \a frame (alpha 1).
+        void BuildRenderFrame(RenderFrame& frame, const FrameVector<unsigned>& sortedIds);
+        RenderFrame liveFrame;            //!< Built by draw() when not drawing a snapshot.
+
         // --- Filesystem / asset resolution ------------------------------------------------
         std::string             FindRoboto() const;
         std::filesystem::path FindAssetsRoot() const;
@@ -17,6 +17,13 @@
 #include "SystemManager.h"
 #include <chrono>
 #include "Debug/Perf.h"
+#include "Messaging_System/EventBus.h"
+#include "Memory/HeapCounter.h"
+#include "Memory/AllocProfiler.h"
+#include "Debug/Profiler.h"
+#include "Systems/RenderInterpolation.h"
+#include "Systems/RenderSnapshot.h"
+#include "Core/SimulationThread.h"
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
 #ifdef _DEBUG
@@ -40,33 +47,80 @@ namespace Framework
       \brief  Update every registered system and record per-system elapsed time (ms).
       \param  dt  Delta time in seconds for this frame (simulation step).
       \note   Uses high_resolution_clock; timings are forwarded to RecordSystemTiming().
+              Events queued on the EventBus are flushed after the last system, timed
+              under "EventBus". Heap allocations this thread makes in here go to HeapCounter, and to
+              AllocProfiler under the system's name when that is compiled in.
+              Transforms are saved first so DrawAll() can interpolate from this step. While
+              RenderSnapshot is capturing, every system's CaptureRenderState() runs last.
+              In pipelined frames this whole function runs on the simulation thread.
     ***************************************************************************************/
     void SystemManager::UpdateAll(float dt)
     {
         using clock = std::chrono::high_resolution_clock;
+        PROFILE_SCOPE("SystemManager::UpdateAll");
+        const std::uint64_t allocationsBefore = HeapCounter::ThreadAllocations();
+        RenderInterpolation::SaveStep();
         for (auto& sys : systems) {
+            const std::string name = sys->GetName();
             const auto start = clock::now();
-            sys->Update(dt);
+            {
+                PROFILE_SCOPE(Profiler::Intern(name));
+                AllocProfiler::SystemScope allocScope(name);
+                sys->Update(dt);
+            }
             const double elapsedMs =
                 std::chrono::duration<double, std::milli>(clock::now() - start).count();
-            Framework::RecordSystemTiming(sys->GetName(), elapsedMs);
+            Framework::RecordSystemTiming(name, elapsedMs);
         }
+
+        // Deliver events the systems queued this frame.
+        const auto start = clock::now();
+        {
+            PROFILE_SCOPE("EventBus::Flush");
+            AllocProfiler::SystemScope allocScope("EventBus");
+            EventBus::Instance().Flush();
+        }
+        Framework::RecordSystemTiming("EventBus",
+            std::chrono::duration<double, std::milli>(clock::now() - start).count());
+
+        if (RenderSnapshot::Capturing()) {
+            PROFILE_SCOPE("SystemManager::CaptureRenderState");
+            for (auto& sys : systems)
+                sys->CaptureRenderState();
+        }
+        HeapCounter::AddFrameAllocations(HeapCounter::Phase::Update, HeapCounter::ThreadAllocations() - allocationsBefore);
     }
 
     /***************************************************************************************
       \brief  Draw every registered system and record per-system elapsed time (ms).
       \note   Draw timings are also forwarded to RecordSystemTiming() with the system name.
+              Systems draw interpolated Transforms (see RenderInterpolation). In a pipelined
+              frame the simulation owns the Transforms, so they are left alone and the
+              renderer interpolates the snapshot instead.
     ***************************************************************************************/
     void SystemManager::DrawAll()
     {
         using clock = std::chrono::high_resolution_clock;
+        PROFILE_SCOPE("SystemManager::DrawAll");
+        const std::uint64_t allocationsBefore = HeapCounter::ThreadAllocations();
+        const bool pipelined = SimulationThread::InFlight();
+        if (!pipelined)
+            RenderInterpolation::Apply();
         for (auto& sys : systems) {
+            const std::string name = sys->GetName();
             const auto start = clock::now();
-            sys->draw();
+            {
+                PROFILE_SCOPE(Profiler::Intern(name));
+                AllocProfiler::SystemScope allocScope(name);
+                sys->draw();
+            }
             const double elapsedMs =
                 std::chrono::duration<double, std::milli>(clock::now() - start).count();
-            Framework::RecordSystemTiming(sys->GetName(), elapsedMs);
+            Framework::RecordSystemTiming(name, elapsedMs);
         }
+        if (!pipelined)
+            RenderInterpolation::Restore();
+        HeapCounter::AddFrameAllocations(HeapCounter::Phase::Draw, HeapCounter::ThreadAllocations() - allocationsBefore);
     }
 
     /***************************************************************************************
@@ -22,15 +22,26 @@
 
 namespace
 {
+	/// Above this many cells Clear() releases the map instead of recycling the buckets.
+	constexpr size_t kMaxRetainedCells = 4096;
+
 	inline int WorldToCell(float value, float cellSize)
 	{
 		return static_cast<int>(std::floor(value / cellSize));
 	}
 }
 
+// Keeps the per-cell vectors (and their capacity) so a rebuild every update does not
+// reallocate; empty cells are skipped by Query like missing ones.
 void UniformGrid::Clear()
 {
-	m_cells.clear();
+	if (m_cells.size() > kMaxRetainedCells)
+	{
+		m_cells.clear();
+		return;
+	}
+	for (auto& cell : m_cells)
+		cell.second.clear();
 }
 
 void UniformGrid::Insert(GOCId id, const Framework::AABB& box)
@@ -51,6 +62,17 @@ void UniformGrid::Insert(GOCId id, const Framework::AABB& box)
 }
 
 void UniformGrid::Query(const Framework::AABB& box, std::vector<GOCId>& out) const
+{
+	QueryInto(box, out);
+}
+
+void UniformGrid::Query(const Framework::AABB& box, Framework::FrameVector<GOCId>& out) const
+{
+	QueryInto(box, out);
+}
+
+template <typename Ids>
+void UniformGrid::QueryInto(const Framework::AABB& box, Ids& out) const
 {
 	out.clear();
 
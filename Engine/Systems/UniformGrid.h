@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <vector>
 #include "Physics/Collision/Collision.h" 
+#include "Memory/FrameArena.h"
 
 using GOCId = unsigned int;
 
@@ -33,7 +34,7 @@ struct CellCoord
 
 	bool operator==(const CellCoord& other) const
 	{
-		return x == other.x && other.y;
+		return x == other.x && y == other.y;
 	}
 };
 
@@ -48,11 +49,17 @@ struct CellCoordHash
 class UniformGrid
 {
 public:
+	explicit UniformGrid(float cellSize = 64.0f) : m_cellSize(cellSize) {}
+
 	void Clear();
 	void Insert(GOCId id, const Framework::AABB& box); 
 	void Query(const Framework::AABB& box, std::vector<GOCId>& out) const;
+	void Query(const Framework::AABB& box, Framework::FrameVector<GOCId>& out) const;
 
 private:
-	float m_cellSize = 64.0f;
+	template <typename Ids>
+	void QueryInto(const Framework::AABB& box, Ids& out) const;
+
+	float m_cellSize;
 	std::unordered_map<CellCoord, std::vector<GOCId>, CellCoordHash> m_cells;
 };
\ No newline at end of file
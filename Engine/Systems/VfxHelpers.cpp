@@ -140,6 +140,7 @@ namespace Framework {
         auto* anim = vfx->EmplaceComponent<SpriteAnimationComponent>(ComponentTypeId::CT_SpriteAnimationComponent);
         SpriteAnimationComponent::SpriteSheetAnimation impact{};
         impact.name = "impact";
+        impact.nameId = StringId::Folded("impact");
         impact.textureKey = kImpactVfxTextureKeyStr;
         impact.spriteSheetPath = ResolveAssetPath("Textures/Character/Ming_Sprite/ImpactVFX_Sprite.png").string();
         impact.config.totalFrames = 8;
@@ -2,6 +2,7 @@
 #include "Core/PathUtils.h"
 #include "RenderSystem.h"
 #include "Resource_Asset_Manager/Resource_Manager.h"
+#include "Component/PlayerHealthComponent.h"
 #include <iostream>
 #include "Common/CRTDebug.h"   // <- bring in DBG_NEW
 
@@ -59,9 +60,73 @@ namespace Framework {
         AudioImGui::Initialize(*window);
 #endif
 
+        EventBus& bus = EventBus::Instance();
+        for (EventBus::SubscriptionId subscription : subscriptions)
+            bus.Unsubscribe(subscription);
+        subscriptions[0] = bus.Subscribe<HitLandedEvent, &AudioSystem::OnHitLanded>(this);
+        subscriptions[1] = bus.Subscribe<EnemyDiedEvent, &AudioSystem::OnEnemyDied>(this);
+        subscriptions[2] = bus.Subscribe<PlayerDiedEvent, &AudioSystem::OnPlayerDied>(this);
+
         std::cout << "[AudioSystem] Initialized successfully.\n";
     }
 
+    /*****************************************************************************************
+     \brief
+        Plays the player's death clip once per life, guarded by deathSoundPlayed.
+    *****************************************************************************************/
+    void AudioSystem::PlayPlayerDeath(GOC* player, AudioComponent* audio)
+    {
+        auto* health = player->GetComponentType<PlayerHealthComponent>(ComponentTypeId::CT_PlayerHealthComponent);
+        if (!health || health->deathSoundPlayed)
+            return;
+        audio->TriggerSound("PlayerDead");
+        health->deathSoundPlayed = true;
+    }
+
+    /*****************************************************************************************
+     \brief
+        Hit reaction on the target: PlayerHit / PlayerDead for the player, EnemyHit for
+        enemies. The attacker's swing sounds stay with HitBoxSystem.
+    *****************************************************************************************/
+    void AudioSystem::OnHitLanded(const HitLandedEvent& event)
+    {
+        GOC* target = FACTORY ? FACTORY->GetObjectWithId(event.target) : nullptr;
+        auto* audio = target ? target->GetComponentType<AudioComponent>(ComponentTypeId::CT_AudioComponent) : nullptr;
+        if (!audio)
+            return;
+
+        if (event.kind == HitLandedEvent::Target::Enemy)
+            audio->TriggerSound("EnemyHit");
+        else if (!event.lethal)
+            audio->TriggerSound("PlayerHit");
+        else
+            PlayPlayerDeath(target, audio);
+    }
+
+    /*****************************************************************************************
+     \brief
+        Plays the explosion clip that matches the enemy's audio entity type.
+    *****************************************************************************************/
+    void AudioSystem::OnEnemyDied(const EnemyDiedEvent& event)
+    {
+        GOC* enemy = FACTORY ? FACTORY->GetObjectWithId(event.id) : nullptr;
+        auto* audio = enemy ? enemy->GetComponentType<AudioComponent>(ComponentTypeId::CT_AudioComponent) : nullptr;
+        if (!audio)
+            return;
+
+        if (audio->entityType == "enemy_fire")
+            audio->Play("FireGhostExplosion");
+        else if (audio->entityType == "enemy_water")
+            audio->Play("WaterGhostExplosion");
+    }
+
+    void AudioSystem::OnPlayerDied(const PlayerDiedEvent& event)
+    {
+        GOC* player = FACTORY ? FACTORY->GetObjectWithId(event.id) : nullptr;
+        if (auto* audio = player ? player->GetComponentType<AudioComponent>(ComponentTypeId::CT_AudioComponent) : nullptr)
+            PlayPlayerDeath(player, audio);
+    }
+
     /*****************************************************************************************
      \brief
         Updates the audio system per frame.
@@ -191,6 +256,11 @@ namespace Framework {
      *****************************************************************************************/
     void AudioSystem::Shutdown()
     {
+        for (EventBus::SubscriptionId& subscription : subscriptions)
+        {
+            EventBus::Instance().Unsubscribe(subscription);
+            subscription = 0;
+        }
         // Unload all sounds
         SoundManager::getInstance().unloadAllSounds();
         // Fully tear down the audio backend to release FMOD allocations
@@ -31,7 +31,8 @@
 #include "Systems/InputSystem.h"
 #include "Common/System.h"
 #include "../Component/AudioComponent.h"
-#include "Messaging_System/Messager_Bus.hpp"
+#include "Messaging_System/EventBus.h"
+#include "Messaging_System/GameplayEvents.h"
 
 #include <array>
 #include <memory>
@@ -75,7 +76,14 @@ namespace Framework {
 
 
 	private:
+		// Gameplay sounds, driven by events queued on EventBus::Instance().
+		void OnHitLanded(const HitLandedEvent& event);
+		void OnEnemyDied(const EnemyDiedEvent& event);
+		void OnPlayerDied(const PlayerDiedEvent& event);
+		static void PlayPlayerDeath(GOC* player, AudioComponent* audio);
+
 		gfx::Window* window;
+		EventBus::SubscriptionId subscriptions[3] = {};
 
 	};
 }
\ No newline at end of file
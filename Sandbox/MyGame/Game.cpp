@@ -9,6 +9,7 @@
 #include "Systems/SystemManager.h"
 #include "Systems/InputSystem.h"
 #include "Systems/LogicSystem.h"
+#include "Systems/AnimationSystem.h"
 #include "Systems/PhysicSystem.h"
 #include "Systems/RenderSystem.h"
 #include "Factory/Factory.h"
@@ -21,8 +22,10 @@
 #include "Debug/CrashLogger.hpp"
 #include "Graphics/Graphics.hpp"
 #include "Debug/Perf.h"
+#include "Core/SimulationThread.h"
 #include "Memory/GameObjectPool.h"
 #include "Memory/ObjectAllocator.h"
+#include "Resource_Asset_Manager/StartupPreloader.h"
 #include <algorithm>
 #include <array>
 #include <GLFW/glfw3.h>
@@ -104,9 +107,11 @@ namespace mygame {
         Framework::AiSystem* gAiSystem = nullptr;
         Framework::HealthSystem* gHealthSystem = nullptr;
         Framework::ParticleSystem* gParticleSystem = nullptr;
+        Framework::AnimationSystem* gAnimationSystem = nullptr;
 
         enum class GameState { MAIN_MENU, TRANSITIONING, PLAYING, PAUSED, DEFEAT, EXIT };
         GameState currentState = GameState::MAIN_MENU;
+        GameState drawState = GameState::MAIN_MENU;   // state draw() uses while update() runs on the simulation thread
         bool editorSimulationRunning = false;
        
 
@@ -130,6 +135,7 @@ namespace mygame {
     {
         gInputSystem = gSystems.RegisterSystem<Framework::InputSystem>(win);
         gLogicSystem = gSystems.RegisterSystem<Framework::LogicSystem>(win, *gInputSystem);
+        gAnimationSystem = gSystems.RegisterSystem<Framework::AnimationSystem>();
         gPhysicsSystem = gSystems.RegisterSystem<Framework::PhysicSystem>(*gLogicSystem);
         gAiSystem = gSystems.RegisterSystem<Framework::AiSystem>(win, *gLogicSystem);
         gAudioSystem = gSystems.RegisterSystem<Framework::AudioSystem>(win);
@@ -141,7 +147,11 @@ namespace mygame {
         //(void)gAudioSystem;
         //(void)gRenderSystem;
 
+        // Decode textures, open sounds and parse prefabs on workers while the systems
+        // initialize; the loaders join each asset only where they consume it.
+        Framework::StartupPreloader::Begin();
         gSystems.IntializeAll();
+        Framework::StartupPreloader::Finish();
 
 
         mainMenu.Init(gRenderSystem->ScreenWidth(), gRenderSystem->ScreenHeight());
@@ -384,10 +394,24 @@ namespace mygame {
             }, "mygame::update");
     }
 
+    /*****************************************************************************************
+      \brief Pipeline gate for Core: only steady gameplay with the editor hidden may simulate on
+             the worker thread. Menus, transitions and editor panels read game state while
+             drawing, so those frames stay serial.
+    *****************************************************************************************/
+    bool canPipeline()
+    {
+        const bool steady = currentState == GameState::PLAYING && editorSimulationRunning &&
+            !Framework::RenderSystem::IsEditorVisible();
+        if (steady)
+            drawState = currentState; // update() may change currentState while draw() runs
+        return steady;
+    }
+
     void draw()
     {
         TryGuard::Run([&] {
-            switch (currentState)
+            switch (Framework::SimulationThread::InFlight() ? drawState : currentState)
             {
             case GameState::MAIN_MENU:
                 if (gRenderSystem) {
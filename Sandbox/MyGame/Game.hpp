@@ -32,6 +32,7 @@ namespace mygame {
     void draw();
     void shutdown();
     void onAppFocusChanged(bool suspended);
+    bool canPipeline();
     // Editor simulation controls
     bool IsEditorSimulationRunning();
     void EditorPlaySimulation();
@@ -3,6 +3,9 @@
  \par       SofaSpuds
  \author    yimo kong (yimo.kong@digipen.edu) - Primary Author, 100%
  \brief     Program entry point.
+            - Parses benchmark options: --record <file> records every fixed step's input,
+              --replay <file> plays a recording back in lockstep and exits when it ends
+              (see Framework::InputRecorder).
             - Loads window configuration from JSON (../../Data_Files/window.json).
             - Creates the Core (window + main loop) and wires the game lifecycle
               callbacks (init/update/draw/shutdown) exposed by Game.hpp.
@@ -16,19 +19,31 @@
 #include "../Engine/Core/PathUtils.h"
 #include "Game.hpp"
 #include "Config/WindowConfig.h"
+#include "Input/InputRecorder.h"
 #include <filesystem>
+#include <string_view>
 
 #ifdef _MSC_VER
 #define _CRTDBG_MAP_ALLOC
 #include <crtdbg.h>
 #endif
 
-int main()
+int main(int argc, char** argv)
 {
 #ifdef _MSC_VER
     // Enable MSVC CRT leak checks (prints leaks in the Output window at exit).
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif
+    // Benchmark options; paths are relative to the directory the game was launched from.
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        const std::string_view option = argv[i];
+        if (option == "--record")
+            Framework::InputRecorder::StartRecording(std::filesystem::absolute(argv[++i]));
+        else if (option == "--replay")
+            Framework::InputRecorder::StartReplay(std::filesystem::absolute(argv[++i]), true);
+    }
+
     // Ensure the working directory matches the executable so relative paths resolve in builds.
     if (auto exeDir = Framework::GetExecutableDir(); !exeDir.empty())
     {
@@ -45,6 +60,7 @@ int main()
     Core core(cfg.width, cfg.height, cfg.title.c_str(), cfg.fullscreen);
     core.SetCallbacks(mygame::init, mygame::update, mygame::draw, mygame::shutdown);
     core.SetSuspendCallback(mygame::onAppFocusChanged);
+    core.SetPipelineGate(mygame::canPipeline);
     // Run main loop.
     core.Run();
     return 0;
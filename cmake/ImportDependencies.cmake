@@ -107,6 +107,40 @@ macro(import_freetype)
   endif()
 endmacro()
 
+# ---- bc7enc (BC7 encoder used by the texture cook step) ----
+# The encoder decides the cooked texture bytes, so it is only fetched at a fixed commit.
+# bc7enc_rdo has no release tags; set the full SHA of the commit to build against.
+# Without one the bc7enc target is not created and the cook step writes RGBA8.
+set(SOFASPUDS_BC7ENC_COMMIT "" CACHE STRING "bc7enc_rdo commit SHA (40 hex digits) used by the texture cook")
+
+macro(import_bc7enc)
+  string(LENGTH "${SOFASPUDS_BC7ENC_COMMIT}" BC7ENC_COMMIT_LENGTH)
+  if (TARGET bc7enc)
+    # already imported
+  elseif (NOT SOFASPUDS_BC7ENC_COMMIT MATCHES "^[0-9a-fA-F]+$" OR NOT BC7ENC_COMMIT_LENGTH EQUAL 40)
+    message(WARNING
+      "[SofaSpuds] bc7enc not fetched: SOFASPUDS_BC7ENC_COMMIT is '${SOFASPUDS_BC7ENC_COMMIT}', "
+      "not a full commit SHA. Textures are cooked as RGBA8. To enable BC7, pin a commit from "
+      "'git ls-remote https://github.com/richgel999/bc7enc_rdo.git master'.")
+  else()
+    FetchContent_Declare(
+      bc7enc
+      GIT_REPOSITORY https://github.com/richgel999/bc7enc_rdo.git
+      GIT_TAG ${SOFASPUDS_BC7ENC_COMMIT}
+      SOURCE_SUBDIR do_not_add_upstream_cmake   # only the encoder sources are needed
+    )
+    FetchContent_MakeAvailable(bc7enc)
+
+    file(GLOB BC7ENC_SOURCES ${bc7enc_SOURCE_DIR}/bc7enc.c*)
+    add_library(bc7enc STATIC ${BC7ENC_SOURCES})
+    target_include_directories(bc7enc PUBLIC ${bc7enc_SOURCE_DIR})
+    if (MSVC)
+      target_compile_options(bc7enc PRIVATE /W0)
+    else()
+      target_compile_options(bc7enc PRIVATE -w)
+    endif()
+  endif()
+endmacro()
 
 # ---- Bundle entrypoint ----
 macro(importDependencies)
@@ -115,4 +149,5 @@ macro(importDependencies)
   import_stb_image()
   import_imgui()
   import_freetype()
+  import_bc7enc()
 endmacro()